@@ -0,0 +1,438 @@
+// Chebyshev ephemeris of the NOAA solar equations, generated by noaa_clock -cheb
+// from Julian day 2433282.5 in segments of 128 days, 8 coefficients per quantity.
+// Per segment: declination [deg], equation of time [min], equation of centre
+// [deg], radius vector [AU]. Do not edit.
+
+static const float cheb_tab [431][4][8] = {
+  {{-8.97097778e+00,2.12536240e+01,1.50735414e+00,-1.15373945e+00,1.99329816e-02,7.65824411e-03,-4.18396341e-03,9.98671399e-04},{-1.06309557e+01,5.87031221e+00,5.88521528e+00,-2.63691735e+00,-3.90299618e-01,1.86068967e-01,-1.21202338e-02,-3.76946689e-03},{2.41727448e+00,8.61534119e-01,-4.72399980e-01,-4.40710299e-02,1.36959273e-02,4.71006613e-04,-1.93965359e-04,4.62054186e-06},{1.98866224e+00,1.39295310e-02,2.15199194e-03,-7.92689563e-04,-5.04910095e-05,1.43039042e-05,2.21480633e-07,-1.64216161e-07}},
+  {{3.22126846e+01,-7.13384342e+00,-5.82445526e+00,4.40943599e-01,1.55448347e-01,-2.02608947e-02,-3.08340741e-03,1.52199680e-03},{-2.31433347e-01,-1.63042247e+00,4.55104017e+00,2.03075790e+00,-6.42391801e-01,-1.52768299e-01,4.82388921e-02,5.67407534e-03},{-3.46278816e-01,-1.77060640e+00,6.22199513e-02,9.18409228e-02,-1.29764597e-03,-1.13091408e-03,1.11173892e-06,6.15140380e-07},{2.02412009e+00,-1.94780750e-03,-4.43363236e-03,9.76682932e-05,1.07071151e-04,-9.98345172e-07,-7.23680841e-07,-5.77260373e-09}},
+  {{-2.68660641e+01,-1.29178848e+01,5.24602795e+00,9.25195217e-01,-1.20676748e-01,-4.15615812e-02,-2.47133337e-03,2.08416372e-03},{9.56250477e+00,-8.60082150e+00,-9.19731140e+00,1.16527689e+00,1.12764382e+00,-5.61759155e-03,-7.18586892e-02,-8.01303610e-03},{-2.00777435e+00,1.23975205e+00,3.97018939e-01,-6.73204511e-02,-1.20052677e-02,1.00173021e-03,1.93152780e-04,-4.82014684e-06},{1.98375237e+00,-1.16095282e-02,3.13618267e-03,6.72355818e-04,-8.15024032e-05,-1.29435257e-05,7.63488458e-07,1.77246577e-07}},
+  {{1.82029176e+00,2.19138412e+01,-4.65488046e-01,-1.09657001e+00,3.16741168e-02,-8.58217318e-05,-2.15248976e-04,9.39502730e-04},{-1.04766598e+01,9.75463104e+00,1.24679124e+00,-3.00247169e+00,9.76777673e-02,1.45205393e-01,-1.03455298e-02,4.94221644e-03},{2.71330714e+00,3.06675315e-01,-5.21088421e-01,-1.17055075e-02,1.41684627e-02,-1.52084875e-04,-1.59851523e-04,1.21448429e-05},{1.99594700e+00,1.55564444e-02,7.25425547e-04,-8.62521119e-04,-9.03556065e-06,1.40692600e-05,-3.49645205e-07,-1.14868463e-07}},
+  {{2.72097054e+01,-1.31392965e+01,-4.83386326e+00,7.33461678e-01,9.44451541e-02,-2.20399164e-02,2.04051775e-03,1.00811780e-03},{2.16432667e+00,3.42742300e+00,6.51225281e+00,3.54703277e-01,-8.53590846e-01,1.00686690e-02,4.30715270e-02,-8.36977083e-03},{-1.19250357e+00,-1.61371696e+00,2.15354934e-01,8.49502161e-02,-4.58786869e-03,-1.11674168e-03,7.13654117e-06,2.28779049e-06},{2.02194071e+00,-6.71733730e-03,-4.05397546e-03,3.39436985e-04,1.00301098e-04,-3.61859566e-06,-7.68801613e-07,-1.64097163e-08}},
+  {{-3.13909225e+01,-6.40390348e+00,6.44204140e+00,5.19955575e-01,-2.27820501e-01,-3.29599865e-02,7.38787418e-03,2.80613196e-03},{5.99923658e+00,-1.54432983e+01,-5.54639769e+00,3.26549768e+00,7.61766255e-01,-2.44728044e-01,-6.21907264e-02,1.26715070e-02},{-1.30356455e+00,1.60535502e+00,2.60699928e-01,-9.07193571e-02,-8.20035022e-03,1.60156831e-03,1.46899882e-04,-1.77677939e-05},{1.97904789e+00,-7.56255304e-03,4.09655878e-03,4.45405225e-04,-1.13672017e-04,-9.10203653e-06,1.41899636e-06,1.43770563e-07}},
+  {{1.24632845e+01,2.03523655e+01,-2.31585097e+00,-1.01150620e+00,3.89323346e-02,4.69884044e-03,2.88632582e-03,5.75535814e-04},{-9.12858295e+00,9.20241165e+00,-3.16945910e+00,-2.31364298e+00,4.94945377e-01,1.23546720e-01,-2.41319090e-03,-7.70007609e-04},{2.72919321e+00,-2.73487628e-01,-5.14582872e-01,1.99640505e-02,1.30431317e-02,-6.22116087e-04,-1.07508997e-04,1.35029622e-05},{2.00366998e+00,1.55645367e-02,-7.44297809e-04,-8.39486776e-04,2.93941612e-05,1.22129977e-05,-7.00366400e-07,-5.61331177e-08}},
+  {{1.94581432e+01,-1.78441868e+01,-3.42753267e+00,9.02976632e-01,4.56761383e-02,-1.13773579e-02,3.91194830e-03,-1.08156790e-04},{5.04302549e+00,9.08706093e+00,5.69235706e+00,-1.42129207e+00,-6.95260525e-01,1.03332557e-01,9.91529785e-03,-8.20900593e-03},{-1.91699827e+00,-1.29470861e+00,3.49788517e-01,7.04860166e-02,-7.77725037e-03,-1.06314546e-03,2.37429304e-05,5.77882201e-06},{2.01753592e+00,-1.08302655e-02,-3.27698491e-03,5.55934676e-04,8.55768594e-05,-6.42861596e-06,-8.30247473e-07,-1.39014436e-08}},
+  {{-3.26390648e+01,8.94373655e-01,6.82556963e+00,-4.85063083e-02,-2.71447927e-01,2.35097203e-03,1.24231931e-02,-2.72268866e-04},{1.79750764e+00,-1.78932896e+01,2.67411321e-01,4.01299095e+00,-8.37446228e-02,-3.41810167e-01,7.82773457e-03,2.19707508e-02},{-4.64157313e-01,1.80184770e+00,9.33868140e-02,-1.03674658e-01,-2.99887895e-03,1.96067803e-03,5.66107556e-05,-2.64179016e-05},{1.97653627e+00,-2.69750832e-03,4.61638393e-03,1.60301075e-04,-1.31875509e-04,-3.37893994e-06,1.82896201e-06,5.71324925e-08}},
+  {{2.17949314e+01,1.67808323e+01,-3.95832467e+00,-8.78939569e-01,6.95186555e-02,1.60318166e-02,3.45878582e-03,-2.80202628e-04},{-7.33593512e+00,5.23628378e+00,-5.72345209e+00,-8.21427286e-01,7.89376199e-01,8.02865922e-02,-2.28578579e-02,-9.37251747e-03},{2.46413040e+00,-8.19095194e-01,-4.56563652e-01,4.77697998e-02,1.08024105e-02,-9.13287047e-04,-5.85373236e-05,1.04424516e-05},{2.01103425e+00,1.39824888e-02,-2.10606633e-03,-7.34584115e-04,6.11692958e-05,9.50181948e-06,-8.37570951e-07,-1.04110223e-08}},
+  {{9.69073772e+00,-2.08169098e+01,-1.76953328e+00,9.94625270e-01,2.81614847e-02,-3.40559578e-04,2.28859577e-03,-6.95300463e-04},{8.21017838e+00,1.27325821e+01,2.30663753e+00,-2.67477036e+00,-3.73714894e-01,1.17292762e-01,-1.06822781e-03,2.82012089e-03},{-2.44537807e+00,-8.42586339e-01,4.52751905e-01,4.89231981e-02,-1.06799956e-02,-9.22793057e-04,5.66004528e-05,1.02437798e-05},{2.01135373e+00,-1.38731571e-02,-2.16421694e-03,7.28016777e-04,6.24428794e-05,-9.36717061e-06,-8.39763970e-07,8.81214302e-09}},
+  {{-3.05108490e+01,8.11078930e+00,6.28735447e+00,-6.06388211e-01,-2.17786640e-01,3.52947973e-02,6.07531052e-03,-2.91893049e-03},{-2.55458403e+00,-1.52093744e+01,5.85387230e+00,2.96012950e+00,-8.71254683e-01,-2.03899503e-01,6.93374947e-02,8.43627937e-03},{4.23383921e-01,1.80633938e+00,-8.52054209e-02,-1.03973940e-01,2.73766299e-03,1.96921080e-03,-5.17411827e-05,-2.66311308e-05},{1.97647905e+00,2.46081525e-03,4.62829322e-03,-1.46280043e-04,-1.32299319e-04,3.08575432e-06,1.83884936e-06,-5.22538102e-08}},
+  {{2.88675976e+01,1.15658073e+01,-5.26200104e+00,-6.47116303e-01,1.25311211e-01,2.24074554e-02,7.06246792e-05,-1.37283967e-03},{-5.54662561e+00,2.04223752e-01,-5.51267433e+00,1.01776052e+00,8.28988552e-01,-4.85412478e-02,-4.98686582e-02,-4.19202959e-03},{1.94623446e+00,-1.27638185e+00,-3.55326444e-01,6.96370676e-02,7.91945029e-03,-1.05897593e-03,-2.48767956e-05,5.97526969e-06},{2.01728392e+00,1.09971752e-02,-3.23216617e-03,-5.64999704e-04,8.46923067e-05,6.56279371e-06,-8.32451974e-07,1.33358080e-08}},
+  {{-1.08312488e+00,-2.17712517e+01,4.30457518e-02,1.06366813e+00,2.98429374e-02,1.83264213e-03,-1.08517602e-03,-9.48110188e-04},{1.09400826e+01,1.22568550e+01,-2.51832604e+00,-3.09223509e+00,9.94798541e-03,1.40905753e-01,1.46672521e-02,5.24902483e-03},{-2.72284460e+00,-2.99935430e-01,5.12954891e-01,2.13533733e-02,-1.29594151e-02,-6.39345613e-04,1.05029634e-04,1.34347338e-05},{2.00402474e+00,-1.55245867e-02,-8.10718164e-04,8.36274703e-04,3.10258984e-05,-1.21001531e-05,-7.10927679e-07,5.36138778e-08}},
+  {{-2.51781044e+01,1.43853788e+01,4.96007538e+00,-9.88463819e-01,-1.09387174e-01,3.99678536e-02,-3.34593188e-03,-1.73970230e-03},{-6.53907061e+00,-8.43408108e+00,8.94323063e+00,7.39229023e-01,-1.12021995e+00,3.53376158e-02,6.49022385e-02,-1.07883681e-02},{1.26693165e+00,1.61831343e+00,-2.53484607e-01,-9.15655717e-02,7.98459258e-03,1.62449374e-03,-1.43548779e-04,-1.83031898e-05},{1.97888184e+00,7.35104503e-03,4.13075136e-03,-4.33218753e-04,-1.14853043e-04,8.87150964e-06,1.44482544e-06,-1.40784991e-07}},
+  {{3.30337791e+01,5.22359228e+00,-6.05562401e+00,-2.96694189e-01,1.76904753e-01,1.35420337e-02,-5.07857511e-03,-1.18555862e-03},{-3.79604077e+00,-3.38428593e+00,-2.70422792e+00,2.45601797e+00,4.61701810e-01,-2.03278437e-01,-3.67915593e-02,1.05541134e-02},{1.22927272e+00,-1.60220778e+00,-2.22068965e-01,8.44387561e-02,4.73809568e-03,-1.11535110e-03,-7.61916181e-06,2.41164730e-06},{2.02178097e+00,6.92503527e-03,-4.02606791e-03,-3.50118411e-04,9.97914685e-05,3.74358456e-06,-7.71666691e-07,1.66460730e-08}},
+  {{-1.16842279e+01,-2.05530052e+01,1.95427310e+00,1.11619961e+00,1.89566351e-02,-8.81431065e-03,-4.95230174e-03,-9.43149964e-04},{1.22528400e+01,7.12401581e+00,-7.09468412e+00,-2.47579908e+00,4.92562771e-01,1.87714189e-01,1.08969668e-02,-6.86589861e-03},{-2.72004223e+00,2.79874384e-01,5.21938264e-01,-1.01968683e-02,-1.41465897e-02,-1.77590715e-04,1.57622315e-04,1.23366699e-05},{1.99630165e+00,-1.55912107e-02,6.57090335e-04,8.63352790e-04,-7.15725537e-06,-1.40116063e-05,-3.70882788e-07,1.12129136e-07}},
+  {{-1.71110516e+01,1.90087795e+01,3.14458776e+00,-1.14619386e+00,-1.78120770e-02,2.26942133e-02,-6.27284218e-03,3.48466710e-04},{-9.45290279e+00,-6.61107898e-02,8.51930332e+00,-1.46940863e+00,-8.17696154e-01,1.78399503e-01,1.61175635e-02,-1.34841073e-02},{1.97899580e+00,1.25970531e+00,-3.91578257e-01,-6.85739890e-02,1.18668200e-02,1.03229203e-03,-1.92123131e-04,-5.42922362e-06},{1.98349440e+00,1.14453156e-02,3.18835210e-03,-6.63467217e-04,-8.32027072e-05,1.28151332e-05,7.95934000e-07,-1.76972250e-07}},
+  {{3.39492989e+01,-1.61319351e+00,-6.20423698e+00,1.19634531e-01,1.86472267e-01,-6.80657849e-03,-6.33668108e-03,5.54501137e-04},{-1.94757533e+00,-3.85696459e+00,1.44382393e+00,2.76568937e+00,-1.80835173e-01,-2.42406040e-01,1.49266794e-02,1.50793390e-02},{3.86900216e-01,-1.76692271e+00,-6.95166364e-02,9.16796327e-02,1.45034201e-03,-1.13058882e-03,-1.26551049e-06,6.52938581e-07},{2.02406859e+00,2.17619189e-03,-4.42472659e-03,-1.09125082e-04,1.06912863e-04,1.11633869e-06,-7.24723861e-07,6.42536246e-09}},
+  {{-2.09416962e+01,-1.71679134e+01,3.85377645e+00,1.08553767e+00,-3.70033979e-02,-2.90281065e-02,-6.40428625e-03,1.97163812e-04},{1.15581598e+01,-1.24010539e+00,-9.61103439e+00,-7.68622339e-01,9.74098921e-01,1.47213221e-01,-3.46198715e-02,-1.56647302e-02},{-2.43644881e+00,8.37143779e-01,4.75778967e-01,-4.26083170e-02,-1.37557918e-02,4.40005329e-04,1.93090251e-04,5.09636448e-06},{1.98898065e+00,-1.40368240e-02,2.08890764e-03,7.97880464e-04,-4.85760793e-05,-1.43360458e-05,1.91261137e-07,1.62526121e-07}},
+  {{-7.11007023e+00,2.15318108e+01,1.15459538e+00,-1.14696586e+00,2.38929316e-02,5.33701153e-03,-3.50328116e-03,1.02792843e-03},{-1.07087507e+01,6.84272957e+00,5.13373327e+00,-2.78346610e+00,-2.98077494e-01,1.79779217e-01,-1.43191563e-02,-1.46458496e-03},{2.48593497e+00,7.71582007e-01,-4.84452188e-01,-3.86860184e-02,1.39027080e-02,3.57883953e-04,-1.90455234e-04,6.31789635e-06},{1.98983657e+00,1.43134529e-02,1.91934884e-03,-8.11125268e-04,-4.34529939e-05,1.44062833e-05,1.11796972e-07,-1.57731407e-07}},
+  {{3.15455856e+01,-8.26268959e+00,-5.68642044e+00,5.01704514e-01,1.45429775e-01,-2.18324754e-02,-2.11064215e-03,1.55428599e-03},{1.37361601e-01,-8.81379783e-01,5.07538795e+00,1.77765107e+00,-7.10955143e-01,-1.24265842e-01,5.11370860e-02,2.83874851e-03},{-4.94860798e-01,-1.75588906e+00,8.89579356e-02,9.11990702e-02,-1.85899786e-03,-1.12980604e-03,1.71542456e-06,7.68057873e-07},{2.02391529e+00,-2.78391875e-03,-4.39806841e-03,1.39692129e-04,1.06445354e-04,-1.43360160e-06,-7.28163798e-07,-8.11845435e-09}},
+  {{-2.78827038e+01,-1.18586826e+01,5.50238609e+00,8.70107591e-01,-1.40752673e-01,-4.23131846e-02,-9.56846518e-04,2.44198530e-03},{9.02410984e+00,-1.00255527e+01,-8.78794670e+00,1.58360708e+00,1.10947287e+00,-4.83124442e-02,-7.54878446e-02,-4.73083230e-03},{-1.90075755e+00,1.31193829e+00,3.76700193e-01,-7.18697906e-02,-1.14810728e-02,1.11341744e-03,1.88896913e-04,-7.07143863e-06},{1.98282027e+00,-1.09979194e-02,3.32511822e-03,6.39060745e-04,-8.76854465e-05,-1.24511535e-05,8.82513291e-07,1.75712117e-07}},
+  {{3.74026823e+00,2.17917366e+01,-8.02559674e-01,-1.08336353e+00,3.22718807e-02,-3.98982702e-05,4.36898059e-04,8.94432538e-04},{-1.02999191e+01,9.95431328e+00,3.99752468e-01,-2.95020342e+00,1.73531964e-01,1.39622822e-01,-7.93496985e-03,4.93313465e-03},{2.73568010e+00,2.08219811e-01,-5.23753345e-01,-6.17780909e-03,1.40753994e-02,-2.44252355e-04,-1.51546512e-04,1.27899011e-05},{1.99724984e+00,1.56705957e-02,4.74450353e-04,-8.64814909e-04,-2.17062188e-06,1.38448504e-05,-4.25551463e-07,-1.04768915e-07}},
+  {{2.60199375e+01,-1.40738802e+01,-4.60930300e+00,7.71446764e-01,8.39323699e-02,-2.07414720e-02,2.67497287e-03,8.02153081e-04},{2.61584640e+00,4.46065712e+00,6.57754803e+00,2.60332897e-02,-8.47038209e-01,3.40313539e-02,3.77296731e-02,-9.63347219e-03},{-1.32613480e+00,-1.57008982e+00,2.39826784e-01,8.30064639e-02,-5.13946218e-03,-1.11131615e-03,9.02556349e-06,2.76128299e-06},{2.02133632e+00,-7.47308834e-03,-3.94809525e-03,3.78440804e-04,9.83600839e-05,-4.08085998e-06,-7.79512504e-07,-1.71324164e-08}},
+  {{-3.18480988e+01,-5.15113497e+00,6.57256126e+00,4.27718699e-01,-2.41847441e-01,-2.81624664e-02,8.97325482e-03,2.50182790e-03},{5.30961800e+00,-1.62251720e+01,-4.62228537e+00,3.51926732e+00,6.35897040e-01,-2.77410060e-01,-5.28937280e-02,1.58081967e-02},{-1.16808152e+00,1.65125382e+00,2.33935192e-01,-9.37236771e-02,-7.39440555e-03,1.68329116e-03,1.34140326e-04,-1.96861311e-05},{1.97846019e+00,-6.77936058e-03,4.21777461e-03,4.00117453e-04,-1.17870826e-04,-8.23657138e-06,1.51128529e-06,1.32253660e-07}},
+  {{1.42284460e+01,1.98569851e+01,-2.62278461e+00,-9.92983878e-01,4.21986766e-02,6.49662502e-03,3.22292908e-03,4.69353661e-04},{-8.83092117e+00,8.67733288e+00,-3.78901815e+00,-2.09834790e+00,5.56461453e-01,1.20067067e-01,-3.78868449e-03,-2.67421943e-03},{2.70310187e+00,-3.70097458e-01,-5.08095384e-01,2.50238720e-02,1.27251223e-02,-6.83623774e-04,-9.84652943e-05,1.32104769e-05},{2.00496674e+00,1.54020572e-02,-9.86846979e-04,-8.26885051e-04,3.53186588e-05,1.17908912e-05,-7.37073606e-07,-4.70383235e-08}},
+  {{1.78548641e+01,-1.84985657e+01,-3.14894962e+00,9.22643483e-01,4.02539857e-02,-9.11708083e-03,3.82675207e-03,-2.56113912e-04},{5.57769680e+00,9.95693016e+00,5.25950670e+00,-1.69203663e+00,-6.44446909e-01,1.09361775e-01,5.31502347e-03,-6.55593351e-03},{-2.02199864e+00,-1.22608960e+00,3.69767010e-01,6.72924966e-02,-8.29657167e-03,-1.04679575e-03,2.80969343e-05,6.51023947e-06},{2.01659322e+00,-1.14307189e-02,-3.10895406e-03,5.88734052e-04,8.22350557e-05,-6.92330696e-06,-8.37660934e-07,-1.15939818e-08}},
+  {{-3.25017014e+01,2.19415760e+00,6.79531145e+00,-1.52694181e-01,-2.68677741e-01,9.33487806e-03,1.20597845e-02,-9.47324210e-04},{1.05184853e+00,-1.77787170e+01,1.33599269e+00,3.95155454e+00,-2.43951678e-01,-3.33247542e-01,2.16207802e-02,2.10698582e-02},{-3.14249396e-01,1.81613541e+00,6.32519200e-02,-1.04629107e-01,-2.03418639e-03,1.98800699e-03,3.85430940e-05,-2.71038371e-05},{1.97635412e+00,-1.82650657e-03,4.65430133e-03,1.08609493e-04,-1.33228983e-04,-2.29442730e-06,1.86067678e-06,3.89807333e-08}},
+  {{2.32205715e+01,1.59667196e+01,-4.21654129e+00,-8.46561432e-01,7.80386180e-02,1.78928114e-02,3.15255788e-03,-4.87061654e-04},{-7.02697229e+00,4.33713198e+00,-5.89259958e+00,-5.03673553e-01,8.20791900e-01,6.40446693e-02,-2.86044423e-02,-9.67900269e-03},{2.39241171e+00,-9.04161513e-01,-4.42064315e-01,5.19338548e-02,1.03451675e-02,-9.46614949e-04,-5.15937209e-05,9.69930625e-06},{2.01219130e+00,1.35648791e-02,-2.31658132e-03,-7.09706452e-04,6.57518394e-05,9.00432588e-06,-8.44144324e-07,-4.78404916e-09}},
+  {{7.83440590e+00,-2.11323395e+01,-1.45966458e+00,1.00698304e+00,2.77703200e-02,8.60961212e-04,1.78190786e-03,-7.50398147e-04},{8.74015522e+00,1.29973717e+01,1.51865208e+00,-2.81439018e+00,-3.10844243e-01,1.18385628e-01,7.14915514e-04,4.37775999e-03},{-2.51090884e+00,-7.55329788e-01,4.66189146e-01,4.46137898e-02,-1.11209629e-02,-8.85973917e-04,6.38904894e-05,1.09529037e-05},{2.01016855e+00,-1.42563842e-02,-1.94788014e-03,7.51298736e-04,5.76603779e-05,-9.85819861e-06,-8.29856560e-07,1.49456465e-08}},
+  {{-2.97914772e+01,9.30270767e+00,6.10323572e+00,-6.89114332e-01,-2.00594246e-01,3.83846350e-02,4.27127443e-03,-2.96171755e-03},{-3.27803016e+00,-1.42568474e+01,6.62161207e+00,2.62180662e+00,-9.60816920e-01,-1.62831366e-01,7.37823769e-02,4.68649948e-03},{5.72157145e-01,1.78733897e+00,-1.15076691e-01,-1.02710955e-01,3.69008281e-03,1.93347386e-03,-6.94030459e-05,-2.57464617e-05},{1.97672129e+00,3.32492148e-03,4.57792729e-03,-1.97471789e-04,-1.30513887e-04,4.15327895e-06,1.79754193e-06,-6.98883085e-08}},
+  {{2.98193760e+01,1.05139027e+01,-5.44291925e+00,-5.93414247e-01,1.35913014e-01,2.20754202e-02,-8.57221778e-04,-1.47805922e-03},{-5.25607872e+00,-6.04308069e-01,-5.17835426e+00,1.32474744e+00,7.94524610e-01,-7.78905675e-02,-5.13479076e-02,-1.77262386e-03},{1.83638418e+00,-1.34174824e+00,-3.34562123e-01,7.26561844e-02,7.39222672e-03,-1.07311795e-03,-2.09002028e-05,5.26369558e-06},{2.01818323e+00,1.03701903e-02,-3.39198369e-03,-5.31079597e-04,8.78268474e-05,6.06988488e-06,-8.23690414e-07,1.51793564e-08}},
+  {{-2.99372983e+00,-2.17128849e+01,3.73567045e-01,1.07471323e+00,2.98691653e-02,9.30547656e-04,-1.76978530e-03,-9.79248085e-04},{1.12960472e+01,1.16862612e+01,-3.39409065e+00,-3.06317663e+00,8.70568007e-02,1.49410665e-01,1.68495644e-02,3.90642183e-03},{-2.74204326e+00,-2.02460170e-01,5.18177390e-01,1.62001178e-02,-1.32498629e-02,-5.73613856e-04,1.14137511e-04,1.36239796e-05},{2.00271869e+00,-1.56480428e-02,-5.65500639e-04,8.46865587e-04,2.49424083e-05,-1.25010911e-05,-6.69230417e-07,6.30152215e-08}},
+  {{-2.39376354e+01,1.53317871e+01,4.66681957e+00,-1.03138936e+00,-9.04741585e-02,3.79024595e-02,-4.43141256e-03,-1.32360088e-03},{-7.12982512e+00,-6.99637604e+00,9.12107372e+00,3.17403376e-01,-1.09934986e+00,7.13834539e-02,5.77527359e-02,-1.27954269e-02},{1.39913058e+00,1.56825233e+00,-2.79501885e-01,-8.83048922e-02,8.75740498e-03,1.53689913e-03,-1.55282978e-04,-1.62803808e-05},{1.97952330e+00,8.11441056e-03,3.99869867e-03,-4.77109425e-04,-1.10311987e-04,9.69241228e-06,1.34655056e-06,-1.51050855e-07}},
+  {{3.34320297e+01,4.03795576e+00,-6.13052320e+00,-2.25550786e-01,1.82445019e-01,1.03922356e-02,-5.72733954e-03,-9.47017630e-04},{-3.50258446e+00,-3.72671819e+00,-2.01653385e+00,2.60712814e+00,3.58905762e-01,-2.22017169e-01,-2.93075386e-02,1.26074161e-02},{1.09261799e+00,-1.64185512e+00,-1.97127506e-01,8.61947238e-02,4.18348238e-03,-1.11968187e-03,-5.98211773e-06,1.98010684e-06},{2.02233076e+00,6.15292788e-03,-4.12217295e-03,-3.10471340e-04,1.01533013e-04,3.28506599e-06,-7.61178455e-07,1.56210636e-08}},
+  {{-1.34388580e+01,-2.01096287e+01,2.29329515e+00,1.11941206e+00,1.30783087e-02,-1.19337020e-02,-5.51413652e-03,-8.56584695e-04},{1.22853737e+01,5.83106947e+00,-7.73426437e+00,-2.25058126e+00,5.84604561e-01,1.90634519e-01,5.44145610e-03,-9.34345182e-03},{-2.69078541e+00,3.77721488e-01,5.17920136e-01,-1.57401245e-02,-1.42007442e-02,-8.18560147e-05,1.65487974e-04,1.15485818e-05},{1.99500906e+00,-1.54373068e-02,9.07016976e-04,8.58787098e-04,-1.40924740e-05,-1.41968667e-05,-2.89809918e-07,1.22015663e-07}},
+  {{-1.54657507e+01,1.96115131e+01,2.80053258e+00,-1.15481329e+00,-6.91073621e-03,1.91207156e-02,-6.05560420e-03,5.73076017e-04},{-9.78687668e+00,1.32810211e+00,8.09810638e+00,-1.77965641e+00,-7.31456220e-01,1.87027708e-01,7.97668379e-03,-1.19372653e-02},{2.08092737e+00,1.18437433e+00,-4.10784185e-01,-6.38578236e-02,1.23464037e-02,9.18646401e-04,-1.95194953e-04,-3.20532467e-06},{1.98446834e+00,1.20265950e-02,2.99149402e-03,-6.94739167e-04,-7.68248283e-05,1.32510322e-05,6.76144793e-07,-1.77200505e-07}},
+  {{3.37638168e+01,-2.81501102e+00,-6.15983725e+00,1.92359298e-01,1.82472348e-01,-1.03518469e-02,-5.90899354e-03,8.55915248e-04},{-1.62434494e+00,-3.57143378e+00,2.17967725e+00,2.67836142e+00,-2.94356614e-01,-2.31285632e-01,2.41601933e-02,1.39021752e-02},{2.37422243e-01,-1.77730787e+00,-4.26426940e-02,9.21291560e-02,8.88377836e-04,-1.13117800e-03,-7.36208790e-07,5.44632201e-07},{2.02421331e+00,1.33526279e-03,-4.44978243e-03,-6.69194051e-05,1.07346743e-04,6.82594646e-07,-7.21271761e-07,3.98765598e-09}},
+  {{-2.23524857e+01,-1.63628674e+01,4.16976023e+00,1.06354082e+00,-5.24313711e-02,-3.25203426e-02,-6.03108900e-03,5.63128677e-04},{1.12410498e+01,-2.83367038e+00,-9.72991562e+00,-3.78504783e-01,1.03423834e+00,1.23251326e-01,-4.42102849e-02,-1.52786709e-02},{-2.36163449e+00,9.25016940e-01,4.62437540e-01,-4.79106046e-02,-1.35033522e-02,5.54228318e-04,1.95643443e-04,3.28812075e-06},{1.98783517e+00,-1.36166848e-02,2.31658877e-03,7.77174020e-04,-5.55487568e-05,-1.41802384e-05,3.03822674e-07,1.68111058e-07}},
+  {{-5.23145247e+00,2.17430840e+01,8.04882348e-01,-1.13863730e+00,2.67927740e-02,3.42125562e-03,-2.80042877e-03,1.03443034e-03},{-1.07356386e+01,7.69627333e+00,4.34200621e+00,-2.89480352e+00,-2.08181232e-01,1.72436312e-01,-1.52161513e-02,6.25372399e-04},{2.54709172e+00,6.79477811e-01,-4.94939148e-01,-3.32284234e-02,1.40548656e-02,2.47060758e-04,-1.85849436e-04,7.85343400e-06},{1.99104166e+00,1.46532711e-02,1.68169721e-03,-8.26813164e-04,-3.63767685e-05,1.44455435e-05,6.66390365e-09,-1.50264526e-07}},
+  {{3.07912941e+01,-9.36286068e+00,-5.53299236e+00,5.58653653e-01,1.34849444e-01,-2.28597783e-02,-1.13018428e-03,1.52512058e-03},{5.17555952e-01,-5.86099587e-02,5.53352451e+00,1.50131559e+00,-7.66599536e-01,-9.45846960e-02,5.23266494e-02,2.07405469e-06},{-6.41924441e-01,-1.73610020e+00,1.15467586e-01,9.03345942e-02,-2.41950108e-03,-1.12824386e-03,2.44714192e-06,9.74816430e-07},{2.02363992e+00,-3.61188571e-03,-4.35023336e-03,1.81413998e-04,1.05601001e-04,-1.87178250e-06,-7.34115076e-07,-1.03005666e-08}},
+  {{-2.88108482e+01,-1.07629576e+01,5.74149418e+00,8.08253765e-01,-1.60784468e-01,-4.21766676e-02,7.18863856e-04,2.72923987e-03},{8.45173836e+00,-1.13711710e+01,-8.27572918e+00,1.98966968e+00,1.07183981e+00,-9.22792479e-02,-7.69980699e-02,-1.11512921e-03},{-1.78804815e+00,1.38015902e+00,3.55112940e-01,-7.62020573e-02,-1.09036658e-02,1.22207566e-03,1.83133176e-04,-9.33757110e-06},{1.98194075e+00,-1.03521692e-02,3.50399432e-03,6.03431778e-04,-9.36068973e-05,-1.18899661e-05,9.99740678e-07,1.72477215e-07}},
+  {{5.64478493e+00,2.16084995e+01,-1.13465250e+00,-1.06984854e+00,3.29535641e-02,3.77817749e-04,1.05213909e-03,8.43848509e-04},{-1.00921049e+01,1.00194273e+01,-4.29839075e-01,-2.86797309e+00,2.46773839e-01,1.35119811e-01,-5.64488769e-03,4.42732451e-03},{2.74983501e+00,1.09369926e-01,-5.24818957e-01,-6.92098576e-04,1.39381690e-02,-3.31497082e-04,-1.42846591e-04,1.32526820e-05},{1.99856114e+00,1.57374274e-02,2.23118303e-04,-8.64444009e-04,4.57740498e-06,1.35774017e-05,-4.94673031e-07,-9.45642498e-08}},
+  {{2.47587166e+01,-1.49675198e+01,-4.37511635e+00,8.05792272e-01,7.40904585e-02,-1.91196334e-02,3.18328827e-03,5.91067248e-04},{3.08250117e+00,5.49970818e+00,6.55721569e+00,-3.00536156e-01,-8.30103934e-01,5.50204255e-02,3.17761227e-02,-1.03534451e-02},{-1.45578408e+00,-1.52188003e+00,2.63685495e-01,8.08454528e-02,-5.68762468e-03,-1.10460410e-03,1.12595089e-05,3.28695182e-06},{2.02066898e+00,-8.20734818e-03,-3.83094838e-03,4.16614057e-04,9.61876140e-05,-4.54913425e-06,-7.90482090e-07,-1.74278831e-08}},
+  {{-3.22119179e+01,-3.88260102e+00,6.67871094e+00,3.31395298e-01,-2.53548592e-01,-2.25948337e-02,1.03304256e-02,2.06997013e-03},{4.60511303e+00,-1.68669662e+01,-3.64343286e+00,3.72650218e+00,4.96974319e-01,-3.04487586e-01,-4.18609791e-02,1.84299070e-02},{-1.02912128e+00,1.69205916e+00,2.06364021e-01,-9.64070633e-02,-6.55113673e-03,1.75716274e-03,1.20161720e-04,-2.14485299e-05},{1.97793818e+00,-5.97504992e-03,4.32565855e-03,3.53305019e-04,-1.21633726e-04,-7.32010812e-06,1.59525587e-06,1.19236191e-07}},
+  {{1.59497290e+01,1.93084774e+01,-2.92346644e+00,-9.73159313e-01,4.63275723e-02,8.45586509e-03,3.47539433e-03,3.45269014e-04},{-8.52503395e+00,8.05997467e+00,-4.34558105e+00,-1.86087632e+00,6.15178406e-01,1.15505673e-01,-6.23218622e-03,-4.55824146e-03},{2.66893196e+00,-4.65381503e-01,-5.00148058e-01,2.99556348e-02,1.23777147e-02,-7.39899988e-04,-8.96340280e-05,1.28028023e-05},{2.00624871e+00,1.51940417e-02,-1.22545986e-03,-8.11991515e-04,4.10331522e-05,1.13483620e-05,-7.67758706e-07,-3.84294943e-08}},
+  {{1.62007637e+01,-1.91035023e+01,-2.86482930e+00,9.40576136e-01,3.58676128e-02,-6.92645833e-03,3.64532322e-03,-3.83213774e-04},{6.11989737e+00,1.07534990e+01,4.75408649e+00,-1.94448423e+00,-5.90487003e-01,1.13192149e-01,1.73274451e-03,-4.63076029e-03},{-2.12094617e+00,-1.15380669e+00,3.88768315e-01,6.38974085e-02,-8.80648941e-03,-1.02767395e-03,3.29479371e-05,7.26456301e-06},{2.01560187e+00,-1.19980937e-02,-2.93161441e-03,6.20146457e-04,7.86486489e-05,-7.42119028e-06,-8.43191685e-07,-8.66739658e-09}},
+  {{-3.22709579e+01,3.48737669e+00,6.73901176e+00,-2.55510300e-01,-2.62936622e-01,1.60315465e-02,1.13283182e-02,-1.56860764e-03},{3.04049432e-01,-1.75118694e+01,2.38371968e+00,3.83557773e+00,-3.98838401e-01,-3.17351133e-01,3.46548669e-02,1.94411222e-02},{-1.63445607e-01,1.82477927e+00,3.29043642e-02,-1.05208024e-01,-1.05911470e-03,2.00468698e-03,2.01129515e-05,-2.75256316e-05},{1.97624397e+00,-9.50023823e-04,4.67725471e-03,5.65097653e-05,-1.34051283e-04,-1.19535741e-06,1.88007868e-06,2.03669135e-08}},
+  {{2.45803890e+01,1.51091022e+01,-4.46528482e+00,-8.11083138e-01,8.73438567e-02,1.95392203e-02,2.71570217e-03,-7.00047938e-04},{-6.72046137e+00,3.42089343e+00,-5.97671556e+00,-1.78068593e-01,8.43683243e-01,4.47860397e-02,-3.43388505e-02,-9.46459919e-03},{2.31358457e+00,-9.86390591e-01,-4.26368356e-01,5.59161194e-02,9.87195689e-03,-9.75974603e-04,-4.51469386e-05,8.93287415e-06},{2.01331234e+00,1.31079778e-02,-2.51961732e-03,-6.83062768e-04,7.00891760e-05,8.50348351e-06,-8.47044134e-07,1.76091142e-10}},
+  {{5.95326710e+00,-2.13917618e+01,-1.14555514e+00,1.01930642e+00,2.78650150e-02,1.75522536e-03,1.23333838e-03,-7.99334492e-04},{9.25304031e+00,1.31306581e+01,6.95236921e-01,-2.92861366e+00,-2.46565893e-01,1.20514147e-01,3.26199178e-03,5.53604588e-03},{-2.56892180e+00,-6.65710509e-01,4.78332907e-01,4.01379578e-02,-1.15419813e-02,-8.44723661e-04,7.16200157e-05,1.16119809e-05},{2.00895405e+00,-1.45978099e-02,-1.72515970e-03,7.72634172e-04,5.26406729e-05,-1.03412658e-05,-8.15483986e-07,2.17241105e-08}},
+  {{-2.89825230e+01,1.04663258e+01,5.89770937e+00,-7.66009271e-01,-1.82136446e-01,4.05033641e-02,2.44864821e-03,-2.87645892e-03},{-3.98799539e+00,-1.31917000e+01,7.30382156e+00,2.25394130e+00,-1.03183627e+00,-1.19856291e-01,7.59469867e-02,9.09920083e-04},{7.19150484e-01,1.76280546e+00,-1.44530654e-01,-1.01083271e-01,4.62267315e-03,1.88763486e-03,-8.63934401e-05,-2.46186464e-05},{1.97703433e+00,4.17818082e-03,4.51292517e-03,-2.47868418e-04,-1.28216197e-04,5.19324840e-06,1.74471438e-06,-8.66715482e-08}},
+  {{3.06892567e+01,9.43071556e+00,-5.60938120e+00,-5.36023974e-01,1.46256506e-01,2.12214645e-02,-1.82434218e-03,-1.53238082e-03},{-4.96656370e+00,-1.35657752e+00,-4.76916170e+00,1.61563432e+00,7.46966898e-01,-1.07533269e-01,-5.13062701e-02,8.79407278e-04},{1.72111368e+00,-1.40309596e+00,-3.12938780e-01,7.54660293e-02,6.85816631e-03,-1.08500104e-03,-1.73928565e-05,4.58985642e-06},{2.01902843e+00,9.71372798e-03,-3.54171684e-03,-4.95961751e-04,9.07183494e-05,5.58207012e-06,-8.13787892e-07,1.64510805e-08}},
+  {{-4.89845943e+00,-2.15927601e+01,7.08022773e-01,1.08554447e+00,2.93268729e-02,-3.81100574e-04,-2.46937433e-03,-1.00356492e-03},{1.16046944e+01,1.09766541e+01,-4.25342321e+00,-3.00265026e+00,1.67775393e-01,1.58640325e-01,1.80880465e-02,2.10776622e-03},{-2.75302291e+00,-1.04217485e-01,5.21879613e-01,1.09442361e-02,-1.35061657e-02,-5.02576702e-04,1.23294405e-04,1.36726658e-05},{2.00140548e+00,-1.57248639e-02,-3.17713449e-04,8.55023565e-04,1.86736324e-05,-1.28747843e-05,-6.21059030e-07,7.27599669e-08}},
+  {{-2.26175499e+01,1.62310123e+01,4.36061525e+00,-1.06783581e+00,-7.24672154e-02,3.52662355e-02,-5.27417334e-03,-9.07675363e-04},{-7.68490553e+00,-5.52670860e+00,9.19055939e+00,-9.69078392e-02,-1.06269014e+00,1.03327692e-01,4.95221317e-02,-1.41675463e-02},{1.52706170e+00,1.51341355e+00,-3.04541558e-01,-8.47525895e-02,9.48624779e-03,1.44283788e-03,-1.65633872e-04,-1.41517303e-05},{1.98022699e+00,8.85195751e-03,3.85423377e-03,-5.19166817e-04,-1.05384781e-04,1.04541405e-05,1.24188307e-06,-1.59649602e-07}},
+  {{3.37369576e+01,2.83663344e+00,-6.18656874e+00,-1.52458221e-01,1.86532274e-01,6.91700075e-03,-6.22051209e-03,-6.60389196e-04},{-3.20549822e+00,-3.96745396e+00,-1.29640210e+00,2.72031474e+00,2.48838633e-01,-2.36317307e-01,-2.07257662e-02,1.42102754e-02},{9.52770829e-01,-1.67670572e+00,-1.71701357e-01,8.77303630e-02,3.62674659e-03,-1.12307351e-03,-4.62458502e-06,1.60408661e-06},{2.02281451e+00,5.36365388e-03,-4.20656241e-03,-2.70177523e-04,1.03047110e-04,2.83229110e-06,-7.51436858e-07,1.42456749e-08}},
+  {{-1.51550407e+01,-1.96014099e+01,2.63323712e+00,1.11981237e+00,5.60199469e-03,-1.53442184e-02,-5.98739181e-03,-7.27069215e-04},{1.22557602e+01,4.45078945e+00,-8.30240154e+00,-1.99198782e+00,6.76077783e-01,1.90063566e-01,-1.39260245e-03,-1.15800649e-02},{-2.65345621e+00,4.74584490e-01,5.12295246e-01,-2.12900452e-02,-1.42067801e-02,1.81932646e-05,1.72736545e-04,1.05744903e-05},{1.99373245e+00,-1.52366152e-02,1.15505746e-03,8.51497403e-04,-2.10997860e-05,-1.43321049e-05,-2.02323392e-07,1.31537490e-07}},
+  {{-1.37606459e+01,2.01532917e+01,2.45155787e+00,-1.15943861e+00,2.39710603e-03,1.56710148e-02,-5.68794273e-03,7.47920887e-04},{-1.00686855e+01,2.66020513e+00,7.59232569e+00,-2.05867863e+00,-6.41049206e-01,1.91376612e-01,8.23738694e-04,-9.99222044e-03},{2.17655230e+00,1.10555184e+00,-4.28608149e-01,-5.89643046e-02,1.27704768e-02,8.03576550e-04,-1.96797992e-04,-1.04596154e-06},{1.98548925e+00,1.25702471e-02,2.78591528e-03,-7.23498117e-04,-7.02487887e-05,1.36169519e-05,5.56591715e-07,-1.75843581e-07}},
+  {{3.34783592e+01,-4.01371813e+00,-6.09524298e+00,2.63866544e-01,1.76887289e-01,-1.36373769e-02,-5.30749466e-03,1.11696613e-03},{-1.29318595e+00,-3.17929459e+00,2.88916826e+00,2.55101228e+00,-4.01907504e-01,-2.15235233e-01,3.25219966e-02,1.21911960e-02},{8.72934163e-02,-1.78255856e+00,-1.56726297e-02,9.23553705e-02,3.26210982e-04,-1.13141746e-03,-2.62717577e-07,4.89940135e-07},{2.02428627e+00,4.90858685e-04,-4.46243817e-03,-2.45894389e-05,1.07563697e-04,2.50386165e-07,-7.19437196e-07,1.47473855e-09}},
+  {{-2.36946907e+01,-1.54969807e+01,4.47844744e+00,1.03514612e+00,-6.94119558e-02,-3.57041247e-02,-5.40815154e-03,9.65899439e-04},{1.08712950e+01,-4.42370033e+00,-9.74015522e+00,2.86565870e-02,1.08141947e+00,9.41430330e-02,-5.32865338e-02,-1.41894687e-02},{-2.27973652e+00,1.01018262e+00,4.47588623e-01,-5.30993193e-02,-1.31951338e-02,6.69447239e-04,1.96930909e-04,1.34714287e-06},{1.98672736e+00,-1.31546566e-02,2.53774575e-03,7.53782515e-04,-6.24227687e-05,-1.39574922e-05,4.19510400e-07,1.72456282e-07}},
+  {{-3.32389736e+00,2.18857422e+01,4.55131143e-01,-1.12893021e+00,2.88486537e-02,1.91618933e-03,-2.08379328e-03,1.02358009e-03},{-1.07145042e+01,8.41973305e+00,3.51875186e+00,-2.97040701e+00,-1.20957814e-01,1.64654911e-01,-1.49543341e-02,2.39143358e-03},{2.60056615e+00,5.85514367e-01,-5.03841400e-01,-2.77191382e-02,1.41536007e-02,1.39146563e-04,-1.80257659e-04,9.21595529e-06},{1.99227393e+00,1.49480877e-02,1.43982924e-03,-8.39741901e-04,-2.92924105e-05,1.44244614e-05,-9.32981692e-08,-1.41967504e-07}},
+  {{2.99374771e+01,-1.04392967e+01,-5.36188078e+00,6.12029910e-01,1.23779163e-01,-2.33385749e-02,-1.65769074e-04,1.43904891e-03},{9.11650240e-01,8.32029700e-01,5.91664457e+00,1.20493066e+00,-8.08533370e-01,-6.45615086e-02,5.18029444e-02,-2.70877755e-03},{-7.87034214e-01,-1.71129239e+00,1.41682848e-01,8.92479867e-02,-2.97886925e-03,-1.12613884e-03,3.34437436e-06,1.23573329e-06},{2.02329516e+00,-4.42936644e-03,-4.29023476e-03,2.22745890e-04,1.04536579e-04,-2.31367812e-06,-7.41405245e-07,-1.22713342e-08}},
+  {{-2.96464710e+01,-9.62082672e+00,5.96166229e+00,7.38780260e-01,-1.80462331e-01,-4.10449319e-02,2.51807040e-03,2.92027160e-03},{7.84877491e+00,-1.26201954e+01,-7.66063166e+00,2.37595773e+00,1.01370502e+00,-1.36313498e-01,-7.61614665e-02,2.69988179e-03},{-1.66998672e+00,1.44418907e+00,3.32323492e-01,-8.02973136e-02,-1.02747800e-02,1.32683339e-03,1.75863766e-04,-1.15894900e-05},{1.98111665e+00,-9.67423897e-03,3.67216510e-03,5.65578579e-04,-9.92340429e-05,-1.12614225e-05,1.11403233e-06,1.67510933e-07}},
+  {{7.53975439e+00,2.13548164e+01,-1.46401489e+00,-1.05550706e+00,3.39271314e-02,1.16235786e-03,1.62694952e-03,7.85251323e-04},{-9.85898876e+00,9.94472599e+00,-1.23126054e+00,-2.75457072e+00,3.17575067e-01,1.31504163e-01,-3.76488292e-03,3.45602841e-03},{2.75573635e+00,1.04257017e-02,-5.24298251e-01,4.73475270e-03,1.37591613e-02,-4.13614907e-04,-1.33870912e-04,1.35398732e-05},{1.99987686e+00,1.57569088e-02,-2.78029765e-05,-8.61455570e-04,1.11881991e-05,1.32708619e-05,-5.56961481e-07,-8.43831884e-08}},
+  {{2.34093018e+01,-1.58174725e+01,-4.12811708e+00,8.36530805e-01,6.49631768e-02,-1.72092281e-02,3.55898170e-03,3.81438032e-04},{3.56679010e+00,6.53163099e+00,6.44403648e+00,-6.21434093e-01,-8.03222179e-01,7.26874396e-02,2.55030729e-02,-1.04923137e-02},{-1.58106625e+00,-1.46921480e+00,2.86867261e-01,7.84689412e-02,-6.23162743e-03,-1.09639228e-03,1.38716641e-05,3.86255488e-06},{2.01994109e+00,-8.91799666e-03,-3.70280119e-03,4.53864224e-04,9.37810109e-05,-5.02343937e-06,-8.01403075e-07,-1.72569177e-08}},
+  {{-3.24675865e+01,-2.59212422e+00,6.75635529e+00,2.30918020e-01,-2.62477666e-01,-1.63296200e-02,1.13893747e-02,1.52175629e-03},{3.88826180e+00,-1.73520527e+01,-2.61849952e+00,3.87967253e+00,3.47013831e-01,-3.24735910e-01,-2.93671302e-02,2.03993712e-02},{-8.87103915e-01,1.72763455e+00,1.78080440e-01,-9.87561718e-02,-5.67451306e-03,1.82251481e-03,1.05077008e-04,-2.30296409e-05},{1.97748351e+00,-5.15214493e-03,4.41980781e-03,3.05141264e-04,-1.24937666e-04,-6.35778952e-06,1.66996597e-06,1.04844787e-07}},
+  {{1.76220188e+01,1.86939392e+01,-3.21767020e+00,-9.50989366e-01,5.14531061e-02,1.05323121e-02,3.62536963e-03,1.99811722e-04},{-8.21677303e+00,7.35473585e+00,-4.82615423e+00,-1.60073686e+00,6.69875801e-01,1.09149262e-01,-9.72556043e-03,-6.29299833e-03},{2.62679362e+00,-5.59064746e-01,-4.90778536e-01,3.47480476e-02,1.20034097e-02,-7.91080820e-04,-8.10887141e-05,1.22957599e-05},{2.00751209e+00,1.49412639e-02,-1.45947549e-03,-7.94888590e-04,4.65280755e-05,1.08888453e-05,-7.92754520e-07,-3.03640633e-08}},
+  {{1.44834900e+01,-1.96481533e+01,-2.57247591e+00,9.56587195e-01,3.24863680e-02,-4.84916475e-03,3.37050366e-03,-4.90199367e-04},{6.66943884e+00,1.14565029e+01,4.17316055e+00,-2.17491984e+00,-5.33574522e-01,1.15230717e-01,-6.71162095e-04,-2.54002470e-03},{-2.21354532e+00,-1.07805634e+00,4.06734526e-01,6.03051148e-02,-9.30554233e-03,-1.00549066e-03,3.83052356e-05,8.03240255e-06},{2.01456475e+00,-1.25306817e-02,-2.74539692e-03,6.50075730e-04,7.48168313e-05,-7.92099036e-06,-8.46412092e-07,-5.10196996e-09}},
+  {{-3.19263420e+01,4.77190113e+00,6.65195274e+00,-3.56068939e-01,-2.54077852e-01,2.22418513e-02,1.02405399e-02,-2.10105302e-03},{-4.43098664e-01,-1.70826626e+01,3.39416575e+00,3.66259217e+00,-5.44628143e-01,-2.94154495e-01,4.64368239e-02,1.71168428e-02},{-1.22016110e-02,1.82775140e+00,2.45156186e-03,-1.05408534e-01,-7.88265315e-05,2.01056269e-03,1.49754362e-06,-2.76770406e-05},{1.97620606e+00,-7.08415610e-05,4.68516070e-03,4.20720835e-06,-1.34337301e-04,-8.89395793e-08,1.88694310e-06,1.51671464e-09}},
+  {{2.58576870e+01,1.41975451e+01,-4.70127535e+00,-7.71430254e-01,9.73252207e-02,2.08669920e-02,2.14006170e-03,-9.10279225e-04},{-6.42018175e+00,2.50231361e+00,-5.96454668e+00,1.52022645e-01,8.55610073e-01,2.24543307e-02,-3.96979935e-02,-8.68725777e-03},{2.22789025e+00,-1.06555653e+00,-4.09529299e-01,5.97103834e-02,9.38466657e-03,-1.00165512e-03,-3.92107431e-05,8.15668682e-06},{2.01439357e+00,1.26132360e-02,-2.71466537e-03,-6.54749048e-04,7.41797703e-05,8.00134512e-06,-8.46718478e-07,4.47135218e-09}},
+  {{4.04669476e+00,-2.15794106e+01,-8.26166868e-01,1.03109801e+00,2.82988735e-02,2.29592482e-03,6.43440697e-04,-8.43102811e-04},{9.74482727e+00,1.31121464e+01,-1.58916593e-01,-3.01278543e+00,-1.80204377e-01,1.23929270e-01,6.33178605e-03,6.19677640e-03},{-2.61924195e+00,-5.73982358e-01,4.89137232e-01,3.55043523e-02,-1.19408313e-02,-7.98808527e-04,7.97474786e-05,1.22054907e-05},{2.00771379e+00,-1.48963211e-02,-1.49664597e-03,7.91932631e-04,4.73888831e-05,-1.08136028e-05,-7.96228676e-07,2.91236670e-08}},
+  {{-2.80661182e+01,1.15904331e+01,5.66775894e+00,-8.35877895e-01,-1.62688285e-01,4.15794142e-02,6.78650336e-04,-2.67215073e-03},{-4.67961836e+00,-1.20170832e+01,7.88337946e+00,1.86051321e+00,-1.08200216e+00,-7.61183277e-02,7.57050961e-02,-2.73379660e-03},{8.63920987e-01,1.73282480e+00,-1.73464581e-01,-9.90993604e-02,5.53067680e-03,1.83212780e-03,-1.02556638e-04,-2.32644925e-05},{1.97741711e+00,5.01790363e-03,4.43354063e-03,-2.97275663e-04,-1.25421066e-04,6.19916273e-06,1.68099155e-06,-1.02411846e-07}},
+  {{3.14537640e+01,8.31354904e+00,-5.75607920e+00,-4.74600047e-01,1.55952379e-01,1.97887681e-02,-2.79336912e-03,-1.52356445e-03},{-4.67972612e+00,-2.03226089e+00,-4.28203154e+00,1.88319719e+00,6.85206652e-01,-1.36458233e-01,-4.95271198e-02,3.64549714e-03},{1.60077000e+00,-1.46026373e+00,-2.90518254e-01,7.80638829e-02,6.31834660e-03,-1.09489216e-03,-1.43291290e-05,3.95944971e-06},{2.01981735e+00,9.02973861e-03,-3.68102174e-03,-4.59741976e-04,9.33691626e-05,5.09994152e-06,-8.03124408e-07,1.71826677e-08}},
+  {{-6.78407621e+00,-2.13958664e+01,1.04487133e+00,1.09519982e+00,2.79705543e-02,-2.12477800e-03,-3.17017664e-03,-1.01495010e-03},{1.18610420e+01,1.01186771e+01,-5.08336592e+00,-2.90586090e+00,2.52018809e-01,1.67871341e-01,1.80864055e-02,-7.52489577e-05},{-2.75574946e+00,-5.49850380e-03,5.24035811e-01,5.59983635e-03,-1.37257911e-02,-4.26247920e-04,1.32401343e-04,1.35680493e-05},{2.00008917e+00,-1.57546848e-02,-6.80786325e-05,8.60682048e-04,1.22343072e-05,-1.32174091e-05,-5.66237190e-07,8.27547382e-08}},
+  {{-2.12108192e+01,1.70664253e+01,4.04130602e+00,-1.09708321e+00,-5.56959137e-02,3.21599096e-02,-5.85403387e-03,-5.12234401e-04},{-8.19847298e+00,-4.04242659e+00,9.14240646e+00,-4.97097552e-01,-1.01075351e+00,1.30384803e-01,4.05487679e-02,-1.48394415e-02},{1.65034103e+00,1.45398366e+00,-3.28522265e-01,-8.09260085e-02,1.01681808e-02,1.34312804e-03,-1.74539993e-04,-1.19467304e-05},{1.98099053e+00,9.56141949e-03,3.69789824e-03,-5.59246866e-04,-1.00100689e-04,1.11532790e-05,1.13194108e-06,-1.66531052e-07}},
+  {{3.39263496e+01,1.62665141e+00,-6.21877241e+00,-7.81879947e-02,1.88815758e-01,3.21330270e-03,-6.51892181e-03,-3.38425045e-04},{-2.90498328e+00,-4.08933783e+00,-5.51580071e-01,2.78934073e+00,1.33296207e-01,-2.45254606e-01,-1.13093173e-02,1.52505068e-02},{8.10148120e-01,-1.70667160e+00,-1.45855993e-01,8.90447944e-02,3.06835119e-03,-1.12568040e-03,-3.50866071e-06,1.28376223e-06},{2.02323079e+00,4.55947453e-03,-4.27905656e-03,-2.29327445e-04,1.04336294e-04,2.38478628e-06,-7.42666600e-07,1.25640804e-08}},
+  {{-1.68100815e+01,-1.90202789e+01,2.96964526e+00,1.11614454e+00,-3.59353027e-03,-1.89585146e-02,-6.32972224e-03,-5.47369593e-04},{1.21622400e+01,2.99023223e+00,-8.78314304e+00,-1.69893670e+00,7.64536321e-01,1.85064480e-01,-9.43613984e-03,-1.34220785e-02},{-2.60816646e+00,5.70163250e-01,5.05066633e-01,-2.68274918e-02,-1.41627826e-02,1.22152604e-04,1.79246083e-04,9.41573217e-06},{1.99247575e+00,-1.49896191e-02,1.40042149e-03,8.41464032e-04,-2.81536941e-05,-1.44137393e-05,-1.08742448e-07,1.40545396e-07}},
+  {{-1.20036955e+01,2.06183491e+01,2.09993291e+00,-1.15991628e+00,1.00522516e-02,1.24520557e-02,-5.19421138e-03,8.73759913e-04},{-1.02954912e+01,3.90757418e+00,7.00415134e+00,-2.30180931e+00,-5.47916651e-01,1.91781938e-01,-5.08683128e-03,-7.76124699e-03},{2.26558638e+00,1.02349699e+00,-4.45001245e-01,-5.39148189e-02,1.31385038e-02,6.87921245e-04,-1.96981491e-04,1.02398110e-06},{1.98655415e+00,1.30746877e-02,2.57234438e-03,-7.49672065e-04,-6.35083125e-05,1.39132753e-05,4.38302322e-07,-1.72996906e-07}},
+  {{3.30800591e+01,-5.19485140e+00,-6.00813103e+00,3.32772732e-01,1.69755727e-01,-1.65209603e-02,-4.55466146e-03,1.32111448e-03},{-9.52891588e-01,-2.67484593e+00,3.55893087e+00,2.38315725e+00,-5.00755191e-01,-1.94576129e-01,3.96428220e-02,1.00100106e-02},{-6.30412623e-02,-1.78266346e+00,1.13271168e-02,9.23582539e-02,-2.35953688e-04,-1.13132840e-03,1.92668466e-07,4.88502849e-07},{2.02428770e+00,-3.54637741e-04,-4.46267147e-03,1.77776983e-05,1.07564250e-04,-1.81215768e-07,-7.19254047e-07,-1.06434928e-09}},
+  {{-2.49449444e+01,-1.45730209e+01,4.77364683e+00,9.99671400e-01,-8.76031667e-02,-3.83871235e-02,-4.52412199e-03,1.38573477e-03},{1.04510145e+01,-5.99214077e+00,-9.63270950e+00,4.47390735e-01,1.11259258e+00,6.02231920e-02,-6.13631755e-02,-1.23966541e-02},{-2.19100142e+00,1.09236670e+00,4.31269854e-01,-5.81529923e-02,-1.28309205e-02,7.84901262e-04,1.96873676e-04,-7.06926414e-07},{1.98566043e+00,-1.26520740e-02,2.75161839e-03,7.27753737e-04,-6.91653113e-05,-1.36663366e-05,5.37443611e-07,1.75434948e-07}},
+  {{-1.40781486e+00,2.19507294e+01,1.08982556e-01,-1.11781287e+00,3.02180108e-02,8.51455086e-04,-1.37265248e-03,9.99207143e-04},{-1.06475334e+01,8.99942875e+00,2.67434573e+00,-3.00873971e+00,-3.68255265e-02,1.56944335e-01,-1.37261832e-02,3.73194925e-03},{2.64620328e+00,4.89988178e-01,-5.11145353e-01,-2.21785847e-02,1.42003940e-02,3.46862216e-05,-1.73796172e-04,1.03975099e-05},{1.99352944e+00,1.51971513e-02,1.19454064e-03,-8.49911361e-04,-2.22286126e-05,1.43461502e-05,-1.87568872e-07,-1.32994558e-07}},
+  {{2.89856567e+01,-1.14757261e+01,-5.17428780e+00,6.60819232e-01,1.12558983e-01,-2.32570618e-02,7.37752882e-04,1.30447571e-03},{1.32150781e+00,1.78219032e+00,6.21525812e+00,8.92858446e-01,-8.36109698e-01,-3.51552851e-02,4.96340506e-02,-5.15631633e-03},{-9.29760277e-01,-1.68153083e+00,1.67537898e-01,8.79399180e-02,-3.53676616e-03,-1.12338015e-03,4.44449415e-06,1.55105170e-06},{2.02288151e+00,-5.23404544e-03,-4.21820488e-03,2.63599213e-04,1.03250240e-04,-2.75999196e-06,-7.49872243e-07,-1.39840717e-08}},
+  {{-3.03744335e+01,-8.44518566e+00,6.15781736e+00,6.62522197e-01,-1.99104607e-01,-3.88755165e-02,4.35575424e-03,2.98956363e-03},{7.21812296e+00,-1.37561731e+01,-6.94746447e+00,2.73417401e+00,9.35116649e-01,-1.78958714e-01,-7.28732049e-02,6.54533133e-03},{-1.54693019e+00,1.50381613e+00,3.08403522e-01,-8.41364115e-02,-9.59656294e-03,1.42682728e-03,1.67110251e-04,-1.37975048e-05},{1.98035038e+00,-8.96620471e-03,3.82901891e-03,5.25622978e-04,-1.04535102e-04,-1.05676399e-05,1.22424103e-06,1.60808256e-07}},
+  {{9.40072346e+00,2.10315514e+01,-1.78651941e+00,-1.04019499e+00,3.53389010e-02,2.27452302e-03,2.14637839e-03,7.17036717e-04},{-9.60475254e+00,9.73373795e+00,-1.99341035e+00,-2.61082244e+00,3.85873914e-01,1.28488719e-01,-2.55407300e-03,2.09097867e-03},{2.75337315e+00,-8.83150473e-02,-5.22208989e-01,1.00867795e-02,1.35408584e-02,-4.90469218e-04,-1.24733764e-04,1.36605313e-05},{2.00119305e+00,1.57291479e-02,-2.77559273e-04,-8.55904364e-04,1.76433259e-05,1.29291911e-05,-6.12451345e-07,-7.43437170e-08}},
+  {{2.19873867e+01,-1.66121178e+01,-3.87200618e+00,8.63517344e-01,5.68040945e-02,-1.51058389e-02,3.79644521e-03,1.83627330e-04},{4.06843996e+00,7.54046249e+00,6.23852682e+00,-9.32427526e-01,-7.67793417e-01,8.68809447e-02,1.92693863e-02,-1.00598242e-02},{-1.70160913e+00,-1.41223395e+00,3.09309036e-01,7.58790076e-02,-6.77063316e-03,-1.08644878e-03,1.68930746e-05,4.48488981e-06},{2.01915455e+00,-9.60297417e-03,-3.56394751e-03,4.90097853e-04,9.11376919e-05,-5.50360710e-06,-8.11942300e-07,-1.65826073e-08}},
+  {{-3.26136284e+01,-1.29744327e+00,6.80441999e+00,1.28378719e-01,-2.68331856e-01,-9.61457845e-03,1.20894797e-02,8.91706091e-04},{3.16069269e+00,-1.76765614e+01,-1.56248426e+00,3.97582960e+00,1.89569429e-01,-3.37474138e-01,-1.58768166e-02,2.16288604e-02},{-7.42459059e-01,1.75786054e+00,1.49181843e-01,-1.00759245e-01,-4.76880139e-03,1.87874935e-03,8.90149240e-05,-2.44064886e-05},{1.97709751e+00,-4.31323610e-03,4.49986896e-03,2.55807594e-04,-1.27762178e-04,-5.35526897e-06,1.73456579e-06,8.92299354e-08}},
+  {{1.92270565e+01,1.80238361e+01,-3.50178576e+00,-9.26492751e-01,5.75134121e-02,1.26359453e-02,3.66171380e-03,3.48350259e-05},{-7.90773201e+00,6.57744169e+00,-5.22642708e+00,-1.32110167e+00,7.19679713e-01,1.00546986e-01,-1.41265877e-02,-7.75914825e-03},{2.57681990e+00,-6.50878966e-01,-4.80027765e-01,3.93907577e-02,1.16046378e-02,-8.37342814e-04,-7.28924788e-05,1.17055079e-05},{2.00875306e+00,1.46446247e-02,-1.68825628e-03,-7.75662367e-04,5.17954832e-05,1.04155779e-05,-8.12430812e-07,-2.28874413e-08}},
+  {{1.27269812e+01,-2.01299667e+01,-2.27619576e+00,9.71091628e-01,3.00919786e-02,-2.96151359e-03,3.01986095e-03,-5.78366569e-04},{7.22187805e+00,1.20553398e+01,3.52610803e+00,-2.38217163e+00,-4.74711567e-01,1.16156429e-01,-1.84382708e-03,-4.22343321e-04},{-2.29951930e+00,-9.99045968e-01,4.23609257e-01,5.65205850e-02,-9.79213044e-03,-9.79954144e-04,4.41712182e-05,8.80303196e-06},{2.01348519e+00,-1.30268652e-02,-2.55075982e-03,6.78425888e-04,7.07395011e-05,-8.42118152e-06,-8.46884689e-07,-8.83313866e-10}},
+  {{-3.14803772e+01,6.03257465e+00,6.53781366e+00,-4.52547342e-01,-2.42556155e-01,2.77494695e-02,8.87012295e-03,-2.51514837e-03},{-1.18802500e+00,-1.65025024e+01,4.35474873e+00,3.43842721e+00,-6.78351104e-01,-2.64709771e-01,5.65869659e-02,1.42235942e-02},{1.39025748e-01,1.82504380e+00,-2.79985983e-02,-1.05229735e-01,9.01467225e-04,2.00558198e-03,-1.71232077e-05,-2.75558778e-05},{1.97624052e+00,8.08249752e-04,4.67799371e-03,-4.80916497e-05,-1.34085421e-04,1.01753290e-06,1.88119452e-06,-1.73399677e-08}},
+  {{2.70476875e+01,1.32482395e+01,-4.92286205e+00,-7.28233337e-01,1.07704036e-01,2.18126774e-02,1.44635781e-03,-1.10599410e-03},{-6.12428522e+00,1.59589446e+00,-5.86230421e+00,4.81875867e-01,8.56073558e-01,-2.51508388e-03,-4.43759859e-02,-7.38309743e-03},{2.13559008e+00,-1.14144349e+00,-3.91602427e-01,6.33111373e-02,8.88504554e-03,-1.02395215e-03,-3.37901802e-05,7.38308927e-06},{2.01543212e+00,1.20822005e-02,-2.90124328e-03,-6.24862150e-04,7.80230330e-05,7.49970332e-06,-8.43613350e-07,8.11063572e-09}},
+  {{2.13732481e+00,-2.17025166e+01,-5.04962683e-01,1.04278457e+00,2.88980044e-02,2.46778829e-03,2.44095245e-05,-8.83725006e-04},{1.02094126e+01,1.29470310e+01,-1.03173697e+00,-3.06808567e+00,-1.11620724e-01,1.28855437e-01,9.60448850e-03,6.32110005e-03},{-2.66171718e+00,-4.80406940e-01,4.98558998e-01,3.07225026e-02,-1.23151941e-02,-7.48022925e-04,8.82210588e-05,1.27175817e-05},{2.00645137e+00,-1.51509214e-02,-1.26295479e-03,8.09106394e-04,4.19115349e-05,-1.12722109e-05,-7.71695341e-07,3.71099915e-08}},
+  {{-2.70641842e+01,1.26686878e+01,5.41982412e+00,-8.98453712e-01,-1.42932996e-01,4.16980200e-02,-9.61887476e-04,-2.37761391e-03},{-5.35035229e+00,-1.07529306e+01,8.36071873e+00,1.45059192e+00,-1.11228418e+00,-3.30192223e-02,7.32837990e-02,-6.09385734e-03},{1.00603259e+00,1.69750106e+00,-2.01778308e-01,-9.67694819e-02,6.40956219e-03,1.76747318e-03,-1.17749027e-04,-2.17040197e-05},{1.97786856e+00,5.84144890e-03,4.34008194e-03,-3.45505454e-04,-1.22146332e-04,7.16491422e-06,1.60711784e-06,-1.16936292e-07}},
+  {{3.21230431e+01,7.17810345e+00,-5.88449335e+00,-4.10342276e-01,1.64789870e-01,1.78428516e-02,-3.72120901e-03,-1.45089114e-03},{-4.39296770e+00,-2.62931466e+00,-3.73086262e+00,2.12485600e+00,6.10921621e-01,-1.63813472e-01,-4.60836925e-02,6.38860697e-03},{1.47571445e+00,-1.51310241e+00,-2.67363340e-01,8.04474279e-02,5.77372080e-03,-1.10304286e-03,-1.16796537e-05,3.37690108e-06},{2.02054739e+00,8.32023751e-03,-3.80958314e-03,-4.22515237e-04,9.57818775e-05,4.62387288e-06,-7.92057676e-07,1.74086914e-08}},
+  {{-8.63827705e+00,-2.11364002e+01,1.38215053e+00,1.10391498e+00,2.56617833e-02,-4.26412001e-03,-3.85792041e-03,-1.00955705e-03},{1.20626297e+01,9.13255024e+00,-5.87607861e+00,-2.77560949e+00,3.39442581e-01,1.76520079e-01,1.67101864e-02,-2.51618167e-03},{-2.75021315e+00,9.34019387e-02,5.24624646e-01,1.81966432e-04,-1.39062367e-02,-3.44700908e-04,1.41351862e-04,1.32990554e-05},{1.99877357e+00,-1.57372802e-02,1.82664910e-04,8.63780675e-04,5.64101629e-06,-1.35250684e-05,-5.04657010e-07,9.28939556e-08}},
+  {{-1.97407532e+01,1.78427944e+01,3.71477795e+00,-1.12025571e+00,-4.04088013e-02,2.87748277e-02,-6.19196938e-03,-1.54089706e-04},{-8.66899109e+00,-2.55998087e+00,8.98981380e+00,-8.78718138e-01,-9.46966767e-01,1.52478233e-01,3.13077718e-02,-1.48490425e-02},{1.76859927e+00,1.39016318e+00,-3.51367682e-01,-7.68435299e-02,1.08006597e-02,1.23861793e-03,-1.81959360e-04,-9.69531175e-06},{1.98181176e+00,1.02406302e-02,3.53027321e-03,-5.97216946e-04,-9.44904750e-05,1.17870659e-05,1.01786759e-06,-1.71672653e-07}},
+  {{3.40208969e+01,4.17271376e-01,-6.23148298e+00,-3.77367879e-03,1.89441055e-01,-5.81074099e-04,-6.62267627e-03,-3.82999275e-07},{-2.59983063e+00,-4.10442305e+00,2.04655439e-01,2.81728125e+00,1.51137188e-02,-2.48905122e-01,-1.45736279e-03,1.57082938e-02},{6.65174186e-01,-1.73167717e+00,-1.19657181e-01,9.01373327e-02,2.50868802e-03,-1.12763431e-03,-2.59612602e-06,1.01890168e-06},{2.02357841e+00,3.74268461e-03,-4.33950173e-03,-1.88010745e-04,1.05402869e-04,1.94195445e-06,-7.35061690e-07,1.06217382e-08}},
+  {{-1.84062958e+01,-1.83822784e+01,3.30240130e+00,1.10866046e+00,-1.44602228e-02,-2.26861220e-02,-6.52136374e-03,-3.16650025e-04},{1.20081577e+01,1.47337830e+00,-9.17755032e+00,-1.37642217e+00,8.48646820e-01,1.75407499e-01,-1.83778256e-02,-1.47766676e-02},{-2.55505157e+00,6.64159477e-01,4.96243030e-01,-3.23326811e-02,-1.40670538e-02,2.29548459e-04,1.84896940e-04,8.07677134e-06},{1.99124265e+00,-1.46969464e-02,1.64231600e-03,8.28677730e-04,-3.52270763e-05,-1.44384121e-05,-9.48575885e-09,1.48886940e-07}},
+  {{-1.02110481e+01,2.10199432e+01,1.74860549e+00,-1.15764761e+00,1.62346363e-02,9.53019410e-03,-4.61510150e-03,9.59028199e-04},{-1.04690990e+01,5.06696987e+00,6.35053062e+00,-2.51114893e+00,-4.54289526e-01,1.89216346e-01,-9.66678374e-03,-5.39491093e-03},{2.34776568e+00,9.38477695e-01,-4.59920615e-01,-4.87309247e-02,1.34503450e-02,5.72486955e-04,-1.95810469e-04,2.98192458e-06},{1.98765969e+00,1.35384686e-02,2.35152990e-03,-7.73201871e-04,-5.66368435e-05,1.41409600e-05,3.22237582e-07,-1.68773411e-07}},
+  {{3.25922127e+01,-6.35859442e+00,-5.90382385e+00,3.98960263e-01,1.61468938e-01,-1.89652257e-02,-3.69526050e-03,1.46455353e-03},{-6.03735209e-01,-2.07793784e+00,4.18408346e+00,2.18211246e+00,-5.89851260e-01,-1.70411766e-01,4.53614667e-02,7.49076158e-03},{-2.13136375e-01,-1.77762377e+00,3.82901095e-02,9.21378657e-02,-7.97915854e-04,-1.13090931e-03,6.67482425e-07,5.40149244e-07},{2.02421761e+00,-1.19884231e-03,-4.45048604e-03,6.00950043e-05,1.07348475e-04,-6.13149780e-07,-7.20722653e-07,-3.58043795e-09}},
+  {{-2.61177711e+01,-1.36031141e+01,5.05728149e+00,9.57653582e-01,-1.06759444e-01,-4.04875949e-02,-3.39690270e-03,1.80403353e-03},{9.98632431e+00,-7.52340746e+00,-9.41800499e+00,8.71542633e-01,1.12743783e+00,2.23680176e-02,-6.81315213e-02,-9.98894684e-03},{-2.09569740e+00,1.17130280e+00,4.13524806e-01,-6.30501956e-02,-1.24108745e-02,8.99789273e-04,1.95406741e-04,-2.85182364e-06},{1.98463762e+00,-1.21104075e-02,2.95746257e-03,6.99148106e-04,-7.57430826e-05,-1.33058402e-05,6.56665350e-07,1.76934620e-07}},
+  {{5.13222277e-01,2.19537315e+01,-2.33901262e-01,-1.10619092e+00,3.11505068e-02,1.97382979e-04,-6.77010277e-04,9.66578431e-04},{-1.05388594e+01,9.44645309e+00,1.82068884e+00,-3.01466203e+00,4.42276411e-02,1.49876416e-01,-1.18314372e-02,4.60345065e-03},{2.68387222e+00,3.93198431e-01,-5.16843379e-01,-1.66266039e-02,1.41969770e-02,-6.58433419e-05,-1.66585742e-04,1.13933929e-05},{1.99480462e+00,1.53998593e-02,9.46626125e-04,-8.57332430e-04,-1.52125467e-05,1.42140016e-05,-2.75728809e-07,-1.23499305e-07}},
+  {{2.79534779e+01,-1.24805717e+01,-4.97410297e+00,7.05836117e-01,1.01459235e-01,-2.26992797e-02,1.55967346e-03,1.13518164e-03},{1.74539709e+00,2.77254272e+00,6.43420887e+00,5.71436226e-01,-8.50965977e-01,-7.19625317e-03,4.61088195e-02,-7.24462513e-03},{-1.06967974e+00,-1.64689362e+00,1.92967251e-01,8.64111930e-02,-4.09279484e-03,-1.11983542e-03,5.78462505e-06,1.92081006e-06},{2.02240086e+00,-6.02363562e-03,-4.13430482e-03,3.03884735e-04,1.01739854e-04,-3.21132211e-06,-7.59322461e-07,-1.53932245e-08}},
+  {{-3.10138817e+01,-7.24016666e+00,6.33337641e+00,5.80163896e-01,-2.16509536e-01,-3.57244611e-02,6.16983045e-03,2.92876689e-03},{6.56467247e+00,-1.47763643e+01,-6.15187168e+00,3.06064248e+00,8.38327110e-01,-2.19113797e-01,-6.72970712e-02,1.02672037e-02},{-1.41925073e+00,1.55884230e+00,2.83429921e-01,-8.77011195e-02,-8.87156557e-03,1.52121263e-03,1.56913666e-04,-1.59318060e-05},{1.97964418e+00,-8.23024847e-03,3.97398043e-03,4.83698561e-04,-1.09479508e-04,-9.81139237e-06,1.32922753e-06,1.52391124e-07}},
+  {{1.12361870e+01,2.06504364e+01,-2.10470772e+00,-1.02423394e+00,3.73379588e-02,3.67300771e-03,2.60987924e-03,6.37492456e-04},{-9.33253384e+00,9.40477943e+00,-2.71210361e+00,-2.44085884e+00,4.52118844e-01,1.25770301e-01,-2.19046231e-03,4.35914961e-04},{2.74276018e+00,-1.86557606e-01,-5.18573523e-01,1.53489532e-02,1.32857962e-02,-5.61987807e-04,-1.15543102e-04,1.36257759e-05},{2.00250578e+00,1.56543981e-02,-5.25412092e-04,-8.47852265e-04,2.39262426e-05,1.25563147e-05,-6.61253580e-07,-6.45520544e-08}},
+  {{2.04995937e+01,-1.73633728e+01,-3.60775900e+00,8.87863576e-01,4.96050678e-02,-1.28887612e-02,3.91110359e-03,1.53051576e-06},{4.58349657e+00,8.51286888e+00,5.95048904e+00,-1.23132360e+00,-7.25996137e-01,9.78730991e-02,1.34058371e-02,-9.12103150e-03},{-1.81705403e+00,-1.35108912e+00,3.30948532e-01,7.30781034e-02,-7.30368681e-03,-1.07452576e-03,2.03518775e-05,5.14965768e-06},{2.01831198e+00,-1.02602793e-02,-3.41470866e-03,5.25220763e-04,8.82551903e-05,-5.98926545e-06,-8.21742731e-07,-1.53706683e-08}},
+  {{-3.26649895e+01,5.52980509e-03,6.82624197e+00,2.41348147e-02,-2.71198809e-01,-2.61197053e-03,1.24177923e-02,2.11548540e-04},{2.42539334e+00,-1.78472538e+01,-4.90092248e-01,4.01654911e+00,2.81461887e-02,-3.42666119e-01,-1.86641642e-03,2.20979322e-02},{-5.95624089e-01,1.78263593e+00,1.19768642e-01,-1.02406204e-01,-3.83853260e-03,1.92534644e-03,7.21182660e-05,-2.55588911e-05},{1.97678137e+00,-3.46097071e-03,4.56554163e-03,2.05492499e-04,-1.30089655e-04,-4.31865419e-06,1.78831215e-06,7.25637364e-08}},
+  {{2.07791824e+01,1.73020248e+01,-3.77902508e+00,-8.99551630e-01,6.45586401e-02,1.47243207e-02,3.58008104e-03,-1.49471947e-04},{-7.59830570e+00,5.74521017e+00,-5.54763603e+00,-1.02527809e+00,7.64104664e-01,8.93788934e-02,-1.92436296e-02,-8.86746868e-03},{2.51916718e+00,-7.40563631e-01,-4.67939705e-01,4.38743271e-02,1.11837434e-02,-8.78896797e-04,-6.50978982e-05,1.10482042e-05},{2.00996804e+00,1.43051455e-02,-1.91118964e-03,-7.54401903e-04,5.68289543e-05,9.93157755e-06,-8.27186568e-07,-1.60336562e-08}},
+  {{1.09265900e+01,-2.05582638e+01,-1.97414851e+00,9.84866202e-01,2.85227597e-02,-1.28593040e-03,2.60487897e-03,-6.52275630e-04},{7.77103758e+00,1.25438814e+01,2.82264376e+00,-2.56652689e+00,-4.14472491e-01,1.16687238e-01,-1.83258532e-03,1.59432949e-03},{-2.37861037e+00,-9.16992962e-01,4.39337909e-01,5.25494441e-02,-1.02645168e-02,-9.50774935e-04,5.05405769e-05,9.56445092e-06},{2.01236629e+00,-1.34851197e-02,-2.34818971e-03,7.05101411e-04,6.64173931e-05,-8.91997843e-06,-8.44165982e-07,3.99683486e-09}},
+  {{-3.09377441e+01,7.27786016e+00,6.39817476e+00,-5.45144677e-01,-2.28667229e-01,3.24827842e-02,7.27565540e-03,-2.79989373e-03},{-1.92765307e+00,-1.57826977e+01,5.25577736e+00,3.16884446e+00,-7.97934592e-01,-2.30103523e-01,6.48480803e-02,1.08943852e-02},{2.89779872e-01,1.81666768e+00,-5.83382696e-02,-1.04672693e-01,1.87655713e-03,1.98979676e-03,-3.55693373e-05,-2.71640529e-05},{1.97634733e+00,1.68446091e-03,4.65578772e-03,-1.00180376e-04,-1.33297464e-04,2.11676934e-06,1.86290833e-06,-3.59732333e-08}},
+  {{2.81618958e+01,1.22569904e+01,-5.13237333e+00,-6.81075335e-01,1.18434116e-01,2.23343205e-02,6.43003033e-04,-1.27901009e-03},{-5.83149862e+00,7.14214444e-01,-5.67390013e+00,8.07674885e-01,8.44425499e-01,-2.96814777e-02,-4.80984822e-02,-5.60185127e-03},{2.03696465e+00,-1.21384633e+00,-3.72644812e-01,6.67135343e-02,8.37470405e-03,-1.04316301e-03,-2.88823467e-05,6.62312686e-06},{2.01642489e+00,1.15165105e-02,-3.07889772e-03,-5.93498931e-04,8.16192114e-05,7.00009241e-06,-8.38168148e-07,1.11089040e-08}},
+  {{2.14310363e-01,-2.17631264e+01,-1.78652614e-01,1.05451512e+00,2.94579174e-02,2.25932919e-03,-6.25800283e-04,-9.22246429e-04},{1.06403227e+01,1.26352491e+01,-1.91433215e+00,-3.09401059e+00,-4.02449854e-02,1.35318071e-01,1.27577139e-02,5.89099387e-03},{-2.69621897e+00,-3.85253310e-01,5.06558120e-01,2.58028321e-02,-1.26626687e-02,-6.92195259e-04,9.69786634e-05,1.31323804e-05},{2.00517058e+00,-1.53607363e-02,-1.02472573e-03,8.24070768e-04,3.62166757e-05,-1.17138734e-05,-7.41518477e-07,4.56375489e-08}},
+  {{-2.59702568e+01,1.37080860e+01,5.15314245e+00,-9.54257667e-01,-1.23094708e-01,4.09327298e-02,-2.43666023e-03,-2.01517716e-03},{-5.99594021e+00,-9.41341877e+00,8.73163891e+00,1.03060186e+00,-1.12313700e+00,8.34894087e-03,6.88856691e-02,-9.04539414e-03},{1.14505744e+00,1.65695667e+00,-2.29374766e-01,-9.41055417e-02,7.25506339e-03,1.69427018e-03,-1.31841021e-04,-1.99600781e-05},{1.97838712e+00,6.64623687e-03,4.23291000e-03,-3.92376998e-04,-1.18412667e-04,8.08485402e-06,1.52394443e-06,-1.30093611e-07}},
+  {{3.26988640e+01,6.01562357e+00,-5.99485159e+00,-3.42761815e-01,1.72638521e-01,1.53853791e-02,-4.58096992e-03,-1.31208985e-03},{-4.10499334e+00,-3.13809037e+00,-3.12183523e+00,2.33640766e+00,5.24816751e-01,-1.88716039e-01,-4.10101078e-02,8.98236223e-03},{1.34632194e+00,-1.56147480e+00,-2.43537501e-01,8.26147124e-02,5.22512430e-03,-1.10968726e-03,-9.41210783e-06,2.84547514e-06},{2.02121687e+00,7.58730108e-03,-3.92711395e-03,-3.84375599e-04,9.79592660e-05,4.15403656e-06,-7.80921198e-07,1.71662222e-08}},
+  {{-1.04700899e+01,-2.08080425e+01,1.72261286e+00,1.11109638e+00,2.21593548e-02,-6.80570491e-03,-4.52154502e-03,-9.80198383e-04},{1.22054520e+01,8.02383327e+00,-6.62119150e+00,-2.61036325e+00,4.29532528e-01,1.83767423e-01,1.38288662e-02,-5.09293191e-03},{-2.73642921e+00,1.92186192e-01,5.23629189e-01,-5.29340794e-03,-1.40450606e-02,-2.58072658e-04,1.50033244e-04,1.28566162e-05},{1.99746263e+00,-1.56725664e-02,4.33763285e-04,8.64266360e-04,-1.08778443e-06,-1.37938350e-05,-4.36286541e-07,1.03060572e-07}},
+  {{-1.81944008e+01,1.85607967e+01,3.37864089e+00,-1.13778389e+00,-2.66159344e-02,2.52021085e-02,-6.30352786e-03,1.59990348e-04},{-9.09274387e+00,-1.09715056e+00,8.73301983e+00,-1.23718083e+00,-8.72996628e-01,1.69462234e-01,2.21709311e-02,-1.42202675e-02},{1.88148248e+00,1.32216680e+00,-3.73006731e-01,-7.25244507e-02,1.13815460e-02,1.13017485e-03,-1.87869664e-04,-7.42731618e-06},{1.98268807e+00,1.08875325e-02,3.35197710e-03,-6.32956275e-04,-8.85860863e-05,1.23533955e-05,9.00813689e-07,-1.75078981e-07}},
+  {{3.40105476e+01,-7.99183428e-01,-6.22255564e+00,7.10236877e-02,1.88283727e-01,-4.40193294e-03,-6.52023870e-03,3.40579747e-04},{-2.28865504e+00,-4.00472307e+00,9.62789237e-01,2.80148363e+00,-1.03512920e-01,-2.46916026e-01,8.48857872e-03,1.55421887e-02},{5.18280089e-01,-1.75166023e+00,-9.31709260e-02,9.10074636e-02,1.94808980e-03,-1.12904445e-03,-1.84870885e-06,8.09019127e-07},{2.02385640e+00,2.91560683e-03,-4.38777264e-03,-1.46316350e-04,1.06248852e-04,1.50309427e-06,-7.28784357e-07,8.46520987e-09}},
+  {{-1.99439030e+01,-1.76758194e+01,3.63177490e+00,1.09611130e+00,-2.71435175e-02,-2.64461767e-02,-6.52496377e-03,-3.06914299e-05},{1.17932911e+01,-8.75369385e-02,-9.47364998e+00,-1.02538061e+00,9.25775290e-01,1.60504937e-01,-2.79029012e-02,-1.55327534e-02},{-2.49427104e+00,7.56277859e-01,4.85838830e-01,-3.77852693e-02,-1.39181437e-02,3.39840306e-04,1.89573839e-04,6.56527482e-06},{1.99003685e+00,-1.43593745e-02,1.87994877e-03,8.13140068e-04,-4.22913145e-05,-1.44030446e-05,9.49280619e-08,1.56409143e-07}},
+  {{-8.37137985e+00,2.13507710e+01,1.39497316e+00,-1.15266538e+00,2.10827608e-02,6.94425125e-03,-3.96666164e-03,1.00939081e-03},{-1.05893555e+01,6.11853027e+00,5.63610315e+00,-2.68374157e+00,-3.61090988e-01,1.84242278e-01,-1.28336344e-02,-3.02209146e-03},{2.42284751e+00,8.50769877e-01,-4.73329395e-01,-4.34341915e-02,1.37062371e-02,4.58039314e-04,-1.93364074e-04,4.80791459e-06},{1.98880267e+00,1.39602786e-02,2.12423597e-03,-7.94041145e-04,-4.96672837e-05,1.43014995e-05,2.09281453e-07,-1.63300541e-07}},
+  {{3.19965229e+01,-7.50634146e+00,-5.77877235e+00,4.62254137e-01,1.52022600e-01,-2.09071469e-02,-2.75111920e-03,1.54158473e-03},{-2.42954358e-01,-1.38535905e+00,4.75207281e+00,1.94843209e+00,-6.67102218e-01,-1.43314987e-01,4.94344607e-02,4.73506749e-03},{-3.62547338e-01,-1.76745439e+00,6.51499704e-02,9.16943699e-02,-1.35946856e-03,-1.13013643e-03,1.19914523e-06,6.44902570e-07},{2.02407598e+00,-2.03937478e-03,-4.42591216e-03,1.02275437e-04,1.06916035e-04,-1.04634398e-06,-7.23809535e-07,-6.02444805e-09}},
+  {{-2.72018967e+01,-1.25762987e+01,5.32619715e+00,9.07834291e-01,-1.26641691e-01,-4.18381393e-02,-2.02709110e-03,2.19690730e-03},{9.47945786e+00,-8.99854469e+00,-9.08761406e+00,1.29467034e+00,1.12314427e+00,-1.87236201e-02,-7.31492192e-02,-7.02261552e-03},{-1.99411178e+00,1.24673414e+00,3.94403160e-01,-6.77696690e-02,-1.19355442e-02,1.01327826e-03,1.92480627e-04,-5.06297556e-06},{1.98366213e+00,-1.15312608e-02,3.15455534e-03,6.68038789e-04,-8.21225331e-05,-1.28756446e-05,7.76153513e-07,1.76860254e-07}},
+  {{2.44122291e+00,2.18815823e+01,-5.74804127e-01,-1.09357166e+00,3.18427719e-02,-3.42214444e-05,-2.15048158e-06,9.26085806e-04},{-1.03929043e+01,9.74519825e+00,9.67706740e-01,-2.98547506e+00,1.22265764e-01,1.43644854e-01,-9.53902770e-03,4.95171780e-03},{2.71346593e+00,2.95445830e-01,-5.20933211e-01,-1.10823726e-02,1.41452942e-02,-1.62035169e-04,-1.58749477e-04,1.22020683e-05},{1.99609542e+00,1.55557562e-02,6.96877774e-04,-8.62026121e-04,-8.26973701e-06,1.40316279e-05,-3.57458816e-07,-1.13632026e-07}},
+  {{2.68221798e+01,-1.34466352e+01,-4.75799370e+00,7.46660948e-01,9.05868858e-02,-2.16681138e-02,2.27693375e-03,9.38993995e-04},{2.18729734e+00,3.79600978e+00,6.56111050e+00,2.43909061e-01,-8.52533340e-01,1.85821410e-02,4.13800515e-02,-8.86403956e-03},{-1.20637786e+00,-1.60747206e+00,2.17905700e-01,8.46628323e-02,-4.64648707e-03,-1.11535040e-03,7.40141968e-06,2.34469735e-06},{2.02185416e+00,-6.79588737e-03,-4.03872132e-03,3.43512424e-04,1.00003053e-04,-3.66814265e-06,-7.69531425e-07,-1.64545746e-08}},
+  {{-3.15447311e+01,-6.00143909e+00,6.48268652e+00,4.91442323e-01,-2.32084811e-01,-3.15590762e-02,7.87922554e-03,2.72272411e-03},{5.89071465e+00,-1.56591177e+01,-5.27594042e+00,3.34568739e+00,7.23478615e-01,-2.55228907e-01,-5.94242848e-02,1.36929099e-02},{-1.28733444e+00,1.60908389e+00,2.57484406e-01,-9.09742638e-02,-8.10273085e-03,1.60917535e-03,1.45334518e-04,-1.79629878e-05},{1.97900009e+00,-7.46865012e-03,4.10651509e-03,4.39950090e-04,-1.14038201e-04,-8.99610041e-06,1.42787860e-06,1.42308991e-07}},
+  {{1.30353451e+01,2.01975250e+01,-2.41735554e+00,-1.00666535e+00,4.00954150e-02,5.33230463e-03,3.00136185e-03,5.42151276e-04},{-9.04882717e+00,8.95411015e+00,-3.37302494e+00,-2.24269462e+00,5.15687466e-01,1.22725397e-01,-2.85254512e-03,-1.40742993e-03},{2.72393608e+00,-2.84011245e-01,-5.13418496e-01,2.05072034e-02,1.29965395e-02,-6.28159090e-04,-1.06399275e-04,1.34484508e-05},{2.00381088e+00,1.55330524e-02,-7.70640559e-04,-8.37367261e-04,3.00222709e-05,1.21560834e-05,-7.03547471e-07,-5.51020385e-08}},
+  {{1.89354763e+01,-1.80570526e+01,-3.33353758e+00,9.09161150e-01,4.34460826e-02,-1.06104612e-02,3.90042807e-03,-1.60958865e-04},{5.11428213e+00,9.43038082e+00,5.57253313e+00,-1.51396644e+00,-6.78176284e-01,1.05702236e-01,8.20467062e-03,-7.71733327e-03},{-1.92705727e+00,-1.28594387e+00,3.51724416e-01,7.00691193e-02,-7.82971177e-03,-1.06036069e-03,2.42725528e-05,5.85135240e-06},{2.01741552e+00,-1.08879814e-02,-3.25543433e-03,5.59138076e-04,8.51313453e-05,-6.47982552e-06,-8.30425563e-07,-1.35898421e-08}},
+  {{-3.25996590e+01,1.31121778e+00,6.81624699e+00,-8.06896910e-02,-2.70684451e-01,4.46781097e-03,1.23324068e-02,-4.80613904e-04},{1.68426752e+00,-1.78479691e+01,5.84785581e-01,3.99569654e+00,-1.33788466e-01,-3.39569151e-01,1.21843768e-02,2.17399430e-02},{-4.47042912e-01,1.80187786e+00,8.99437070e-02,-1.03688724e-01,-2.88846204e-03,1.96187268e-03,5.45419534e-05,-2.64698465e-05},{1.97653592e+00,-2.59804493e-03,4.61657904e-03,1.54390451e-04,-1.31905457e-04,-3.25444103e-06,1.83058182e-06,5.50369883e-08}},
+  {{2.22572212e+01,1.65197678e+01,-4.04540777e+00,-8.69146228e-01,7.25526288e-02,1.66997537e-02,3.36173736e-03,-3.49816430e-04},{-7.29345369e+00,4.86837196e+00,-5.77606440e+00,-7.14732528e-01,8.00941646e-01,7.51443133e-02,-2.48301607e-02,-9.50917043e-03},{2.45401502e+00,-8.27866375e-01,-4.54561114e-01,4.81902100e-02,1.07429670e-02,-9.15982004e-04,-5.77470273e-05,1.03396933e-05},{2.01115322e+00,1.39239645e-02,-2.12768838e-03,-7.31198874e-04,6.16234975e-05,9.43962550e-06,-8.37442428e-07,-9.82618431e-09}},
+  {{9.08593655e+00,-2.09165554e+01,-1.66652846e+00,9.97509837e-01,2.77172774e-02,1.19598109e-04,2.12993310e-03,-7.13420508e-04},{8.31488228e+00,1.29002457e+01,2.06408715e+00,-2.72368121e+00,-3.52607608e-01,1.17303006e-01,-6.91676163e-04,3.37731862e-03},{-2.45058131e+00,-8.32124889e-01,4.53867704e-01,4.83980402e-02,-1.07208323e-02,-9.17670550e-04,5.73995458e-05,1.03034990e-05},{2.01121140e+00,-1.39040183e-02,-2.13820022e-03,7.30007421e-04,6.18521808e-05,-9.41534017e-06,-8.37811456e-07,9.53976720e-09}},
+  {{-3.02829285e+01,8.49345398e+00,6.23026133e+00,-6.32143557e-01,-2.12618381e-01,3.62589024e-02,5.52636199e-03,-2.93953065e-03},{-2.65866303e+00,-1.49207792e+01,6.07929659e+00,2.85558629e+00,-8.99968624e-01,-1.91169113e-01,7.08604306e-02,7.25839846e-03},{4.39605743e-01,1.80265391e+00,-8.84601921e-02,-1.03740439e-01,2.84128357e-03,1.96336093e-03,-5.36635016e-05,-2.65075359e-05},{1.97652590e+00,2.55501410e-03,4.61863354e-03,-1.51853921e-04,-1.31978755e-04,3.20156687e-06,1.83230884e-06,-5.41573861e-08}},
+  {{2.91759396e+01,1.12244339e+01,-5.32432747e+00,-6.29626513e-01,1.29160374e-01,2.23374683e-02,-2.47371820e-04,-1.41401589e-03},{-5.54399586e+00,-1.24422036e-01,-5.39349937e+00,1.12347639e+00,8.18799436e-01,-5.84268123e-02,-5.05158417e-02,-3.40084126e-03},{1.93231356e+00,-1.28257048e+00,-3.52714956e-01,6.99133649e-02,7.85510987e-03,-1.05958222e-03,-2.44772327e-05,5.88646481e-06},{2.01736903e+00,1.09178927e-02,-3.24720331e-03,-5.60756482e-04,8.49692515e-05,6.50379252e-06,-8.30811757e-07,1.34863551e-08}},
+  {{-1.70502293e+00,-2.17483311e+01,1.50397554e-01,1.06567204e+00,2.97779627e-02,1.63480244e-03,-1.29866228e-03,-9.56563570e-04},{1.10327396e+01,1.21645441e+01,-2.79661369e+00,-3.08637428e+00,3.43721509e-02,1.43082529e-01,1.54448887e-02,4.89665894e-03},{-2.72264194e+00,-2.88797140e-01,5.13097823e-01,2.07567010e-02,-1.29807871e-02,-6.31193747e-04,1.05948013e-04,1.34343109e-05},{2.00387549e+00,-1.55250188e-02,-7.82621617e-04,8.36744905e-04,3.03139586e-05,-1.21351795e-05,-7.05369871e-07,5.46489645e-08}},
+  {{-2.47819786e+01,1.46909552e+01,4.86879015e+00,-1.00220680e+00,-1.03666775e-01,3.93424220e-02,-3.68741876e-03,-1.61130726e-03},{-6.61123228e+00,-8.01149750e+00,8.98529243e+00,6.07228160e-01,-1.11428511e+00,4.68139574e-02,6.27125055e-02,-1.14547014e-02},{1.28057754e+00,1.61133111e+00,-2.56160378e-01,-9.11210328e-02,8.06321669e-03,1.61318807e-03,-1.44718811e-04,-1.80579264e-05},{1.97897124e+00,7.42975669e-03,4.11243550e-03,-4.37717710e-04,-1.14243303e-04,8.95384892e-06,1.43241436e-06,-1.41756502e-07}},
+  {{3.31623726e+01,4.83634710e+00,-6.08263826e+00,-2.72689641e-01,1.79086074e-01,1.24715520e-02,-5.32118510e-03,-1.10921508e-03},{-3.81630445e+00,-3.54302502e+00,-2.46049190e+00,2.51149487e+00,4.27804083e-01,-2.10069656e-01,-3.43904421e-02,1.12835243e-02},{1.21297991e+00,-1.60525620e+00,-2.19104886e-01,8.45641345e-02,4.67328308e-03,-1.11504004e-03,-7.49194123e-06,2.36740834e-06},{2.02182317e+00,6.83306018e-03,-4.03335411e-03,-3.45416251e-04,9.99041440e-05,3.69041459e-06,-7.70022496e-07,1.64944893e-08}},
+  {{-1.22552299e+01,-2.04065514e+01,2.06186843e+00,1.11587787e+00,1.72916315e-02,-9.70715564e-03,-5.13042323e-03,-9.18840407e-04},{1.22868366e+01,6.79739332e+00,-7.30504513e+00,-2.40837622e+00,5.21023393e-01,1.88668758e-01,9.38575435e-03,-7.65932258e-03},{-2.71443796e+00,2.90554643e-01,5.21037459e-01,-1.08094355e-02,-1.41399093e-02,-1.66566519e-04,1.58327981e-04,1.22339752e-05},{1.99616039e+00,-1.55606046e-02,6.84449857e-04,8.62093351e-04,-7.93177514e-06,-1.40197981e-05,-3.61176433e-07,1.13127030e-07}},
+  {{-1.65843430e+01,1.92064705e+01,3.03669810e+00,-1.14961457e+00,-1.45495208e-02,2.15915609e-02,-6.20670570e-03,4.20857803e-04},{-9.46591473e+00,3.26237917e-01,8.37379169e+00,-1.56727302e+00,-7.90764213e-01,1.81302562e-01,1.35269929e-02,-1.30078606e-02},{1.98865354e+00,1.25022173e+00,-3.93373728e-01,-6.79888204e-02,1.19091179e-02,1.01867388e-03,-1.92268039e-04,-5.17198396e-06},{1.98361683e+00,1.15001835e-02,3.16366088e-03,-6.66356238e-04,-8.24203817e-05,1.28508273e-05,7.81920448e-07,-1.76780659e-07}},
+  {{3.38888130e+01,-2.00683665e+00,-6.19070911e+00,1.44677505e-01,1.85305268e-01,-8.08580592e-03,-6.21196954e-03,6.62409409e-04},{-1.97122455e+00,-3.78621650e+00,1.71074164e+00,2.74088621e+00,-2.19800860e-01,-2.39214227e-01,1.81204882e-02,1.47469621e-02},{3.69901955e-01,-1.76657152e+00,-6.64633885e-02,9.16547999e-02,1.38684059e-03,-1.12999743e-03,-1.22825372e-06,6.53512984e-07},{2.02406383e+00,2.08058651e-03,-4.42376966e-03,-1.04332459e-04,1.06875901e-04,1.06741822e-06,-7.23964490e-07,6.14197582e-09}},
+  {{-2.14016819e+01,-1.69075260e+01,3.95243406e+00,1.07795846e+00,-4.14725542e-02,-3.00793890e-02,-6.30981894e-03,3.04678222e-04},{1.15196619e+01,-1.67542410e+00,-9.66341305e+00,-6.49488866e-01,9.93252158e-01,1.40155479e-01,-3.75992619e-02,-1.56137226e-02},{-2.42600751e+00,8.46227050e-01,4.73874271e-01,-4.31644619e-02,-1.37148835e-02,4.52423876e-04,1.93167929e-04,4.89212198e-06},{1.98886216e+00,-1.39778256e-02,2.11253110e-03,7.94863910e-04,-4.93164480e-05,-1.43048983e-05,2.03881513e-07,1.62961371e-07}},
+  {{-6.50748730e+00,2.16059475e+01,1.04357886e+00,-1.14538562e+00,2.47058254e-02,4.75801807e-03,-3.27908318e-03,1.03103754e-03},{-1.06569004e+01,7.05008507e+00,4.87166548e+00,-2.81881022e+00,-2.69531250e-01,1.77601844e-01,-1.46052856e-02,-7.82643503e-04},{2.49061084e+00,7.60656178e-01,-4.85196888e-01,-3.80460657e-02,1.39067741e-02,3.45295528e-04,-1.89733808e-04,6.48487639e-06},{1.98997939e+00,1.43389488e-02,1.89123966e-03,-8.12155835e-04,-4.26317492e-05,1.43968791e-05,1.00232015e-07,-1.56717093e-07}},
+  {{3.13013172e+01,-8.62303257e+00,-5.63548040e+00,5.21521509e-01,1.41780987e-01,-2.22851522e-02,-1.77315273e-03,1.55183510e-03},{1.29956573e-01,-6.06601775e-01,5.25437832e+00,1.68688571e+00,-7.31268823e-01,-1.14297062e-01,5.17538227e-02,1.88422052e-03},{-5.10831654e-01,-1.75218284e+00,9.18404013e-02,9.10280421e-02,-1.92038680e-03,-1.12896366e-03,1.82502072e-06,8.02954787e-07},{2.02386355e+00,-2.87386379e-03,-4.38900618e-03,1.44231773e-04,1.06266161e-04,-1.48169670e-06,-7.28447560e-07,-8.34761149e-09}},
+  {{-2.81875973e+01,-1.15077896e+01,5.57650423e+00,8.50868702e-01,-1.46682099e-01,-4.23260443e-02,-4.63822915e-04,2.53436365e-03},{8.93460846e+00,-1.04016380e+01,-8.64624691e+00,1.70943582e+00,1.09895432e+00,-6.18888177e-02,-7.61309117e-02,-3.62360734e-03},{-1.88655162e+00,1.31841385e+00,3.73960346e-01,-7.22904801e-02,-1.14058852e-02,1.12451287e-03,1.88062797e-04,-7.31386490e-06},{1.98273671e+00,-1.09163672e-02,3.34219728e-03,6.34511700e-04,-8.82701352e-05,-1.23759983e-05,8.94832795e-07,1.75136861e-07}},
+  {{4.35277748e+00,2.17399635e+01,-9.09845173e-01,-1.08028972e+00,3.24823186e-02,1.32149769e-04,6.37447869e-04,8.79404659e-04},{-1.02132082e+01,9.90053558e+00,1.26610145e-01,-2.92349744e+00,1.97378919e-01,1.38428152e-01,-7.16351625e-03,4.77869483e-03},{2.73490191e+00,1.97031721e-01,-5.23418069e-01,-5.56432270e-03,1.40474774e-02,-2.53553211e-04,-1.50410837e-04,1.28250431e-05},{1.99739814e+00,1.56645328e-02,4.46081161e-04,-8.64023052e-04,-1.42395936e-06,1.38028081e-05,-4.32537405e-07,-1.03537275e-07}},
+  {{2.56120033e+01,-1.43657827e+01,-4.53076124e+00,7.83220887e-01,8.03003311e-02,-2.02519968e-02,2.86784489e-03,7.30641128e-04},{2.64620590e+00,4.83601999e+00,6.59793234e+00,-8.43249559e-02,-8.42326880e-01,4.15820442e-02,3.57913598e-02,-9.95308999e-03},{-1.33944917e+00,-1.56336951e+00,2.42288515e-01,8.26960802e-02,-5.19729359e-03,-1.10974989e-03,9.33074625e-06,2.82189558e-06},{2.02124310e+00,-7.54859112e-03,-3.93166905e-03,3.82391387e-04,9.80372788e-05,-4.13078578e-06,-7.80244989e-07,-1.71254602e-08}},
+  {{-3.19720707e+01,-4.74658585e+00,6.60571671e+00,3.98204952e-01,-2.45419070e-01,-2.65361685e-02,9.39756818e-03,2.37981020e-03},{5.19914913e+00,-1.64013138e+01,-4.33499575e+00,3.58546782e+00,5.93496859e-01,-2.86246389e-01,-4.95690182e-02,1.66780036e-02},{-1.15158021e+00,1.65437305e+00,2.30653271e-01,-9.39399004e-02,-7.29338033e-03,1.68994186e-03,1.32452202e-04,-1.98625748e-05},{1.97842026e+00,-6.68378035e-03,4.22613090e-03,3.94532835e-04,-1.18183976e-04,-8.12580856e-06,1.51912479e-06,1.30638696e-07}},
+  {{1.47840919e+01,1.96866951e+01,-2.72203326e+00,-9.87764418e-01,4.36516330e-02,7.18089705e-03,3.31115746e-03,4.30269924e-04},{-8.75540638e+00,8.39986420e+00,-3.97219872e+00,-2.02016020e+00,5.76467574e-01,1.18906721e-01,-4.58483491e-03,-3.31116421e-03},{2.69696522e+00,-3.80389988e-01,-5.06774545e-01,2.55484283e-02,1.26756513e-02,-6.89027307e-04,-9.73939750e-05,1.31427660e-05},{2.00510502e+00,1.53656360e-02,-1.01254322e-03,-8.24522984e-04,3.59185615e-05,1.17322306e-05,-7.39572897e-07,-4.60747813e-08}},
+  {{1.73197174e+01,-1.86950150e+01,-3.05406308e+00,9.28122282e-01,3.83879133e-02,-8.36899970e-03,3.78241483e-03,-3.01340711e-04},{5.65612793e+00,1.02812500e+01,5.11590672e+00,-1.77876854e+00,-6.26285672e-01,1.10909328e-01,3.91071942e-03,-5.96247334e-03},{-2.03129101e+00,-1.21697342e+00,3.71576428e-01,6.68553859e-02,-8.34750198e-03,-1.04367919e-03,2.86751347e-05,6.58317276e-06},{2.01646805e+00,-1.14842206e-02,-3.08650197e-03,5.91754331e-04,8.17643377e-05,-6.97447058e-06,-8.37592552e-07,-1.12123795e-08}},
+  {{-3.24350891e+01,2.60690427e+00,6.77870417e+00,-1.84317604e-01,-2.67064005e-01,1.13648456e-02,1.18594877e-02,-1.14080997e-03},{9.38912153e-01,-1.76909885e+01,1.64742613e+00,3.91792202e+00,-2.92535275e-01,-3.28761309e-01,2.57712267e-02,2.06110552e-02},{-2.97164708e-01,1.81552267e+00,5.98119460e-02,-1.04600333e-01,-1.92352547e-03,1.98798673e-03,3.64508160e-05,-2.71258596e-05},{1.97636187e+00,-1.72719220e-03,4.65279073e-03,1.02700753e-04,-1.33198177e-04,-2.16944204e-06,1.86088209e-06,3.68559299e-08}},
+  {{2.36618576e+01,1.56939850e+01,-4.30068398e+00,-8.35822165e-01,8.13370645e-02,1.84923764e-02,3.01318592e-03,-5.59351000e-04},{-6.99109411e+00,3.96492124e+00,-5.91802692e+00,-3.94104511e-01,8.29786897e-01,5.78896329e-02,-3.05963326e-02,-9.64817032e-03},{2.38156462e+00,-9.12543535e-01,-4.39941287e-01,5.23306988e-02,1.02844369e-02,-9.48860019e-04,-5.08716585e-05,9.59522640e-06},{2.01230550e+00,1.35023315e-02,-2.33719195e-03,-7.06146820e-04,6.61754093e-05,8.94225650e-06,-8.43633984e-07,-4.27883950e-09}},
+  {{7.22484255e+00,-2.12155342e+01,-1.35626221e+00,1.00983441e+00,2.75198668e-02,1.22666755e-03,1.61111227e-03,-7.65953853e-04},{8.84618092e+00,1.31273079e+01,1.26425517e+00,-2.85546160e+00,-2.89523333e-01,1.18644185e-01,1.37005420e-03,4.82117757e-03},{-2.51521587e+00,-7.44678736e-01,4.67148155e-01,4.40734662e-02,-1.11590791e-02,-8.80370266e-04,6.47252600e-05,1.10060091e-05},{2.01002407e+00,-1.42822396e-02,-1.92133174e-03,7.53050263e-04,5.70466364e-05,-9.90496756e-06,-8.27380632e-07,1.57389035e-08}},
+  {{-2.95390339e+01,9.67638874e+00,6.04055548e+00,-7.13153720e-01,-1.95088014e-01,3.90631892e-02,3.71574401e-03,-2.94357981e-03},{-3.37898016e+00,-1.39379930e+01,6.82218027e+00,2.50841451e+00,-9.84048486e-01,-1.49479762e-01,7.46144131e-02,3.49187688e-03},{5.88051379e-01,1.78305244e+00,-1.18258215e-01,-1.02437921e-01,3.79058509e-03,1.92652945e-03,-7.12335823e-05,-2.55962423e-05},{1.97677600e+00,3.41715384e-03,4.56667924e-03,-2.02909912e-04,-1.30137982e-04,4.26489441e-06,1.78976552e-06,-7.16750250e-08}},
+  {{3.01041889e+01,1.01643620e+01,-5.50108528e+00,-5.74761629e-01,1.39698818e-01,2.18355916e-02,-1.19073049e-03,-1.50343392e-03},{-5.25807047e+00,-9.13755953e-01,-5.03504992e+00,1.42590320e+00,7.80159235e-01,-8.79684463e-02,-5.15147336e-02,-8.96935700e-04},{1.82195270e+00,-1.34743309e+00,-3.31872642e-01,7.29069635e-02,7.32759293e-03,-1.07349758e-03,-2.05585911e-05,5.18136176e-06},{2.01826143e+00,1.02881566e-02,-3.40576307e-03,-5.26731601e-04,8.80746957e-05,6.01183774e-06,-8.21958622e-07,1.52676964e-08}},
+  {{-3.61284733e+00,-2.16731853e+01,4.81528640e-01,1.07676840e+00,2.96791885e-02,6.10734220e-04,-1.98732503e-03,-9.86186089e-04},{1.13815107e+01,1.15527954e+01,-3.66869640e+00,-3.04817033e+00,1.12396553e-01,1.51897177e-01,1.73799004e-02,3.40417004e-03},{-2.74090576e+00,-1.91320062e-01,5.18145025e-01,1.55964065e-02,-1.32670412e-02,-5.64932183e-04,1.15047063e-04,1.36084454e-05},{2.00256968e+00,-1.56431496e-02,-5.37326909e-04,8.47052201e-04,2.42147380e-05,-1.25325487e-05,-6.62966670e-07,6.40745839e-08}},
+  {{-2.35197926e+01,1.56245279e+01,4.57224941e+00,-1.04336202e+00,-8.50381628e-02,3.71103138e-02,-4.70090937e-03,-1.19454018e-03},{-7.19411182e+00,-6.56689978e+00,9.13171673e+00,1.87498033e-01,-1.08872330e+00,8.16443115e-02,5.52224331e-02,-1.32692996e-02},{1.41218567e+00,1.56078076e+00,-2.82045513e-01,-8.78308639e-02,8.83038901e-03,1.52495713e-03,-1.56285794e-04,-1.60247528e-05},{1.97961915e+00,8.18957482e-03,3.97911714e-03,-4.81364230e-04,-1.09663808e-04,9.76732736e-06,1.33354672e-06,-1.51823400e-07}},
+  {{3.35350647e+01,3.64619446e+00,-6.15216208e+00,-2.00863123e-01,1.84172988e-01,9.20550805e-03,-5.92191238e-03,-8.53625941e-04},{-3.52440357e+00,-3.85161400e+00,-1.76157033e+00,2.65096617e+00,3.22475314e-01,-2.27456540e-01,-2.65256427e-02,1.32016269e-02},{1.07608640e+00,-1.64433467e+00,-1.94130152e-01,8.62943605e-02,4.11882298e-03,-1.11929572e-03,-5.88300327e-06,1.94406152e-06},{2.02236509e+00,6.05969597e-03,-4.12807288e-03,-3.05729394e-04,1.01619305e-04,3.23281688e-06,-7.59641523e-07,1.54346260e-08}},
+  {{-1.39994926e+01,-1.99456768e+01,2.40117025e+00,1.11846602e+00,1.09704360e-02,-1.29196784e-02,-5.66924270e-03,-8.20505433e-04},{1.23072071e+01,5.47717237e+00,-7.92489862e+00,-2.17347789e+00,6.13043845e-01,1.90664455e-01,3.49587994e-03,-1.00801168e-02},{-2.68430424e+00,3.88206750e-01,5.16842484e-01,-1.63484253e-02,-1.41885541e-02,-7.04544145e-05,1.66115395e-04,1.14269651e-05},{1.99487066e+00,-1.54015981e-02,9.33947507e-04,8.57224688e-04,-1.48687968e-05,-1.41991140e-05,-2.79466008e-07,1.22956678e-07}},
+  {{-1.49215097e+01,1.97932301e+01,2.69118643e+00,-1.15723717e+00,-4.11834521e-03,1.80560891e-02,-5.94388274e-03,6.30476861e-04},{-9.78873730e+00,1.70017123e+00,7.92790794e+00,-1.86845028e+00,-7.03291059e-01,1.88641340e-01,5.68506587e-03,-1.13330092e-02},{2.08979273e+00,1.17456722e+00,-4.12408710e-01,-6.32572845e-02,1.23820705e-02,9.04986926e-04,-1.95170505e-04,-2.95745576e-06},{1.98459518e+00,1.20767597e-02,2.96600582e-03,-6.97320909e-04,-7.60267503e-05,1.32785663e-05,6.62303250e-07,-1.76832742e-07}},
+  {{3.36755638e+01,-3.20879745e+00,-6.14036655e+00,2.17133924e-01,1.80775806e-01,-1.15603479e-02,-5.72461216e-03,9.52272560e-04},{-1.64668965e+00,-3.46433759e+00,2.43952322e+00,2.64075279e+00,-3.31665576e-01,-2.26465628e-01,2.71111839e-02,1.33921113e-02},{2.20480233e-01,-1.77637458e+00,-3.96008641e-02,9.20791030e-02,8.25187366e-04,-1.13055704e-03,-6.96816187e-07,5.51783955e-07},{2.02420020e+00,1.23998604e-03,-4.44742013e-03,-6.21467843e-05,1.07285319e-04,6.34072137e-07,-7.20699177e-07,3.70024833e-09}},
+  {{-2.27944717e+01,-1.60851021e+01,4.26681900e+00,1.05425823e+00,-5.73794954e-02,-3.35001014e-02,-5.86489728e-03,6.82910555e-04},{1.11920490e+01,-3.27068186e+00,-9.75126457e+00,-2.54034102e-01,1.04981172e+00,1.14639200e-01,-4.70844097e-02,-1.50139621e-02},{-2.35046649e+00,9.33720708e-01,4.60375607e-01,-4.84491289e-02,-1.34564089e-02,5.66635630e-04,1.95578876e-04,3.07134906e-06},{1.98772180e+00,-1.35533661e-02,2.33928091e-03,7.73873879e-04,-5.62713576e-05,-1.41416276e-05,3.16661271e-07,1.68398373e-07}},
+  {{-4.61825323e+00,2.17985725e+01,6.93263113e-01,-1.13679993e+00,2.73663420e-02,2.96744402e-03,-2.57091131e-03,1.03235291e-03},{-1.06751518e+01,7.86316156e+00,4.07052708e+00,-2.91959786e+00,-1.80393621e-01,1.70154735e-01,-1.51347928e-02,1.20976556e-03},{2.55085707e+00,6.68424964e-01,-4.95498329e-01,-3.25877368e-02,1.40528800e-02,2.34917607e-04,-1.85021665e-04,7.99880672e-06},{1.99118650e+00,1.46734538e-02,1.65332726e-03,-8.27524054e-04,-3.55613302e-05,1.44295218e-05,-4.20518775e-09,-1.49170063e-07}},
+  {{3.05175953e+01,-9.71789742e+00,-5.47651291e+00,5.77418447e-01,1.30993545e-01,-2.31337752e-02,-7.92528270e-04,1.50301063e-03},{5.15012085e-01,2.41732791e-01,5.68955135e+00,1.40369523e+00,-7.82538235e-01,-8.43963027e-02,5.23832478e-02,-9.28116555e-04},{-6.57550216e-01,-1.73184991e+00,1.18295245e-01,9.01392847e-02,-2.48041679e-03,-1.12732255e-03,2.58244586e-06,1.01460921e-06},{2.02358079e+00,-3.69995297e-03,-4.33985144e-03,1.85876444e-04,1.05397674e-04,-1.92005587e-06,-7.34536457e-07,-1.05016893e-08}},
+  {{-2.90903473e+01,-1.03972101e+01,5.81075525e+00,7.86771655e-01,-1.66683465e-01,-4.19050977e-02,1.25556055e-03,2.79569137e-03},{8.35701656e+00,-1.17218008e+01,-8.10361195e+00,2.11019969e+00,1.05522180e+00,-1.05999805e-01,-7.69428611e-02,6.88164582e-05},{-1.77334177e+00,1.38610625e+00,3.52257669e-01,-7.65921846e-02,-1.08232629e-02,1.23262522e-03,1.82138727e-04,-9.57644716e-06},{1.98186421e+00,-1.02675809e-02,3.51971621e-03,5.98665327e-04,-9.41527178e-05,-1.18077842e-05,1.01158889e-06,1.71711932e-07}},
+  {{6.25792074e+00,2.15358944e+01,-1.24211514e+00,-1.06659544e+00,3.32799852e-02,6.68207940e-04,1.24225637e-03,8.26444477e-04},{-1.00044317e+01,9.92177582e+00,-6.94387376e-01,-2.83162832e+00,2.70042539e-01,1.34242013e-01,-5.00135031e-03,4.12020180e-03},{2.74812317e+00,9.82570127e-02,-5.24306595e-01,-9.00723608e-05,1.39058065e-02,-3.40132072e-04,-1.41691693e-04,1.32666773e-05},{1.99870872e+00,1.57260280e-02,1.95013141e-04,-8.63362977e-04,5.30283023e-06,1.35314276e-05,-5.00836791e-07,-9.33518081e-08}},
+  {{2.43221664e+01,-1.52478266e+01,-4.29218245e+00,8.16398561e-01,7.06511065e-02,-1.85219496e-02,3.33381863e-03,5.18705114e-04},{3.12111950e+00,5.87778330e+00,6.54781675e+00,-4.09445107e-01,-8.21994007e-01,6.15071654e-02,2.96850689e-02,-1.04870507e-02},{-1.46849871e+00,-1.51470244e+00,2.66051441e-01,8.05124342e-02,-5.74457319e-03,-1.10283855e-03,1.16072833e-05,3.35091954e-06},{2.02056980e+00,-8.27958342e-03,-3.81338899e-03,4.20429948e-04,9.58399032e-05,-4.59942521e-06,-7.91180298e-07,-1.73650019e-08}},
+  {{-3.23039398e+01,-3.46898246e+00,6.70379877e+00,3.00441712e-01,-2.56353319e-01,-2.07408611e-02,1.06730023e-02,1.91046845e-03},{4.49352884e+00,-1.69989910e+01,-3.34164858e+00,3.77667856e+00,4.50981826e-01,-3.11311036e-01,-3.80512401e-02,1.91075932e-02},{-1.01239884e+00,1.69455802e+00,2.03027025e-01,-9.65834036e-02,-6.44718483e-03,1.76279072e-03,1.18364347e-04,-2.16035387e-05},{1.97790623e+00,-5.87809458e-03,4.33238270e-03,3.47611931e-04,-1.21891702e-04,-7.20515663e-06,1.60195736e-06,1.17483879e-07}},
+  {{1.64939194e+01,1.91164570e+01,-3.02178693e+00,-9.67147827e-01,4.81414720e-02,9.18713305e-03,3.53198964e-03,2.98626430e-04},{-8.45571136e+00,7.75452662e+00,-4.50444555e+00,-1.77505994e+00,6.34111583e-01,1.13764159e-01,-7.38628441e-03,-5.15474472e-03},{2.66193509e+00,-4.75413531e-01,-4.98676211e-01,3.04604918e-02,1.23256715e-02,-7.44687801e-04,-8.86094494e-05,1.27239400e-05},{2.00638366e+00,1.51528083e-02,-1.25043967e-03,-8.09397956e-04,4.16040384e-05,1.12883417e-05,-7.69621920e-07,-3.75386975e-08}},
+  {{1.56423960e+01,-1.92820377e+01,-2.76680732e+00,9.45344985e-01,3.43292281e-02,-6.20125700e-03,3.56840878e-03,-4.21614182e-04},{6.20589399e+00,1.10521965e+01,4.58507442e+00,-2.02414703e+00,-5.71278632e-01,1.14034936e-01,6.92958769e-04,-3.96538712e-03},{-2.12944412e+00,-1.14436436e+00,3.90445471e-01,6.34407625e-02,-8.85571633e-03,-1.02419767e-03,3.35743680e-05,7.33697379e-06},{2.01547241e+00,-1.20472182e-02,-2.90831737e-03,6.22973661e-04,7.81528506e-05,-7.47214426e-06,-8.42829024e-07,-8.21458279e-09}},
+  {{-3.21678543e+01,3.90041041e+00,6.71289730e+00,-2.86733419e-01,-2.60367632e-01,1.79402959e-02,1.10152997e-02,-1.73871231e-03},{1.92289293e-01,-1.73769417e+01,2.68440318e+00,3.78415275e+00,-4.44860458e-01,-3.10541004e-01,3.84504348e-02,1.87557507e-02},{-1.46442413e-01,1.82352531e+00,2.94797495e-02,-1.05136439e-01,-9.48796747e-04,2.00344436e-03,1.80172301e-05,-2.75171933e-05},{1.97625983e+00,-8.51174758e-04,4.67404211e-03,5.06263023e-05,-1.33959722e-04,-1.07070991e-06,1.87885962e-06,1.82385911e-08}},
+  {{2.49979954e+01,1.48164368e+01,-4.54611588e+00,-7.98783779e-01,9.09222737e-02,2.00393237e-02,2.52714218e-03,-7.73199019e-04},{-6.69270563e+00,3.04879403e+00,-5.96972942e+00,-6.63649291e-02,8.49147856e-01,3.75417620e-02,-3.62331681e-02,-9.24585108e-03},{2.30203843e+00,-9.94360685e-01,-4.24131781e-01,5.62888980e-02,9.81015339e-03,-9.77809192e-04,-4.44937250e-05,8.82921904e-06},{2.01342106e+00,1.30416034e-02,-2.53916648e-03,-6.79340679e-04,7.04821796e-05,8.44175247e-06,-8.46205296e-07,6.03279426e-10}},
+  {{5.33135223e+00,-2.14516983e+01,-1.03998613e+00,1.02189100e+00,2.77606025e-02,2.01294594e-03,1.04784092e-03,-8.12722603e-04},{9.35951900e+00,1.32136087e+01,4.29225057e-01,-2.95983386e+00,-2.24732801e-01,1.21108316e-01,4.13313275e-03,5.82933519e-03},{-2.57231927e+00,-6.54900432e-01,4.79131013e-01,3.95836234e-02,-1.15771387e-02,-8.38620705e-04,7.24852216e-05,1.16570045e-05},{2.00880766e+00,-1.46185700e-02,-1.69815181e-03,7.74137909e-04,5.20047215e-05,-1.03863122e-05,-8.12442977e-07,2.25788934e-08}},
+  {{-2.86928806e+01,1.08299503e+01,5.82669258e+00,-7.88080812e-01,-1.76265657e-01,4.08630818e-02,1.90088688e-03,-2.81970389e-03},{-4.08422565e+00,-1.28408756e+01,7.47233820e+00,2.13196588e+00,-1.04851925e+00,-1.06158189e-01,7.60092661e-02,-2.55282968e-04},{7.34669149e-01,1.75793242e+00,-1.47627845e-01,-1.00771993e-01,4.71954467e-03,1.87965424e-03,-8.81152228e-05,-2.44438415e-05},{1.97709656e+00,4.26815543e-03,4.50012973e-03,-2.53149861e-04,-1.27787134e-04,5.29997487e-06,1.73578621e-06,-8.83209879e-08}},
+  {{3.09402256e+01,9.06669712e+00,-5.66118813e+00,-5.15708864e-01,1.49863034e-01,2.07740627e-02,-2.16531358e-03,-1.53669226e-03},{-4.97402239e+00,-1.63805020e+00,-4.59800625e+00,1.70943475e+00,7.27638781e-01,-1.17478870e-01,-5.08853160e-02,1.80696603e-03},{1.70621514e+00,-1.40826237e+00,-3.10178816e-01,7.56911710e-02,6.79334719e-03,-1.08518673e-03,-1.71048287e-05,4.51467986e-06},{2.01909971e+00,9.62918531e-03,-3.55420867e-03,-4.91520448e-04,9.09375522e-05,5.52502252e-06,-8.12005908e-07,1.64814917e-08}},
+  {{-5.51486301e+00,-2.15265408e+01,8.17050755e-01,1.08717203e+00,2.89183948e-02,-8.40927009e-04,-2.68865493e-03,-1.00682199e-03},{1.16810331e+01,1.07939787e+01,-4.52002525e+00,-2.97579074e+00,1.94093868e-01,1.61201224e-01,1.82576869e-02,1.46770501e-03},{-2.75095415e+00,-9.31089520e-02,5.21670401e-01,1.03352023e-02,-1.35188997e-02,-4.93374944e-04,1.24184546e-04,1.36408571e-05},{2.00125718e+00,-1.57146454e-02,-2.89546297e-04,8.54921236e-04,1.79321323e-05,-1.29022601e-05,-6.14079397e-07,7.38322825e-08}},
+  {{-2.21674805e+01,1.65041523e+01,4.26081133e+00,-1.07759356e+00,-6.73722848e-02,3.43132131e-02,-5.46178035e-03,-7.82851537e-04},{-7.73913145e+00,-5.09508133e+00,9.16297531e+00,-2.22696036e-01,-1.04697549e+00,1.12059675e-01,4.67224456e-02,-1.44151235e-02},{1.53948641e+00,1.50547791e+00,-3.06944817e-01,-8.42512995e-02,9.55330767e-03,1.43035804e-03,-1.66463666e-04,-1.38891792e-05},{1.98032880e+00,8.92334338e-03,3.83345736e-03,-5.23163180e-04,-1.04701816e-04,1.05213221e-05,1.22841948e-06,-1.60219727e-07}},
+  {{3.37998810e+01,2.43913460e+00,-6.19963026e+00,-1.27068430e-01,1.87617749e-01,5.62639954e-03,-6.34935638e-03,-5.52009151e-04},{-3.22888017e+00,-4.04769754e+00,-1.03112280e+00,2.74888158e+00,2.10168526e-01,-2.39947140e-01,-1.76147614e-02,1.46203013e-02},{9.36050057e-01,-1.67861068e+00,-1.68678388e-01,8.78043100e-02,3.56227905e-03,-1.12262752e-03,-4.54809151e-06,1.57608167e-06},{2.02284098e+00,5.26943197e-03,-4.21106536e-03,-2.65406299e-04,1.03107443e-04,2.78089692e-06,-7.50029415e-07,1.40294256e-08}},
+  {{-1.56970100e+01,-1.94111595e+01,2.73999071e+00,1.11753845e+00,2.96489848e-03,-1.64051428e-02,-6.10362133e-03,-6.75650721e-04},{1.22637186e+01,4.06755018e+00,-8.46538162e+00,-1.90350306e+00,7.03590155e-01,1.88752562e-01,-3.75209399e-03,-1.22045325e-02},{-2.64611816e+00,4.84841853e-01,5.11042535e-01,-2.18919013e-02,-1.41889174e-02,2.99219701e-05,1.73273380e-04,1.04342389e-05},{1.99359739e+00,-1.51958996e-02,1.18147163e-03,8.49632255e-04,-2.18749046e-05,-1.43280586e-05,-1.91388082e-07,1.32405475e-07}},
+  {{-1.31954966e+01,2.03090305e+01,2.34031773e+00,-1.16047454e+00,4.67815762e-03,1.46730235e-02,-5.53245889e-03,7.89565791e-04},{-1.00579557e+01,3.00160384e+00,7.39442587e+00,-2.13574886e+00,-6.11772299e-01,1.91677764e-01,-1.07363111e-03,-9.28494241e-03},{2.18459892e+00,1.09545314e+00,-4.30057585e-01,-5.83509393e-02,1.27995089e-02,7.89972022e-04,-1.96611189e-04,-8.10315441e-07},{1.98562014e+00,1.26155643e-02,2.75971880e-03,-7.25766935e-04,-6.94388873e-05,1.36364542e-05,5.43035753e-07,-1.75312607e-07}},
+  {{3.33488617e+01,-4.40288162e+00,-6.06706715e+00,2.87870765e-01,1.74572647e-01,-1.47186425e-02,-5.06362878e-03,1.19483273e-03},{-1.31314862e+00,-3.02786922e+00,3.13631606e+00,2.49855065e+00,-4.36424613e-01,-2.08701029e-01,3.50805447e-02,1.15074040e-02},{7.04579949e-02,-1.78104627e+00,-1.26497140e-02,9.22802389e-02,2.63351394e-04,-1.13076449e-03,-2.16690907e-07,5.03328124e-07},{2.02426529e+00,3.96180258e-04,-4.45867842e-03,-1.98466478e-05,1.07477987e-04,2.02155235e-07,-7.19052082e-07,1.18877219e-09}},
+  {{-2.41050835e+01,-1.51977654e+01,4.57080460e+00,1.02355421e+00,-7.47561306e-02,-3.65368761e-02,-5.15909214e-03,1.09250029e-03},{1.08111801e+01,-4.85726738e+00,-9.72297096e+00,1.57248929e-01,1.09188342e+00,8.39376524e-02,-5.58775663e-02,-1.36911329e-02},{-2.26787543e+00,1.01847851e+00,4.45375085e-01,-5.36179170e-02,-1.31421909e-02,6.81758160e-04,1.96716850e-04,1.12002772e-06},{1.98661959e+00,-1.30872037e-02,2.55942694e-03,7.50206702e-04,-6.31239673e-05,-1.39113308e-05,4.32463224e-07,1.72583384e-07}},
+  {{-2.70573497e+00,2.19132004e+01,3.43987793e-01,-1.12651968e+00,2.92105060e-02,1.60823204e-03,-1.85401994e-03,1.01668446e-03},{-1.06458817e+01,8.53578472e+00,3.23990035e+00,-2.98242879e+00,-9.40321311e-02,1.62368774e-01,-1.45441853e-02,2.83798319e-03},{2.60341024e+00,5.74369133e-01,-5.04215062e-01,-2.70800255e-02,1.41457869e-02,1.27506908e-04,-1.79338036e-04,9.33889532e-06},{1.99242020e+00,1.49629125e-02,1.41129084e-03,-8.40135675e-04,-2.84859179e-05,1.44022379e-05,-1.03421897e-07,-1.40811437e-07}},
+  {{2.96270924e+01,-1.07800655e+01,-5.29873323e+00,6.29089415e-01,1.19792968e-01,-2.34055165e-02,1.55608388e-04,1.39809342e-03},{9.15957034e-01,1.15908980e+00,6.04292774e+00,1.10095620e+00,-8.19303513e-01,-5.44436350e-02,5.12643978e-02,-3.56563763e-03},{-8.02268505e-01,-1.70650959e+00,1.44448519e-01,8.90286192e-02,-3.03926482e-03,-1.12512242e-03,3.50871755e-06,1.28019542e-06},{2.02322865e+00,-4.51530563e-03,-4.27855738e-03,2.27121447e-04,1.04309038e-04,-2.36219989e-06,-7.41943040e-07,-1.24391919e-08}},
+  {{-2.98870659e+01,-9.24275112e+00,6.02248669e+00,7.15082288e-01,-1.86044544e-01,-4.04446796e-02,3.07177799e-03,2.94957357e-03},{7.74883604e+00,-1.29368544e+01,-7.45577240e+00,2.48759747e+00,9.90327060e-01,-1.49676844e-01,-7.53063038e-02,3.90928378e-03},{-1.65482461e+00,1.44958782e+00,3.29361916e-01,-8.06549639e-02,-1.01894550e-02,1.33674568e-03,1.74712724e-04,-1.18216094e-05},{1.98104715e+00,-9.58687626e-03,3.68647091e-03,5.60610613e-04,-9.97377065e-05,-1.11725340e-05,1.12528426e-06,1.66557456e-07}},
+  {{8.14113998e+00,2.12562046e+01,-1.56941986e+00,-1.05177832e+00,3.44200619e-02,1.56569958e-03,1.79902255e-03,7.64426950e-04},{-9.77215195e+00,9.79901505e+00,-1.48205030e+00,-2.70740104e+00,3.40102255e-01,1.30813107e-01,-3.34347226e-03,3.01100407e-03},{2.75309658e+00,-5.78793755e-04,-5.23612142e-01,5.32362564e-03,1.37226814e-02,-4.21575765e-04,-1.32710498e-04,1.35339451e-05},{2.00002337e+00,1.57402232e-02,-5.55608131e-05,-8.60093685e-04,1.18905391e-05,1.32214309e-05,-5.62317723e-07,-8.32028988e-08}},
+  {{2.29459438e+01,-1.60767002e+01,-4.04154491e+00,8.45562398e-01,6.18352853e-02,-1.65272895e-02,3.65976011e-03,3.12281656e-04},{3.61531806e+00,6.90715647e+00,6.40118933e+00,-7.27189183e-01,-7.91770697e-01,7.79559165e-02,2.33661178e-02,-1.04276380e-02},{-1.59314346e+00,-1.46159947e+00,2.89130867e-01,7.81136900e-02,-6.28758455e-03,-1.09440181e-03,1.42640120e-05,3.92945822e-06},{2.01983595e+00,-8.98675527e-03,-3.68415052e-03,4.57535469e-04,9.34082782e-05,-5.07405866e-06,-8.02027500e-07,-1.71343597e-08}},
+  {{-3.25194969e+01,-2.17745662e+00,6.77113628e+00,1.99329421e-01,-2.64297068e-01,-1.43252686e-02,1.16201481e-02,1.33434345e-03},{3.77544641e+00,-1.74341221e+01,-2.30591321e+00,3.91117573e+00,2.98351943e-01,-3.29134822e-01,-2.51957104e-02,2.08397079e-02},{-8.70211065e-01,1.72950435e+00,1.74699917e-01,-9.88916382e-02,-5.56814391e-03,1.82706199e-03,1.03185528e-04,-2.31608046e-05},{1.97745967e+00,-5.05412091e-03,4.42487281e-03,2.99361360e-04,-1.25138642e-04,-6.23933829e-06,1.67544601e-06,1.02973630e-07}},
+  {{1.81411076e+01,1.84811897e+01,-3.31232572e+00,-9.44019496e-01,5.36008701e-02,1.12728719e-02,3.64271551e-03,1.46150735e-04},{-8.15485001e+00,7.02442980e+00,-4.95640802e+00,-1.50769222e+00,6.87178731e-01,1.06616095e-01,-1.12008443e-02,-6.80379523e-03},{2.61895823e+00,-5.68807721e-01,-4.89161432e-01,3.52322124e-02,1.19490856e-02,-7.95281201e-04,-8.01178612e-05,1.22078363e-05},{2.00764346e+00,1.48953591e-02,-1.48367218e-03,-7.92074949e-04,4.70693158e-05,1.08278282e-05,-7.94030711e-07,-2.95497671e-08}},
+  {{1.39119101e+01,-1.98026409e+01,-2.47334647e+00,9.60549891e-01,3.13094854e-02,-4.18141484e-03,3.26549471e-03,-5.21254726e-04},{6.76292706e+00,1.17233543e+01,3.97981143e+00,-2.24631858e+00,-5.13575017e-01,1.15535073e-01,-1.30392506e-03,-1.84622116e-03},{-2.22122335e+00,-1.06831408e+00,4.08273876e-01,5.98296821e-02,-9.35288146e-03,-1.00162730e-03,3.89788693e-05,8.10324855e-06},{2.01443148e+00,-1.25752781e-02,-2.72131385e-03,6.52700139e-04,7.42961493e-05,-7.97154371e-06,-8.45707063e-07,-4.57744909e-09}},
+  {{-3.17870750e+01,5.17534733e+00,6.61664248e+00,-3.85881394e-01,-2.50655413e-01,2.39289925e-02,9.83541738e-03,-2.23467941e-03},{-5.53694725e-01,-1.69012089e+01,3.67889881e+00,3.59418964e+00,-5.86871386e-01,-2.85244912e-01,4.97238934e-02,1.62365809e-02},{4.66859061e-03,1.82586050e+00,-9.45533044e-04,-1.05294399e-01,3.05608046e-05,2.00810214e-03,-5.81393181e-07,-2.76380597e-05},{1.97623014e+00,2.72276284e-05,4.68025729e-03,-1.62766230e-06,-1.34185364e-04,3.45455042e-08,1.88430681e-06,-5.89144400e-10}},
+  {{2.62426605e+01,1.38916521e+01,-4.77661943e+00,-7.57791519e-01,1.01037569e-01,2.12316550e-02,1.90933899e-03,-9.79106175e-04},{-6.40028572e+00,2.13591313e+00,-5.92520046e+00,2.64082491e-01,8.57104719e-01,1.42473914e-02,-4.13754098e-02,-8.28566961e-03},{2.21568060e+00,-1.07309330e+00,-4.07186240e-01,6.00586683e-02,9.32198390e-03,-1.00311870e-03,-3.86258725e-05,8.05504533e-06},{2.01449656e+00,1.25432387e-02,-2.73310626e-03,-6.50876551e-04,7.45423749e-05,7.94013431e-06,-8.45603324e-07,4.82283102e-09}},
+  {{3.42613626e+00,-2.16157589e+01,-7.20872939e-01,1.03345895e+00,2.82948893e-02,2.43353331e-03,4.49550163e-04,-8.54774902e-04},{9.85037613e+00,1.31474247e+01,-4.32594389e-01,-3.03405166e+00,-1.57864481e-01,1.24947950e-01,7.32033746e-03,6.31971704e-03},{-2.62171960e+00,-5.63044488e-01,4.89770710e-01,3.49372625e-02,-1.19727841e-02,-7.92191597e-04,8.06369062e-05,1.22409347e-05},{2.00756598e+00,-1.49119115e-02,-1.46925298e-03,7.93180312e-04,4.67317077e-05,-1.08565837e-05,-7.92584331e-07,3.00347125e-08}},
+  {{-2.77479572e+01,1.19367905e+01,5.59099483e+00,-8.55518401e-01,-1.56735033e-01,4.16330583e-02,1.71227672e-04,-2.58563878e-03},{-4.77073383e+00,-1.16402407e+01,8.01891136e+00,1.73290074e+00,-1.09224093e+00,-6.25569001e-02,7.50519261e-02,-3.81537643e-03},{8.79017174e-01,1.72738159e+00,-1.76466718e-01,-9.87513363e-02,5.62343467e-03,1.82317861e-03,-1.04154169e-04,-2.30674996e-05},{1.97748661e+00,5.10533713e-03,4.41924576e-03,-3.02380446e-04,-1.24941362e-04,6.30035856e-06,1.67100836e-06,-1.03905933e-07}},
+  {{3.16704521e+01,7.94456673e+00,-5.80106306e+00,-4.53290552e-01,1.59241825e-01,1.91582888e-02,-3.12171667e-03,-1.50577771e-03},{-4.69171619e+00,-2.28412867e+00,-4.08758354e+00,1.96837580e+00,6.61438346e-01,-1.45942390e-01,-4.85322922e-02,4.57595708e-03},{1.58544910e+00,-1.46489859e+00,-2.87695408e-01,7.82633051e-02,6.25343574e-03,-1.09491381e-03,-1.40898865e-05,3.89193656e-06},{2.01988125e+00,8.94293468e-03,-3.69219948e-03,-4.55218629e-04,9.35601784e-05,5.04391573e-06,-8.01330543e-07,1.71596248e-08}},
+  {{-7.38662052e+00,-2.13088074e+01,1.15285146e+00,1.09649515e+00,2.73094904e-02,-2.70705717e-03,-3.38394800e-03,-1.01349398e-03},{1.19276543e+01,9.89341831e+00,-5.33899546e+00,-2.86822629e+00,2.79170960e-01,1.70333683e-01,1.78442057e-02,-8.12275102e-04},{-2.75275517e+00,5.54489810e-03,5.23648739e-01,4.98728640e-03,-1.37338387e-02,-4.16542141e-04,1.33260823e-04,1.35189730e-05},{1.99994206e+00,-1.57391559e-02,-4.00030804e-05,8.60286062e-04,1.14810709e-05,-1.32404866e-05,-5.58539909e-07,8.38275014e-08}},
+  {{-2.07420826e+01,1.73187256e+01,3.93963528e+00,-1.10488904e+00,-5.10923229e-02,3.11220195e-02,-5.96390199e-03,-3.99123819e-04},{-8.24259567e+00,-3.61422729e+00,9.08156109e+00,-6.17102027e-01,-9.91170228e-01,1.37542501e-01,3.76463048e-02,-1.48721961e-02},{1.66209829e+00,1.44561028e+00,-3.30777645e-01,-8.03997666e-02,1.02290781e-02,1.33021176e-03,-1.75193214e-04,-1.16807341e-05},{1.98109818e+00,9.62880999e-03,3.67600261e-03,-5.62972040e-04,-9.93867216e-05,1.12124962e-05,1.11815166e-06,-1.66898502e-07}},
+  {{3.39575233e+01,1.23161364e+00,-6.22496223e+00,-5.28334714e-02,1.89306021e-01,1.88695523e-03,-6.58035977e-03,-2.23341980e-04},{-2.92937732e+00,-4.13018036e+00,-2.81252295e-01,2.80395246e+00,9.34915617e-02,-2.47109339e-01,-8.01665056e-03,1.54688712e-02},{7.93287933e-01,-1.70799744e+00,-1.42815053e-01,8.90931264e-02,3.00410762e-03,-1.12518645e-03,-3.44939167e-06,1.26356701e-06},{2.02324915e+00,4.46453225e-03,-4.28215461e-03,-2.24537274e-04,1.04371058e-04,2.33416858e-06,-7.41407405e-07,1.23231523e-08}},
+  {{-1.73298779e+01,-1.88133354e+01,3.07420802e+00,1.11281192e+00,-6.69887848e-03,-2.00543534e-02,-6.40163757e-03,-4.81317053e-04},{1.21577177e+01,2.58690500e+00,-8.91990662e+00,-1.60130537e+00,7.90782392e-01,1.82380676e-01,-1.21048046e-02,-1.39041441e-02},{-2.59999323e+00,5.80160320e-01,5.03641367e-01,-2.74206717e-02,-1.41391121e-02,1.34151196e-04,1.79680326e-04,9.25745826e-06},{1.99234438e+00,-1.49440076e-02,1.42623205e-03,8.39297660e-04,-2.89244472e-05,-1.44030782e-05,-9.72726184e-08,1.41324108e-07}},
+  {{-1.14304104e+01,2.07534046e+01,1.98935485e+00,-1.16014886e+00,1.18650775e-02,1.15539348e-02,-5.01211407e-03,9.02241096e-04},{-1.02732716e+01,4.21902514e+00,6.78590870e+00,-2.36830902e+00,-5.18443048e-01,1.91139624e-01,-6.56072935e-03,-7.00528221e-03},{2.27279067e+00,1.01313949e+00,-4.46272135e-01,-5.32911792e-02,1.31609458e-02,6.74463576e-04,-1.96641151e-04,1.24482904e-06},{1.98668873e+00,1.31150307e-02,2.54553021e-03,-7.51623942e-04,-6.26904366e-05,1.39249360e-05,4.25136562e-07,-1.72317584e-07}},
+  {{3.29233627e+01,-5.57602835e+00,-5.97441673e+00,3.55724186e-01,1.67029873e-01,-1.74525306e-02,-4.27220017e-03,1.37845904e-03},{-9.70712662e-01,-2.48904157e+00,3.79216528e+00,2.31933451e+00,-5.32160461e-01,-1.86791062e-01,4.17574681e-02,9.20343306e-03},{-7.97200873e-02,-1.78057635e+00,1.43236639e-02,9.22581777e-02,-2.98460684e-04,-1.13063818e-03,2.49608973e-07,5.07801985e-07},{2.02425861e+00,-4.48450213e-04,-4.45752451e-03,2.24809046e-05,1.07454369e-04,-2.29260763e-07,-7.19053446e-07,-1.34338551e-09}},
+  {{-2.53293648e+01,-1.42621260e+01,4.86194563e+00,9.86330211e-01,-9.32148546e-02,-3.90537567e-02,-4.20393050e-03,1.51268300e-03},{1.03821545e+01,-6.41728115e+00,-9.58342838e+00,5.77857137e-01,1.11823606e+00,4.87725213e-02,-6.35868385e-02,-1.17016369e-02},{-2.17848349e+00,1.10022736e+00,4.28910911e-01,-5.86493798e-02,-1.27720563e-02,7.97027140e-04,1.96504392e-04,-9.41928704e-07},{1.98555851e+00,-1.25806872e-02,2.77221133e-03,7.23911624e-04,-6.98414515e-05,-1.36126027e-05,5.50399477e-07,1.75391349e-07}},
+  {{-7.91202784e-01,2.19597092e+01,-7.35496753e-04,-1.11534786e+00,3.04559711e-02,6.74879295e-04,-1.14861282e-03,9.89896595e-04},{-1.05722666e+01,9.07297611e+00,2.39292932e+00,-3.01078367e+00,-1.08011058e-02,1.54889762e-01,-1.30978823e-02,4.02954966e-03},{2.64811826e+00,4.78785306e-01,-5.11334062e-01,-2.15432681e-02,1.41870016e-02,2.35998505e-05,-1.72799657e-04,1.04975825e-05},{1.99367678e+00,1.52065912e-02,1.16592483e-03,-8.49991862e-04,-2.14340034e-05,1.43181642e-05,-1.96909824e-07,-1.31795133e-07}},
+  {{2.86531010e+01,-1.18050442e+01,-5.10761499e+00,6.76500499e-01,1.08605832e-01,-2.31595188e-02,1.03276793e-03,1.25097274e-03},{1.33142090e+00,2.12655759e+00,6.31620264e+00,7.85522938e-01,-8.42640400e-01,-2.54361462e-02,4.86269705e-02,-5.90809621e-03},{-9.44557846e-01,-1.67622828e+00,1.70234516e-01,8.76967236e-02,-3.59658618e-03,-1.12225057e-03,4.64102231e-06,1.59995841e-06},{2.02280784e+00,-5.31761115e-03,-4.20526043e-03,2.67878175e-04,1.02998376e-04,-2.80881932e-06,-7.50501727e-07,-1.41135885e-08}},
+  {{-3.05882988e+01,-8.06075954e+00,6.21262646e+00,6.37239814e-01,-2.04337761e-01,-3.79934944e-02,4.90497006e-03,2.98131234e-03},{7.11469984e+00,-1.40414686e+01,-6.71821260e+00,2.83672237e+00,9.06259298e-01,-1.91663176e-01,-7.13191926e-02,7.72966491e-03},{-1.53135836e+00,1.50864828e+00,3.05345327e-01,-8.44597816e-02,-9.50665027e-03,1.43601350e-03,1.65808407e-04,-1.40196607e-05},{1.98028827e+00,-8.87633953e-03,3.84185393e-03,5.20470610e-04,-1.04993494e-04,-1.04724350e-05,1.23477400e-06,1.59671345e-07}},
+  {{9.99270248e+00,2.09169006e+01,-1.89054799e+00,-1.03636575e+00,3.60342376e-02,2.76818033e-03,2.30137538e-03,6.92903064e-04},{-9.51903343e+00,9.55147743e+00,-2.23062539e+00,-2.55556393e+00,4.07935083e-01,1.27926707e-01,-2.40653846e-03,1.54794101e-03},{2.74981427e+00,-9.91784781e-02,-5.21353006e-01,1.06609259e-02,1.35005834e-02,-4.97755304e-04,-1.23580699e-04,1.36361550e-05},{2.00133801e+00,1.57072488e-02,-3.04888934e-04,-8.54270824e-04,1.83209595e-05,1.28767679e-05,-6.17023204e-07,-7.32069552e-08}},
+  {{2.15069141e+01,-1.68578873e+01,-3.78359079e+00,8.71606350e-01,5.39978929e-02,-1.43807074e-02,3.85610736e-03,1.19673721e-04},{4.12449980e+00,7.90917826e+00,6.16959858e+00,-1.03443706e+00,-7.54194438e-01,9.10702050e-02,1.72117241e-02,-9.82724968e-03},{-1.71301270e+00,-1.40420151e+00,3.11463863e-01,7.55019709e-02,-6.82547782e-03,-1.08420698e-03,1.73316239e-05,4.55422560e-06},{2.01904392e+00,-9.66805127e-03,-3.54425050e-03,4.93614585e-04,9.07398207e-05,-5.55449469e-06,-8.12451049e-07,-1.63970331e-08}},
+  {{-3.26390190e+01,-8.81678760e-01,6.81210709e+00,9.63927284e-02,-2.69316882e-01,-7.52317812e-03,1.22132869e-02,6.87711872e-04},{3.04743147e+00,-1.77167587e+01,-1.24482179e+00,3.99121189e+00,1.39557004e-01,-3.39644194e-01,-1.15177063e-02,2.18408015e-02},{-7.25447059e-01,1.75909472e+00,1.45769626e-01,-1.00853048e-01,-4.66055050e-03,1.88216649e-03,8.70459626e-05,-2.45117044e-05},{1.97708178e+00,-4.21445398e-03,4.50325338e-03,2.49963196e-04,-1.27904699e-04,-5.23405106e-06,1.73875378e-06,8.72606734e-08}},
+  {{1.97306690e+01,1.77970257e+01,-3.59469676e+00,-9.18825507e-01,5.99956363e-02,1.33751612e-02,3.64237395e-03,-2.54902770e-05},{-7.85184097e+00,6.23089552e+00,-5.33220387e+00,-1.22275531e+00,7.35525489e-01,9.71900597e-02,-1.58528872e-02,-8.16081092e-03},{2.56817031e+00,-6.60305560e-01,-4.78271455e-01,3.98533456e-02,1.15483124e-02,-8.40987661e-04,-7.19809759e-05,1.16106103e-05},{2.00888062e+00,1.45941991e-02,-1.71160640e-03,-7.72640167e-04,5.23066155e-05,1.03538950e-05,-8.13171368e-07,-2.21520455e-08}},
+  {{1.21438723e+01,-2.02694283e+01,-2.17591763e+00,9.74804521e-01,2.92044971e-02,-2.35620677e-03,2.89432658e-03,-6.04185159e-04},{7.31990576e+00,1.22922144e+01,3.31477284e+00,-2.44653440e+00,-4.54406798e-01,1.16226070e-01,-2.09270837e-03,2.56436062e-04},{-2.30635405e+00,-9.89030898e-01,4.25005555e-01,5.60271889e-02,-9.83738340e-03,-9.75677394e-04,4.48902792e-05,8.87115675e-06},{2.01334858e+00,-1.30667929e-02,-2.52595288e-03,6.80837955e-04,7.01942481e-05,-8.47111460e-06,-8.45789316e-07,-2.87386032e-10}},
+  {{-3.13145943e+01,6.43187237e+00,6.49574471e+00,-4.81293112e-01,-2.38470227e-01,2.92178299e-02,8.39671027e-03,-2.61146203e-03},{-1.29695451e+00,-1.62833958e+01,4.62258530e+00,3.35664940e+00,-7.16544390e-01,-2.54214227e-01,5.93223237e-02,1.32024372e-02},{1.55711889e-01,1.82252228e+00,-3.13561149e-02,-1.05073534e-01,1.00934168e-03,2.00191955e-03,-1.91652452e-05,-2.74867325e-05},{1.97627270e+00,9.05227032e-04,4.67141764e-03,-5.38548447e-05,-1.33873866e-04,1.13904036e-06,1.87716500e-06,-1.93976497e-08}},
+  {{2.74121056e+01,1.29302940e+01,-4.99513245e+00,-7.13332236e-01,1.11566283e-01,2.20447220e-02,1.17782946e-03,-1.16889214e-03},{-6.11028624e+00,1.23835433e+00,-5.79582119e+00,5.93248308e-01,8.53852868e-01,-1.15087889e-02,-4.57709171e-02,-6.82335859e-03},{2.12275386e+00,-1.14852679e+00,-3.89160097e-01,6.36345744e-02,8.82166158e-03,-1.02508394e-03,-3.32721247e-05,7.28487839e-06},{2.01552916e+00,1.20087946e-02,-2.91853282e-03,-6.20851119e-04,7.83554933e-05,7.43916416e-06,-8.42272527e-07,8.38930081e-09}},
+  {{1.51222432e+00,-2.17218304e+01,-3.98410708e-01,1.04523575e+00,2.89259795e-02,2.49218638e-03,-1.78611735e-04,-8.94797733e-04},{1.03116150e+01,1.29398623e+01,-1.30957448e+00,-3.08071613e+00,-8.86668414e-02,1.30362406e-01,1.06084440e-02,6.27347501e-03},{-2.66326761e+00,-4.69373077e-01,4.99024510e-01,3.01439911e-02,-1.23436907e-02,-7.40881253e-04,8.91275486e-05,1.27419535e-05},{2.00630260e+00,-1.51612815e-02,-1.23525329e-03,8.10090220e-04,4.12342961e-05,-1.13127617e-05,-7.67413724e-07,3.80708229e-08}},
+  {{-2.67197762e+01,1.30054646e+01,5.33788729e+00,-9.16283429e-01,-1.36954978e-01,4.14930470e-02,-1.42327475e-03,-2.26945430e-03},{-5.43579769e+00,-1.03566256e+01,8.46548462e+00,1.31981921e+00,-1.11677325e+00,-1.99312717e-02,7.20222443e-02,-7.05775525e-03},{1.02066088e+00,1.69150639e+00,-2.04675138e-01,-9.63863656e-02,6.49775751e-03,1.75763154e-03,-1.19208467e-04,-2.14875508e-05},{1.97794509e+00,5.92606794e-03,4.32434119e-03,-3.50414601e-04,-1.21618796e-04,7.25999780e-06,1.59618730e-06,-1.18259592e-07}},
+  {{3.23143044e+01,6.80007935e+00,-5.92449808e+00,-3.87839496e-01,1.67797893e-01,1.70370638e-02,-4.03259089e-03,-1.41118525e-03},{-4.40798712e+00,-2.85180545e+00,-3.51725340e+00,2.20105171e+00,5.83237231e-01,-1.72619030e-01,-4.45526280e-02,7.28400284e-03},{1.46001732e+00,-1.51719403e+00,-2.64485240e-01,8.06210861e-02,5.70879830e-03,-1.10292772e-03,-1.14840705e-05,3.31738761e-06},{2.02060413e+00,8.23142659e-03,-3.81942396e-03,-4.17921023e-04,9.59452009e-05,4.56886983e-06,-7.90287231e-07,1.73368200e-08}},
+  {{-9.23648548e+00,-2.10299149e+01,1.49127769e+00,1.10490966e+00,2.46800780e-02,-4.97106742e-03,-4.06683609e-03,-1.00188644e-03},{1.21183310e+01,8.86986446e+00,-6.11893940e+00,-2.72775221e+00,3.67402822e-01,1.78690523e-01,1.60216596e-02,-3.31234094e-03},{-2.74630237e+00,1.04346596e-01,5.24059117e-01,-4.32205910e-04,-1.39093660e-02,-3.34513927e-04,1.42168865e-04,1.32319274e-05},{1.99862814e+00,-1.57164726e-02,2.10562794e-04,8.63087364e-04,4.87833722e-06,-1.35433356e-05,-4.96249129e-07,9.39536093e-08}},
+  {{-1.92481499e+01,1.80801067e+01,3.60998249e+00,-1.12656927e+00,-3.62343490e-02,2.76769642e-02,-6.23373082e-03,-5.34783394e-05},{-8.70273781e+00,-2.13979554e+00,8.89816666e+00,-9.92034197e-01,-9.24290836e-01,1.58094600e-01,2.84234788e-02,-1.46816596e-02},{1.77965391e+00,1.38137996e+00,-3.53468299e-01,-7.62947276e-02,1.08552054e-02,1.22536777e-03,-1.82434771e-04,-9.42933093e-06},{1.98192489e+00,1.03038223e-02,3.50733777e-03,-6.00659580e-04,-9.37493824e-05,1.18381631e-05,1.00388593e-06,-1.71840284e-07}},
+  {{3.40219460e+01,1.79721713e-02,-6.23115110e+00,2.19254456e-02,1.89346030e-01,-1.93730043e-03,-6.61621802e-03,1.18335294e-04},{-2.62418604e+00,-4.10609818e+00,4.76987839e-01,2.81792974e+00,-2.51452737e-02,-2.48942733e-01,1.91010884e-03,1.57267470e-02},{6.48224831e-01,-1.73242128e+00,-1.16605893e-01,9.01601389e-02,2.44469545e-03,-1.12710136e-03,-2.54882389e-06,1.00622901e-06},{2.02358866e+00,3.64729180e-03,-4.34119115e-03,-1.83211858e-04,1.05412422e-04,1.89202535e-06,-7.33965805e-07,1.03613473e-08}},
+  {{-1.89114895e+01,-1.81545601e+01,3.40654540e+00,1.10396183e+00,-1.81142651e-02,-2.38094982e-02,-6.54073618e-03,-2.33854284e-04},{1.19910774e+01,1.05427802e+00,-9.28593349e+00,-1.27007198e+00,8.73030126e-01,1.71188220e-01,-2.12689824e-02,-1.50846699e-02},{-2.54606795e+00,6.73864543e-01,4.94648218e-01,-3.29149142e-02,-1.40374703e-02,2.41753034e-04,1.85217170e-04,7.90141894e-06},{1.99111545e+00,-1.46465665e-02,1.66743691e-03,8.26212927e-04,-3.59901605e-05,-1.44208534e-05,2.45119369e-09,1.49560321e-07}},
+  {{-9.62034512e+00,2.11352577e+01,1.63650703e+00,-1.15718603e+00,1.76591463e-02,8.73146299e-03,-4.40986967e-03,9.76796728e-04},{-1.04359760e+01,5.34368896e+00,6.11368990e+00,-2.56661463e+00,-4.24881250e-01,1.87834740e-01,-1.06976647e-02,-4.63001663e-03},{2.35410643e+00,9.27894831e-01,-4.61010188e-01,-4.80995327e-02,1.34662818e-02,5.59262524e-04,-1.95326968e-04,3.18571324e-06},{1.98779750e+00,1.35737266e-02,2.32418953e-03,-7.74834247e-04,-5.58147440e-05,1.41450264e-05,3.09556640e-07,-1.67962071e-07}},
+  {{3.24019775e+01,-6.73733568e+00,-5.86325264e+00,4.21151310e-01,1.58302277e-01,-1.97410770e-02,-3.37782339e-03,1.50020863e-03},{-6.18075967e-01,-1.85719919e+00,4.39991856e+00,2.10717368e+00,-6.17550790e-01,-1.61551014e-01,4.69573140e-02,6.59145135e-03},{-2.29609072e-01,-1.77496803e+00,4.12528850e-02,9.20130014e-02,-8.60045606e-04,-1.13017438e-03,7.39403163e-07,5.65056610e-07},{2.02418065e+00,-1.29152357e-03,-4.44396539e-03,6.47489069e-05,1.07214517e-04,-6.61111415e-07,-7.20699688e-07,-3.84705112e-09}},
+  {{-2.64773235e+01,-1.32731304e+01,5.14180136e+00,9.41970110e-01,-1.12653039e-01,-4.09462266e-02,-2.99992459e-03,1.92634156e-03},{9.90918636e+00,-7.93471909e+00,-9.33384228e+00,1.00223529e+00,1.12737989e+00,9.83255357e-03,-6.98524043e-02,-9.10938997e-03},{-2.08256006e+00,1.17870247e+00,4.11027402e-01,-6.35221228e-02,-1.23462081e-02,9.11638781e-04,1.94878216e-04,-3.09201891e-06},{1.98454189e+00,-1.20353019e-02,2.97689321e-03,6.95050461e-04,-7.63905264e-05,-1.32445766e-05,6.69507244e-07,1.76711879e-07}},
+  {{1.13620055e+00,2.19395294e+01,-3.44135225e-01,-1.10345721e+00,3.13341469e-02,1.55376969e-04,-4.57078073e-04,9.54810414e-04},{-1.04587307e+01,9.47194672e+00,1.53931665e+00,-3.00564480e+00,6.94462433e-02,1.48108467e-01,-1.10679334e-02,4.73301765e-03},{2.68485284e+00,3.81972492e-01,-5.16848326e-01,-1.59972105e-02,1.41782770e-02,-7.63352728e-05,-1.65527468e-04,1.14705417e-05},{1.99495256e+00,1.54039040e-02,9.18023288e-04,-8.57104489e-04,-1.44325459e-05,1.41807132e-05,-2.84261432e-07,-1.22274116e-07}},
+  {{2.75872593e+01,-1.27995653e+01,-4.90161705e+00,7.20165312e-01,9.75127593e-02,-2.24323981e-02,1.82403671e-03,1.07069639e-03},{1.76294255e+00,3.13292718e+00,6.50502205e+00,4.61476892e-01,-8.52941692e-01,1.89404376e-03,4.46641110e-02,-7.85434805e-03},{-1.08399653e+00,-1.64108586e+00,1.95587784e-01,8.61444473e-02,-4.15197434e-03,-1.11857266e-03,6.01628881e-06,1.97392683e-06},{2.02232027e+00,-6.10458851e-03,-4.12012357e-03,3.08057322e-04,1.01463535e-04,-3.26049599e-06,-7.60015666e-07,-1.54795146e-08}},
+  {{-3.11942406e+01,-6.84249449e+00,6.38046551e+00,5.52758574e-01,-2.21255749e-01,-3.45246568e-02,6.69704517e-03,2.87639932e-03},{6.45825291e+00,-1.50222521e+01,-5.89721775e+00,3.15080357e+00,8.03701580e-01,-2.30672985e-01,-6.50062039e-02,1.13742221e-02},{-1.40331626e+00,1.56309116e+00,2.80285239e-01,-8.79885554e-02,-8.77744053e-03,1.52958848e-03,1.55468937e-04,-1.61408461e-05},{1.97958958e+00,-8.13816022e-03,3.98529554e-03,4.78379923e-04,-1.09889719e-04,-9.71033023e-06,1.33892343e-06,1.51078552e-07}},
+  {{1.18203897e+01,2.05112514e+01,-2.20806670e+00,-1.01981878e+00,3.83118913e-02,4.25893581e-03,2.74344743e-03,6.07922382e-04},{-9.25056839e+00,9.18223953e+00,-2.93044448e+00,-2.37606645e+00,4.73492622e-01,1.25109076e-01,-2.38468638e-03,-1.76856542e-04},{2.73829365e+00,-1.97248027e-01,-5.17551959e-01,1.59069244e-02,1.32420491e-02,-5.68605785e-04,-1.14409217e-04,1.35846358e-05},{2.00264859e+00,1.56273693e-02,-5.52235288e-04,-8.45956733e-04,2.45777665e-05,1.25013503e-05,-6.65071354e-07,-6.34686046e-08}},
+  {{1.99906178e+01,-1.75911636e+01,-3.51531410e+00,8.94813657e-01,4.71194386e-02,-1.21247647e-02,3.92711489e-03,-5.64381153e-05},{4.64906454e+00,8.86849689e+00,5.85064173e+00,-1.32812250e+00,-7.10132420e-01,1.00936182e-01,1.15200020e-02,-8.72343779e-03},{-1.82775009e+00,-1.34266138e+00,3.32988292e-01,7.26797953e-02,-7.35728629e-03,-1.07200525e-03,2.08378460e-05,5.22082746e-06},{2.01819587e+00,-1.03214830e-02,-3.39401350e-03,5.28573000e-04,8.78321298e-05,-6.04033539e-06,-8.22091977e-07,-1.51192019e-08}},
+  {{-3.26513748e+01,4.24995601e-01,6.82374477e+00,-8.29681102e-03,-2.71147341e-01,-4.68604878e-04,1.24147153e-02,-6.70273266e-07},{2.31216812e+00,-1.78365211e+01,-1.70841038e-01,4.01241827e+00,-2.23272275e-02,-3.42204213e-01,2.55098543e-03,2.20453069e-02},{-5.78544497e-01,1.78323007e+00,1.16336711e-01,-1.02457739e-01,-3.72895482e-03,1.92759477e-03,7.00896853e-05,-2.56364183e-05},{1.97677374e+00,-3.36174434e-03,4.56723152e-03,1.99606366e-04,-1.30172572e-04,-4.19543721e-06,1.79115193e-06,7.05189578e-08}},
+  {{2.12606812e+01,1.70524769e+01,-3.86908436e+00,-8.90542030e-01,6.74042106e-02,1.54332956e-02,3.51386401e-03,-2.16454326e-04},{-7.55097055e+00,5.38401651e+00,-5.62155533e+00,-9.21371877e-01,7.77512610e-01,8.49523544e-02,-2.11505350e-02,-9.11702402e-03},{2.50973010e+00,-7.49647558e-01,-4.66050535e-01,4.43145707e-02,1.11256801e-02,-8.82021151e-04,-6.42500090e-05,1.09483772e-05},{2.01009130e+00,1.42503632e-02,-1.93363300e-03,-7.51183019e-04,5.73096804e-05,9.86953182e-06,-8.27444467e-07,-1.53783439e-08}},
+  {{1.03261604e+01,-2.06738052e+01,-1.87149620e+00,9.88016844e-01,2.79122889e-02,-7.60309631e-04,2.45712115e-03,-6.73107919e-04},{7.87414312e+00,1.27399349e+01,2.59117007e+00,-2.62158108e+00,-3.93631905e-01,1.16638109e-01,-1.68928632e-03,2.21516867e-03},{-2.38458133e+00,-9.06733334e-01,4.40586120e-01,5.20389900e-02,-1.03074741e-02,-9.46059823e-04,5.13024715e-05,9.62859758e-06},{2.01222658e+00,-1.35202501e-02,-2.32272339e-03,7.07291649e-04,6.58479912e-05,-8.96904567e-06,-8.42632971e-07,4.66299976e-09}},
+  {{-3.07320309e+01,7.66946936e+00,6.34635353e+00,-5.72314084e-01,-2.23852560e-01,3.36633287e-02,6.74525509e-03,-2.85124872e-03},{-2.03384781e+00,-1.55203381e+01,5.49908209e+00,3.07249951e+00,-8.30620289e-01,-2.18107179e-01,6.68728426e-02,9.76008177e-03},{3.06231469e-01,1.81352401e+00,-6.16443120e-02,-1.04475118e-01,1.98234688e-03,1.98495970e-03,-3.75547643e-05,-2.70655710e-05},{1.97638738e+00,1.78003812e-03,4.64756228e-03,-1.05849183e-04,-1.33027483e-04,2.23550273e-06,1.85752606e-06,-3.79577649e-08}},
+  {{2.84926853e+01,1.19219723e+01,-5.19881010e+00,-6.64429605e-01,1.22332931e-01,2.23842934e-02,3.39248742e-04,-1.33014051e-03},{-5.82501268e+00,3.73163760e-01,-5.57428312e+00,9.16193068e-01,8.37328553e-01,-3.93103734e-02,-4.90615107e-02,-4.89026122e-03},{2.02354097e+00,-1.22045755e+00,-3.70110542e-01,6.70118555e-02,8.31077527e-03,-1.04400096e-03,-2.84286834e-05,6.52957897e-06},{2.01651573e+00,1.14399176e-02,-3.09499586e-03,-5.89361298e-04,8.19218476e-05,6.94034770e-06,-8.36650372e-07,1.13181251e-08}},
+  {{-4.12401885e-01,-2.17553139e+01,-7.10689947e-02,1.05662942e+00,2.94518042e-02,2.14898400e-03,-8.36703577e-04,-9.31734976e-04},{1.07379227e+01,1.25752239e+01,-2.19375420e+00,-3.09520006e+00,-1.64400991e-02,1.37240753e-01,1.36638032e-02,5.65533899e-03},{-2.69683695e+00,-3.74155819e-01,5.06852746e-01,2.52143424e-02,-1.26874549e-02,-6.84522733e-04,9.78940807e-05,1.31442202e-05},{2.00502133e+00,-1.53658213e-02,-9.96794552e-04,8.24783463e-04,3.55207121e-05,-1.17516120e-05,-7.36570598e-07,4.66404479e-08}},
+  {{-2.55907593e+01,1.40266457e+01,5.06452942e+00,-9.69610751e-01,-1.17197305e-01,4.04558890e-02,-2.83059943e-03,-1.89116341e-03},{-6.07375860e+00,-8.99928474e+00,8.79778481e+00,8.98184717e-01,-1.12107408e+00,2.05744170e-02,6.70193508e-02,-9.83908586e-03},{1.15917373e+00,1.65043056e+00,-2.32156485e-01,-9.36891586e-02,7.33828591e-03,1.68361957e-03,-1.33150417e-04,-1.97271147e-05},{1.97847056e+00,6.72777742e-03,4.21578158e-03,-3.97072581e-04,-1.17840362e-04,8.17330874e-06,1.51218364e-06,-1.31233577e-07}},
+  {{3.28498650e+01,5.62950087e+00,-6.02654123e+00,-3.19125235e-01,1.75150856e-01,1.44013567e-02,-4.85463394e-03,-1.24863256e-03},{-4.12363958e+00,-3.32094312e+00,-2.88804841e+00,2.40001988e+00,4.93037760e-01,-1.96362868e-01,-3.89183573e-02,9.78948455e-03},{1.33029580e+00,-1.56501305e+00,-2.40611792e-01,8.27625990e-02,5.16025722e-03,-1.10945944e-03,-9.25484164e-06,2.79414394e-06},{2.02126575e+00,7.49674067e-03,-3.93559784e-03,-3.79721489e-04,9.80953628e-05,4.10003668e-06,-7.79206289e-07,1.70502705e-08}},
+  {{-1.10532074e+01,-2.06747341e+01,1.83103633e+00,1.11123061e+00,2.07731556e-02,-7.63228955e-03,-4.71390272e-03,-9.62969672e-04},{1.22485962e+01,7.71951008e+00,-6.84476089e+00,-2.55018640e+00,4.57852066e-01,1.85268834e-01,1.26382662e-02,-5.90371806e-03},{-2.73161340e+00,2.02998534e-01,5.22885263e-01,-5.90722589e-03,-1.40430517e-02,-2.47434131e-04,1.50795604e-04,1.27708881e-05},{1.99731934e+00,-1.56465303e-02,4.61396674e-04,8.63272871e-04,-1.85741965e-06,-1.38068863e-05,-4.27184546e-07,1.04092621e-07}},
+  {{-1.76775494e+01,1.87728577e+01,3.27113199e+00,-1.14218199e+00,-2.29803249e-02,2.40833554e-02,-6.27559749e-03,2.44023395e-04},{-9.11428356e+00,-6.92965150e-01,8.60679913e+00,-1.34130287e+00,-8.47362936e-01,1.73384354e-01,1.94247663e-02,-1.38539616e-02},{1.89180148e+00,1.31300282e+00,-3.74946386e-01,-7.19555467e-02,1.14296004e-02,1.11669360e-03,-1.88168240e-04,-7.16473323e-06},{1.98280621e+00,1.09463381e-02,3.32808401e-03,-6.36106415e-04,-8.78218198e-05,1.23962946e-05,8.86770522e-07,-1.75052605e-07}},
+  {{3.39703979e+01,-1.19613910e+00,-6.21332932e+00,9.64431763e-02,1.87487364e-01,-5.72622009e-03,-6.43789768e-03,4.54831024e-04},{-2.31268430e+00,-3.95975280e+00,1.23302758e+00,2.78587174e+00,-1.43267706e-01,-2.44905263e-01,1.17927501e-02,1.53401876e-02},{5.01291990e-01,-1.75182116e+00,-9.01168734e-02,9.10048410e-02,1.88437093e-03,-1.12847821e-03,-1.80828954e-06,8.03544367e-07},{2.02385855e+00,2.82003451e-03,-4.38805204e-03,-1.41518802e-04,1.06233492e-04,1.45375782e-06,-7.27863210e-07,8.19064727e-09}},
+  {{-2.04204712e+01,-1.74257126e+01,3.73240399e+00,1.08958054e+00,-3.13047729e-02,-2.75361892e-02,-6.47636969e-03,6.77236094e-05},{1.17631321e+01,-5.19088030e-01,-9.54720879e+00,-9.10654128e-01,9.47074592e-01,1.54544815e-01,-3.08883060e-02,-1.56256873e-02},{-2.48450422e+00,7.65659869e-01,4.84078199e-01,-3.83542553e-02,-1.38825746e-02,3.52180679e-04,1.89769373e-04,6.37411949e-06},{1.98991418e+00,-1.43043697e-02,1.90429483e-03,8.10380792e-04,-4.30433138e-05,-1.43783500e-05,1.07254458e-07,1.56961661e-07}},
+  {{-7.77162313e+00,2.14386158e+01,1.28318501e+00,-1.15134978e+00,2.21140776e-02,6.27694046e-03,-3.74664553e-03,1.01731066e-03},{-1.05450735e+01,6.35214376e+00,5.38213253e+00,-2.72648644e+00,-3.32045436e-01,1.82275087e-01,-1.34009477e-02,-2.29436974e-03},{2.42830610e+00,8.39995503e-01,-4.74235624e-01,-4.27975319e-02,1.37157952e-02,4.45128244e-04,-1.92749198e-04,4.99272664e-06},{1.98894310e+00,1.39903584e-02,2.09646136e-03,-7.95352738e-04,-4.88445839e-05,1.42982726e-05,1.97169001e-07,-1.62374619e-07}},
+  {{3.17695942e+01,-7.87320614e+00,-5.73100328e+00,4.82938707e-01,1.48504123e-01,-2.14809757e-02,-2.41613039e-03,1.55296526e-03},{-2.52850085e-01,-1.12871516e+00,4.94522285e+00,1.86285615e+00,-6.90239489e-01,-1.33635417e-01,5.04266992e-02,3.78560252e-03},{-3.78764987e-01,-1.76423728e+00,6.80716187e-02,9.15448815e-02,-1.42119220e-03,-1.12934690e-03,1.28990746e-06,6.75140029e-07},{2.02403140e+00,-2.13066256e-03,-4.41803364e-03,1.06870342e-04,1.06758016e-04,-1.09431983e-06,-7.23953576e-07,-6.27316776e-09}},
+  {{-2.75252438e+01,-1.22321472e+01,5.40383482e+00,8.89900208e-01,-1.32574648e-01,-4.20291461e-02,-1.56786421e-03,2.30316888e-03},{9.39447594e+00,-9.38954449e+00,-8.96684647e+00,1.42290199e+00,1.11663377e+00,-3.20023224e-02,-7.42302835e-02,-5.99008612e-03},{-1.98039520e+00,1.25364816e+00,3.91774774e-01,-6.82149604e-02,-1.18652424e-02,1.02475844e-03,1.91790721e-04,-5.30547049e-06},{1.98357272e+00,-1.14526637e-02,3.17275291e-03,6.63697720e-04,-8.27376862e-05,-1.28069632e-05,7.88759792e-07,1.76452275e-07}},
+  {{3.05724978e+00,2.18419857e+01,-6.83080971e-01,-1.09051025e+00,3.20238434e-02,5.83093752e-05,2.06262761e-04,9.12099087e-04},{-1.03090477e+01,9.72027969e+00,6.90537989e-01,-2.96504879e+00,1.46618754e-01,1.42200693e-01,-8.74051265e-03,4.90551256e-03},{2.71351027e+00,2.84231275e-01,-5.20756245e-01,-1.04609234e-02,1.41215781e-02,-1.71900203e-04,-1.57644536e-04,1.22566044e-05},{1.99624372e+00,1.55544123e-02,6.68376626e-04,-8.61495617e-04,-7.50684785e-06,1.39935100e-05,-3.65168859e-07,-1.12397757e-07}},
+  {{2.64282246e+01,-1.37471247e+01,-4.68133020e+00,7.59254038e-01,8.68119895e-02,-2.12522838e-02,2.49737781e-03,8.68839386e-04},{2.21322942e+00,4.16774035e+00,6.59991026e+00,1.33181632e-01,-8.50124776e-01,2.67773941e-02,3.95897813e-02,-9.30058397e-03},{-1.22017133e+00,-1.60117447e+00,2.20443234e-01,8.43728259e-02,-4.70495131e-03,-1.11393293e-03,7.67096117e-06,2.40176473e-06},{2.02176690e+00,-6.87399413e-03,-4.02333681e-03,3.47568828e-04,9.97021270e-05,-3.71768670e-06,-7.70257031e-07,-1.64929883e-08}},
+  {{-3.16875534e+01,-5.59977245e+00,6.52061701e+00,4.62727040e-01,-2.36114621e-01,-3.00909653e-02,8.34863540e-03,2.62730010e-03},{5.78157425e+00,-1.58623304e+01,-4.99979782e+00,3.42134786e+00,6.83826089e-01,-2.65206486e-01,-5.64715229e-02,1.46677438e-02},{-1.27108586e+00,1.61273503e+00,2.54263848e-01,-9.12242532e-02,-8.00480973e-03,1.61666120e-03,1.43756828e-04,-1.81558680e-05},{1.97895324e+00,-7.37462752e-03,4.11626697e-03,4.34484478e-04,-1.14397582e-04,-8.88970681e-06,1.43662555e-06,1.40831503e-07}},
+  {{1.35996609e+01,2.00378704e+01,-2.51769495e+00,-1.00169945e+00,4.13504988e-02,5.98096382e-03,3.10725183e-03,5.06985874e-04},{-8.97128963e+00,8.69602299e+00,-3.56983018e+00,-2.16926980e+00,5.36205173e-01,1.21794753e-01,-3.41147673e-03,-2.04666913e-03},{2.71857643e+00,-2.94497490e-01,-5.12236118e-01,2.10476685e-02,1.29496409e-02,-6.34122000e-04,-1.05295279e-04,1.33923977e-05},{2.00395155e+00,1.55009935e-02,-7.96881795e-04,-8.35220038e-04,3.06464972e-05,1.20990080e-05,-7.06647768e-07,-5.40800436e-08}},
+  {{1.84105244e+01,-1.82634659e+01,-3.23968554e+00,9.15035546e-01,4.13516425e-02,-9.85058956e-03,3.87728331e-03,-2.10867467e-04},{5.18866873e+00,9.76804733e+00,5.44469023e+00,-1.60459268e+00,-6.60696089e-01,1.07765995e-01,6.58710022e-03,-7.18824472e-03},{-1.93701375e+00,-1.27714396e+00,3.53643000e-01,6.96500763e-02,-7.88191892e-03,-1.05753378e-03,2.48066826e-05,5.92365086e-06},{2.01729441e+00,-1.09451283e-02,-3.23379203e-03,5.62315923e-04,8.46830735e-05,-6.53096595e-06,-8.30569718e-07,-1.32701325e-08}},
+  {{-3.25518761e+01,1.72502792e+00,6.80473804e+00,-1.12561986e-01,-2.69666225e-01,6.55176817e-03,1.22081647e-02,-6.84207771e-04},{1.57096827e+00,-1.77896996e+01,9.00446355e-01,3.97328854e+00,-1.83411613e-01,-3.36620361e-01,1.64831132e-02,2.14362275e-02},{-4.29947495e-01,1.80182981e+00,8.65041986e-02,-1.03697620e-01,-2.77812802e-03,1.96292368e-03,5.24726056e-05,-2.65183389e-05},{1.97653651e+00,-2.49868981e-03,4.61656647e-03,1.48485720e-04,-1.31928056e-04,-3.13002147e-06,1.83203247e-06,5.29407842e-08}},
+  {{2.27112503e+01,1.62561684e+01,-4.13124943e+00,-8.59092474e-01,7.56640658e-02,1.73442215e-02,3.25120939e-03,-4.20288881e-04},{-7.25369167e+00,4.49914646e+00,-5.82000875e+00,-6.07029498e-01,8.11717272e-01,6.96669146e-02,-2.68152393e-02,-9.59184114e-03},{2.44381952e+00,-8.36582482e-01,-4.52545643e-01,4.86074276e-02,1.06834136e-02,-9.18623002e-04,-5.69656877e-05,1.02369077e-05},{2.01127172e+00,1.38650006e-02,-2.14916840e-03,-7.27795181e-04,6.20736537e-05,9.37748791e-06,-8.37271330e-07,-9.25104349e-09}},
+  {{8.48194408e+00,-2.10109978e+01,-1.56396961e+00,1.00037134e+00,2.73482241e-02,5.48430369e-04,1.96815818e-03,-7.30448228e-04},{8.42105484e+00,1.30565281e+01,1.81777251e+00,-2.77009821e+00,-3.31504226e-01,1.17366090e-01,-2.16650049e-04,3.90198780e-03},{-2.45567060e+00,-8.21649730e-01,4.54963177e-01,4.78715077e-02,-1.07612731e-02,-9.12493968e-04,5.82008106e-05,1.03623188e-05},{2.01106906e+00,-1.39342379e-02,-2.11214158e-03,7.31966633e-04,6.12591830e-05,-9.46326691e-06,-8.35794822e-07,1.02740501e-08}},
+  {{-3.00491161e+01,8.87218380e+00,6.17190886e+00,-6.57306671e-01,-2.07374588e-01,3.71353067e-02,4.97669540e-03,-2.94830068e-03},{-2.76213527e+00,-1.46234283e+01,6.29745245e+00,2.74838209e+00,-9.27045941e-01,-1.78241402e-01,7.21728131e-02,6.07329421e-03},{4.55773026e-01,1.79889870e+00,-9.17030945e-02,-1.03502400e-01,2.94443290e-03,1.95738813e-03,-5.55733059e-05,-2.63809889e-05},{1.97657382e+00,2.64888839e-03,4.60878946e-03,-1.57406132e-04,-1.31651846e-04,3.31675778e-06,1.82563042e-06,-5.60449855e-08}},
+  {{2.94769382e+01,1.08821020e+01,-5.38533306e+00,-6.11847222e-01,1.32984936e-01,2.22142488e-02,-5.70206379e-04,-1.45027880e-03},{-5.54313660e+00,-4.47144181e-01,-5.26692772e+00,1.22792423e+00,8.07318449e-01,-6.83987364e-02,-5.10141626e-02,-2.58033676e-03},{1.91834271e+00,-1.28869236e+00,-3.50096166e-01,7.01863393e-02,7.79077644e-03,-1.06016302e-03,-2.40847476e-05,5.79862217e-06},{2.01745319e+00,1.08383438e-02,-3.26207397e-03,-5.56503946e-04,8.52424419e-05,6.44493730e-06,-8.29163241e-07,1.36298848e-08}},
+  {{-2.32436037e+00,-2.17213745e+01,2.57465839e-01,1.06774354e+00,2.96888985e-02,1.40122802e-03,-1.51251478e-03,-9.64706473e-04},{1.11243048e+01,1.20601912e+01,-3.07393742e+00,-3.07793236e+00,5.90039305e-02,1.45379677e-01,1.61600225e-02,4.49625170e-03},{-2.72232580e+00,-2.77668774e-01,5.13219178e-01,2.01597642e-02,-1.30016087e-02,-6.22989261e-04,1.06863328e-04,1.34322290e-05},{2.00372624e+00,-1.55247981e-02,-7.54541368e-04,8.37179658e-04,2.96008020e-05,-1.21697103e-05,-6.99732652e-07,5.56849535e-08}},
+  {{-2.43816376e+01,1.49926281e+01,4.77707243e+00,-1.01545048e+00,-9.80522856e-02,3.86710502e-02,-4.00699256e-03,-1.48289790e-03},{-6.68158531e+00,-7.58704329e+00,9.01854134e+00,4.75820690e-01,-1.10700321e+00,5.79304770e-02,6.04191385e-02,-1.20634427e-02},{1.29413927e+00,1.60429561e+00,-2.58817762e-01,-9.06733498e-02,8.14109668e-03,1.60181825e-03,-1.45868238e-04,-1.78116588e-05},{1.97906125e+00,7.50796497e-03,4.09398274e-03,-4.42183024e-04,-1.13629532e-04,9.03522505e-06,1.41994758e-06,-1.42703641e-07}},
+  {{3.32846832e+01,4.44894838e+00,-6.10829020e+00,-2.48538494e-01,1.81132227e-01,1.13652647e-02,-5.54907462e-03,-1.02733157e-03},{-3.83717799e+00,-3.69183898e+00,-2.21332479e+00,2.56361914e+00,3.93092841e-01,-2.16467083e-01,-3.18646356e-02,1.19735897e-02},{1.19667244e+00,-1.60823262e+00,-2.16139227e-01,8.46862569e-02,4.60852729e-03,-1.11472071e-03,-7.36752781e-06,2.32430580e-06},{2.02186441e+00,6.74101245e-03,-4.04046476e-03,-3.40713043e-04,1.00013480e-04,3.63738081e-06,-7.68391772e-07,1.63393228e-08}},
+  {{-1.28228703e+01,-2.02565670e+01,2.16938543e+00,1.11547971e+00,1.55108133e-02,-1.06270509e-02,-5.30256191e-03,-8.91515228e-04},{1.23181362e+01,6.46287775e+00,-7.51012373e+00,-2.33834100e+00,5.49529731e-01,1.89396515e-01,7.74221960e-03,-8.44073109e-03},{-2.70873165e+00,3.01201284e-01,5.20115852e-01,-1.14208460e-02,-1.41325602e-02,-1.55513204e-04,1.59023315e-04,1.21293679e-05},{1.99601960e+00,-1.55294016e-02,7.11731380e-04,8.60797940e-04,-8.70569147e-06,-1.40272432e-05,-3.51406811e-07,1.14116226e-07}},
+  {{-1.60542965e+01,1.94005127e+01,2.92875218e+00,-1.15283346e+00,-1.14304079e-02,2.05029249e-02,-6.12762058e-03,4.88718215e-04},{-9.47633171e+00,7.13044167e-01,8.22154903e+00,-1.66266870e+00,-7.63525486e-01,1.83832750e-01,1.10262549e-02,-1.24922022e-02},{1.99820614e+00,1.24070728e+00,-3.95146906e-01,-6.74023256e-02,1.19505897e-02,1.00506330e-03,-1.92392952e-04,-4.91604442e-06},{1.98373973e+00,1.15544293e-02,3.13889515e-03,-6.69205561e-04,-8.16368847e-05,1.28855227e-05,7.67942197e-07,-1.76568818e-07}},
+  {{3.38223000e+01,-2.40024948e+00,-6.17583084e+00,1.69630244e-01,1.83984458e-01,-9.34495684e-03,-6.06849091e-03,7.67033256e-04},{-1.99456155e+00,-3.70502234e+00,1.97585583e+00,2.71237350e+00,-2.58332282e-01,-2.35523447e-01,2.12501381e-02,1.43588446e-02},{3.52925777e-01,-1.76614952e+00,-6.34141415e-02,9.16268677e-02,1.32341613e-03,-1.12940080e-03,-1.18983291e-06,6.54892062e-07},{2.02405787e+00,1.98510545e-03,-4.42264136e-03,-9.95462542e-05,1.06835905e-04,1.01857290e-06,-7.23225867e-07,5.85860516e-09}},
+  {{-2.18576660e+01,-1.66434975e+01,4.05086374e+00,1.07001090e+00,-4.60804962e-02,-3.11158802e-02,-6.19602297e-03,4.15953516e-04},{1.14787226e+01,-2.11165905e+00,-9.70754337e+00,-5.28817773e-01,1.01150835e+00,1.32653207e-01,-4.05641757e-02,-1.55008286e-02},{-2.41548705e+00,8.55255723e-01,4.71952230e-01,-4.37178873e-02,-1.36732915e-02,4.64824174e-04,1.93229105e-04,4.68676808e-06},{1.98874426e+00,-1.39183532e-02,2.13601859e-03,7.91815575e-04,-5.00538445e-05,-1.42728768e-05,2.16509918e-07,1.63378331e-07}},
+  {{-5.90225506e+00,2.16762524e+01,9.32422161e-01,-1.14383399e+00,2.54513547e-02,4.21587145e-03,-3.05347564e-03,1.03275804e-03},{-1.06032715e+01,7.24643421e+00,4.60695410e+00,-2.85137701e+00,-2.41218433e-01,1.75414383e-01,-1.47786913e-02,-1.29063032e-04},{2.49517155e+00,7.49724567e-01,-4.85918432e-01,-3.74065749e-02,1.39101157e-02,3.32770840e-04,-1.89000522e-04,6.64916251e-06},{1.99012232e+00,1.43637741e-02,1.86312350e-03,-8.13146878e-04,-4.18119162e-05,1.43867055e-05,8.87601601e-08,-1.55694778e-07}},
+  {{3.10502949e+01,-8.98259640e+00,-5.58325148e+00,5.41064739e-01,1.38068959e-01,-2.26841420e-02,-1.43454678e-03,1.54308742e-03},{1.23959355e-01,-3.24228704e-01,5.42705059e+00,1.59409034e+00,-7.50303388e-01,-1.04239874e-01,5.21996133e-02,9.32847965e-04},{-5.26746154e-01,-1.74841332e+00,9.47136208e-02,9.08541232e-02,-1.98167004e-03,-1.12810731e-03,1.93828942e-06,8.38267567e-07},{2.02381110e+00,-2.96349940e-03,-4.37978981e-03,1.48758001e-04,1.06084066e-04,-1.52977657e-06,-7.28744396e-07,-8.57302052e-09}},
+  {{-2.84872665e+01,-1.11530571e+01,5.64974833e+00,8.31046522e-01,-1.52631313e-01,-4.22634892e-02,4.35038564e-05,2.62027793e-03},{8.84397125e+00,-1.07713308e+01,-8.49624443e+00,1.83400524e+00,1.08675838e+00,-7.55480453e-02,-7.65790418e-02,-2.48937891e-03},{-1.87229729e+00,1.32481909e+00,3.71209085e-01,-7.27070346e-02,-1.13301557e-02,1.13553030e-03,1.87211321e-04,-7.55561223e-06},{1.98265398e+00,-1.08345170e-02,3.35909473e-03,6.29940594e-04,-8.88494760e-05,-1.23000827e-05,9.07079198e-07,1.74540119e-07}},
+  {{4.96661758e+00,2.16834736e+01,-1.01749420e+00,-1.07724953e+00,3.27320509e-02,3.40182800e-04,8.35752115e-04,8.63829104e-04},{-1.01269588e+01,9.83454037e+00,-1.44377515e-01,-2.89417887e+00,2.21122116e-01,1.37354389e-01,-6.42975373e-03,4.57634777e-03},{2.73401070e+00,1.85862631e-01,-5.23061633e-01,-4.95273015e-03,1.40190488e-02,-2.62767513e-04,-1.49274027e-04,1.28576212e-05},{1.99754608e+00,1.56578235e-02,4.17768810e-04,-8.63196910e-04,-6.80458584e-07,1.37603392e-05,-4.39421456e-07,-1.02309464e-07}},
+  {{2.51962662e+01,-1.46557150e+01,-4.45102787e+00,7.94698536e-01,7.67205060e-02,-1.97269749e-02,3.04814498e-03,6.58531499e-04},{2.67919803e+00,5.21283102e+00,6.60983372e+00,-1.94311813e-01,-8.36583912e-01,4.88116480e-02,3.37946266e-02,-1.02165639e-02},{-1.35267830e+00,-1.55659926e+00,2.44736254e-01,8.23831484e-02,-5.25495643e-03,-1.10815477e-03,9.64067567e-06,2.88261504e-06},{2.02114940e+00,-7.62362638e-03,-3.91511805e-03,3.86321801e-04,9.77116142e-05,-4.18070431e-06,-7.80968662e-07,-1.71116223e-08}},
+  {{-3.20887222e+01,-4.33863831e+00,6.63706636e+00,3.68213862e-01,-2.48804972e-01,-2.48388425e-02,9.80155822e-03,2.24627857e-03},{5.08855677e+00,-1.65656586e+01,-4.04339790e+00,3.64730215e+00,5.49999893e-01,-2.94532418e-01,-4.60922383e-02,1.74947605e-02},{-1.13506675e+00,1.65741384e+00,2.27367774e-01,-9.41510946e-02,-7.19211204e-03,1.69646507e-03,1.30753426e-04,-2.00364193e-05},{1.97838128e+00,-6.58811955e-03,4.23428090e-03,3.88940447e-04,-1.18490119e-04,-8.01467013e-06,1.52681912e-06,1.29009905e-07}},
+  {{1.53385372e+01,1.95104313e+01,-2.82155132e+00,-9.82350469e-01,4.52274419e-02,7.88406841e-03,3.39069800e-03,3.88669665e-04},{-8.68242168e+00,8.11421680e+00,-4.14860153e+00,-1.93965912e+00,5.96263766e-01,1.17578954e-01,-5.49847912e-03,-3.93871078e-03},{2.69072914e+00,-3.90641809e-01,-5.05436480e-01,2.60701794e-02,1.26259131e-02,-6.94354298e-04,-9.63293569e-05,1.30737753e-05},{2.00524282e+00,1.53286597e-02,-1.03813002e-03,-8.22134782e-04,3.65145097e-05,1.16734545e-05,-7.41997496e-07,-4.51208102e-08}},
+  {{1.67766190e+01,-1.88875599e+01,-2.95807648e+00,9.33425069e-01,3.66210304e-02,-7.62398075e-03,3.72757996e-03,-3.44440748e-04},{5.73740625e+00,1.05987463e+01,4.96467352e+00,-1.86343169e+00,-6.07812405e-01,1.12212241e-01,2.61453539e-03,-5.34166908e-03},{-2.04047799e+00,-1.20782554e+00,3.73367876e-01,6.64162412e-02,-8.39815568e-03,-1.04051782e-03,2.92576224e-05,6.65578227e-06},{2.01634240e+00,-1.15371384e-02,-3.06396605e-03,5.94747893e-04,8.12909129e-05,-7.02554235e-06,-8.37484720e-07,-1.08226592e-08}},
+  {{-3.23585701e+01,3.02139688e+00,6.75953245e+00,-2.15975434e-01,-2.65175849e-01,1.33717023e-02,1.16249640e-02,-1.32896740e-03},{8.26336265e-01,-1.75898800e+01,1.95613015e+00,3.87906861e+00,-3.40465069e-01,-3.23574215e-01,2.98287794e-02,2.00817864e-02},{-2.80105323e-01,1.81483233e+00,5.63770458e-02,-1.04566433e-01,-1.81301695e-03,1.98782305e-03,3.43602987e-05,-2.71443878e-05},{1.97637069e+00,-1.62802462e-03,4.65107383e-03,9.68007225e-05,-1.33160094e-04,-2.04463413e-06,1.86091904e-06,3.47334463e-08}},
+  {{2.40982018e+01,1.54145079e+01,-4.38438559e+00,-8.24567616e-01,8.47510174e-02,1.90656744e-02,2.85726064e-03,-6.32702489e-04},{-6.95823574e+00,3.59259319e+00,-5.93364859e+00,-2.83628821e-01,8.37755859e-01,5.13680428e-02,-3.25692445e-02,-9.55757499e-03},{2.37064171e+00,-9.20867980e-01,-4.37806249e-01,5.27243093e-02,1.02236224e-02,-9.51056252e-04,-5.01585346e-05,9.49134210e-06},{2.01241875e+00,1.34393722e-02,-2.35765520e-03,-7.02570251e-04,6.65949556e-05,8.88026807e-06,-8.43087548e-07,-3.78300591e-09}},
+  {{6.60918522e+00,-2.12924366e+01,-1.25183797e+00,1.01262903e+00,2.73227040e-02,1.56118080e-03,1.43506075e-03,-7.80769391e-04},{8.95326233e+00,1.32432632e+01,1.00596678e+00,-2.89354849e+00,-2.68090367e-01,1.18991442e-01,2.10634409e-03,5.22120111e-03},{-2.51940799e+00,-7.34017909e-01,4.68086451e-01,4.35319357e-02,-1.11967726e-02,-8.74711550e-04,6.55615149e-05,1.10580813e-05},{2.00987935e+00,-1.43074468e-02,-1.89475110e-03,7.54769542e-04,5.64307338e-05,-9.95145547e-06,-8.24836491e-07,1.65381611e-08}},
+  {{-2.92746563e+01,1.00488644e+01,5.97516394e+00,-7.36743748e-01,-1.89444587e-01,3.96496505e-02,3.15849949e-03,-2.91330554e-03},{-3.47872210e+00,-1.36094484e+01,7.01330853e+00,2.39221358e+00,-1.00532103e+00,-1.35985300e-01,7.52092823e-02,2.30155885e-03},{6.03885531e-01,1.77869844e+00,-1.21426605e-01,-1.02160543e-01,3.89055908e-03,1.91947003e-03,-7.30497341e-05,-2.54433198e-05},{1.97683144e+00,3.50902765e-03,4.55525285e-03,-2.08323981e-04,-1.29756052e-04,4.37581230e-06,1.78186258e-06,-7.34435517e-08}},
+  {{3.03797588e+01,9.80867386e+00,-5.55760098e+00,-5.55456102e-01,1.43456161e-01,2.15254910e-02,-1.52992806e-03,-1.52223976e-03},{-5.26210546e+00,-1.21433794e+00,-4.88254786e+00,1.52495861e+00,7.64155567e-01,-9.80485082e-02,-5.14918827e-02,6.04000149e-07},{1.80747712e+00,-1.35304964e+00,-3.29176813e-01,7.31544271e-02,7.26297777e-03,-1.07385567e-03,-2.02234096e-05,5.10007430e-06},{2.01833868e+00,1.02058873e-02,-3.41937342e-03,-5.22375689e-04,8.83188623e-05,5.95394022e-06,-8.20223192e-07,1.53495865e-08}},
+  {{-4.23383617e+00,-2.16249771e+01,5.90268373e-01,1.07870603e+00,2.94295587e-02,2.45426840e-04,-2.20647221e-03,-9.92142246e-04},{1.14650745e+01,1.14034472e+01,-3.94118595e+00,-3.02942634e+00,1.38020292e-01,1.54433519e-01,1.78083014e-02,2.85397982e-03},{-2.73965597e+00,-1.80193990e-01,5.18091083e-01,1.49926562e-02,-1.32836448e-02,-5.56200161e-04,1.15952396e-04,1.35911559e-05},{2.00242090e+00,-1.56376082e-02,-5.09179896e-04,8.47203075e-04,2.34861127e-05,-1.25634642e-05,-6.56623740e-07,6.51334346e-08}},
+  {{-2.30898724e+01,1.59123993e+01,4.47552109e+00,-1.05470908e+00,-7.96775222e-02,3.62616442e-02,-4.94620763e-03,-1.06567401e-03},{-7.25572395e+00,-6.13657379e+00,9.13018703e+00,5.86558841e-02,-1.07643545e+00,9.14420113e-02,5.25952429e-02,-1.36717511e-02},{1.42515206e+00,1.55325949e+00,-2.84569830e-01,-8.73539969e-02,8.90260097e-03,1.51296298e-03,-1.57267481e-04,-1.57685263e-05},{1.97971559e+00,8.26421008e-03,3.95940756e-03,-4.85583907e-04,-1.09012079e-04,9.84125199e-06,1.32050343e-06,-1.52571431e-07}},
+  {{3.36250343e+01,3.25064325e+00,-6.17098236e+00,-1.75778404e-01,1.85691103e-01,7.97245000e-03,-6.09582290e-03,-7.54006614e-04},{-3.54681802e+00,-3.96132278e+00,-1.50261891e+00,2.68976498e+00,2.85167545e-01,-2.32309282e-01,-2.36184001e-02,1.37376394e-02},{1.05954659e+00,-1.64674187e+00,-1.91132188e-01,8.63907561e-02,4.05422458e-03,-1.11890293e-03,-5.78594427e-06,1.90911783e-06},{2.02239847e+00,5.96642494e-03,-4.13379632e-03,-3.00987740e-04,1.01702324e-04,3.18069556e-06,-7.58120336e-07,1.52452007e-08}},
+  {{-1.45561762e+01,-1.97720833e+01,2.50907350e+00,1.11708593e+00,8.68977327e-03,-1.39356330e-02,-5.81326615e-03,-7.79616123e-04},{1.23252907e+01,5.11278963e+00,-8.10673523e+00,-2.09258914e+00,6.41219378e-01,1.90289736e-01,1.40882924e-03,-1.07861692e-02},{-2.67772460e+00,3.98654521e-01,5.15744448e-01,-1.69553068e-02,-1.41756823e-02,-5.90302370e-05,1.66731232e-04,1.13034885e-05},{1.99473286e+00,-1.53653100e-02,9.60789795e-04,8.55626597e-04,-1.56441420e-05,-1.42005811e-05,-2.69065509e-07,1.23887204e-07}},
+  {{-1.43679142e+01,1.99667454e+01,2.58059263e+00,-1.15919876e+00,-1.47711916e-03,1.70063153e-02,-5.81654906e-03,6.83007005e-04},{-9.78724480e+00,2.06213570e+00,7.74816132e+00,-1.95349610e+00,-6.74668014e-01,1.89816698e-01,3.51574179e-03,-1.06911547e-02},{2.09855056e+00,1.16473341e+00,-4.14010614e-01,-6.26557320e-02,1.24169160e-02,8.91346252e-04,-1.95127039e-04,-2.71121667e-06},{1.98472250e+00,1.21262884e-02,2.94045429e-03,-6.99862489e-04,-7.52279884e-05,1.33051262e-05,6.48509968e-07,-1.76446449e-07}},
+  {{3.35720367e+01,-3.60257888e+00,-6.11757994e+00,2.41769165e-01,1.78838730e-01,-1.27336038e-02,-5.51703479e-03,1.04308629e-03},{-1.66810000e+00,-3.34113050e+00,2.69542384e+00,2.59779882e+00,-3.68116856e-01,-2.21018687e-01,2.99422890e-02,1.28186941e-02},{2.03566387e-01,-1.77537131e+00,-3.65639515e-02,9.20259878e-02,7.62077398e-04,-1.12993002e-03,-6.55722999e-07,5.59668536e-07},{2.02418613e+00,1.14486669e-03,-4.44488879e-03,-5.73818070e-05,1.07220891e-04,5.85613236e-07,-7.20147057e-07,3.41349171e-09}},
+  {{-2.32266750e+01,-1.57985239e+01,4.36250687e+00,1.04416049e+00,-6.24761432e-02,-3.44383232e-02,-5.67129301e-03,8.05673073e-04},{1.11397781e+01,-3.70752168e+00,-9.75953770e+00,-1.28012598e-01,1.06372523e+00,1.05486199e-01,-4.98804301e-02,-1.46708442e-02},{-2.33922386e+00,9.42366719e-01,4.58297163e-01,-4.89846766e-02,-1.34087941e-02,5.79014828e-04,1.95497210e-04,2.85371584e-06},{1.98760927e+00,-1.34895993e-02,2.36182846e-03,7.70543178e-04,-5.69905678e-05,-1.41021419e-05,3.29495180e-07,1.68666233e-07}},
+  {{-4.00120068e+00,2.18438129e+01,5.81270576e-01,-1.13471234e+00,2.78713126e-02,2.56103091e-03,-2.33971654e-03,1.02848816e-03},{-1.06128931e+01,8.01231670e+00,3.79604197e+00,-2.93994308e+00,-1.52823433e-01,1.67853162e-01,-1.49391834e-02,1.75011228e-03},{2.55450654e+00,6.57370627e-01,-4.96034592e-01,-3.19477879e-02,1.40502024e-02,2.22844610e-04,-1.84183838e-04,8.14139912e-06},{1.99133134e+00,1.46929650e-02,1.62496185e-03,-8.28195945e-04,-3.47476707e-05,1.44127862e-05,-1.49763117e-08,-1.48069859e-07}},
+  {{3.02289543e+01,-1.00686455e+01,-5.41716194e+00,5.95608294e-01,1.27054334e-01,-2.33324226e-02,-4.57785034e-04,1.47356919e-03},{5.15214860e-01,5.52668691e-01,5.83503008e+00,1.30349517e+00,-7.96619117e-01,-7.41759017e-02,5.22250459e-02,-1.83931564e-03},{-6.73114240e-01,-1.72753823e+00,1.21112816e-01,8.99411365e-02,-2.54121912e-03,-1.12638506e-03,2.72169700e-06,1.05476181e-06},{2.02352095e+00,-3.78768169e-03,-4.32931911e-03,1.90324325e-04,1.05191459e-04,-1.96832002e-06,-7.34968012e-07,-1.06984590e-08}},
+  {{-2.93558254e+01,-1.00256872e+01,5.87704611e+00,7.64451325e-01,-1.72494739e-01,-4.15234230e-02,1.80087623e-03,2.85059167e-03},{8.26071930e+00,-1.20613499e+01,-7.91979074e+00,2.22783589e+00,1.03626537e+00,-1.19638845e-01,-7.66186193e-02,1.26731221e-03},{-1.75859308e+00,1.39198112e+00,3.49392176e-01,-7.69779831e-02,-1.07423589e-02,1.24308688e-03,1.81127529e-04,-9.81429548e-06},{1.98178852e+00,-1.01827299e-02,3.53525043e-03,5.93878969e-04,-9.46928340e-05,-1.17248901e-05,1.02335014e-06,1.70925702e-07}},
+  {{6.86800385e+00,2.14527836e+01,-1.34915543e+00,-1.06309736e+00,3.36662754e-02,9.99668147e-04,1.42687629e-03,8.07715522e-04},{-9.91813469e+00,9.80660534e+00,-9.54318404e-01,-2.79124498e+00,2.93082982e-01,1.33418307e-01,-4.43007424e-03,3.76359187e-03},{2.74629951e+00,8.71670693e-02,-5.23773551e-01,5.09866979e-04,1.38729811e-02,-3.48680187e-04,-1.40537304e-04,1.32782698e-05},{1.99885607e+00,1.57139916e-02,1.66974700e-04,-8.62248824e-04,6.02489445e-06,1.34850861e-05,-5.06901358e-07,-9.21446741e-08}},
+  {{2.38738937e+01,-1.55202761e+01,-4.20747232e+00,8.26372027e-01,6.73031360e-02,-1.78868342e-02,3.46644735e-03,4.46892431e-04},{3.16394734e+00,6.25597095e+00,6.52590322e+00,-5.17378628e-01,-8.12545478e-01,6.75680190e-02,2.75565181e-02,-1.05508864e-02},{-1.48112428e+00,-1.50747776e+00,2.68402696e-01,8.01769346e-02,-5.80133777e-03,-1.10104145e-03,1.19598444e-05,3.41493683e-06},{2.02046990e+00,-8.35132878e-03,-3.79571086e-03,4.24224505e-04,9.54893476e-05,-4.64970162e-06,-7.91864977e-07,-1.72948535e-08}},
+  {{-3.23802643e+01,-3.05413890e+00,6.72496891e+00,2.69195557e-01,-2.58821994e-01,-1.88287739e-02,1.09795677e-02,1.74066308e-03},{4.38157701e+00,-1.71136646e+01,-3.03557754e+00,3.82034159e+00,4.03957427e-01,-3.17315131e-01,-3.41029018e-02,1.97066199e-02},{-9.95670617e-01,1.69697809e+00,1.99687883e-01,-9.67546478e-02,-6.34305412e-03,1.76828564e-03,1.16558142e-04,-2.17556990e-05},{1.97787523e+00,-5.78109687e-03,4.33889870e-03,3.41913750e-04,-1.22142519e-04,-7.08991638e-06,1.60850573e-06,1.15720063e-07}},
+  {{1.70287857e+01,1.89155483e+01,-3.11879206e+00,-9.60706234e-01,5.00778183e-02,9.92346369e-03,3.57459020e-03,2.49318546e-04},{-8.39004898e+00,7.43965006e+00,-4.65285587e+00,-1.68640006e+00,6.52457893e-01,1.11736067e-01,-8.65594950e-03,-5.72393369e-03},{2.65484238e+00,-4.85401571e-01,-4.97187912e-01,3.09624374e-02,1.22733964e-02,-7.49403029e-04,-8.75923579e-05,1.26440646e-05},{2.00651836e+00,1.51110422e-02,-1.27530261e-03,-8.06779834e-04,4.21709155e-05,1.12282505e-05,-7.71416865e-07,-3.66577773e-08}},
+  {{1.50779190e+01,-1.94507847e+01,-2.66817164e+00,9.49712396e-01,3.29216532e-02,-5.49273519e-03,3.48031963e-03,-4.57194081e-04},{6.29567194e+00,1.13398981e+01,4.40664196e+00,-2.10070944e+00,-5.51693380e-01,1.14635713e-01,-2.10796265e-04,-3.28356749e-03},{-2.13783431e+00,-1.13489377e+00,3.92104119e-01,6.29822016e-02,-8.90464522e-03,-1.02067424e-03,3.42048006e-05,7.40895848e-06},{2.01534271e+00,-1.20957447e-02,-2.88494467e-03,6.25773158e-04,7.76543893e-05,-7.52298138e-06,-8.42421628e-07,-7.75373898e-09}},
+  {{-3.20501442e+01,4.30992985e+00,6.68315458e+00,-3.17476839e-01,-2.57490098e-01,1.97776705e-02,1.06695015e-02,-1.89728744e-03},{8.08303952e-02,-1.72254810e+01,2.97977281e+00,3.72657323e+00,-4.89650458e-01,-3.02974045e-01,4.20821495e-02,1.79997869e-02},{-1.29470721e-01,1.82219505e+00,2.60616522e-02,-1.05059803e-01,-8.38699983e-04,2.00205995e-03,1.59255851e-05,-2.75052753e-05},{1.97627676e+00,-7.52510270e-04,4.67062695e-03,4.47543316e-05,-1.33860987e-04,-9.46336854e-07,1.87747492e-06,1.61156013e-08}},
+  {{2.54023361e+01,1.45180674e+01,-4.62468481e+00,-7.85927713e-01,9.45474431e-02,2.04900317e-02,2.32272781e-03,-8.45065457e-04},{-6.66859579e+00,2.67868686e+00,-5.95054674e+00,4.56405319e-02,8.53152215e-01,2.99382303e-02,-3.80560309e-02,-8.96163285e-03},{2.29042196e+00,-1.00227094e+00,-4.21884120e-01,5.66584095e-02,9.74828750e-03,-9.79600009e-04,-4.38492898e-05,8.72596138e-06},{2.01352906e+00,1.29748443e-02,-2.55856360e-03,-6.75603282e-04,7.08712105e-05,8.38012147e-06,-8.45336672e-07,1.02148723e-09}},
+  {{4.70991945e+00,-2.15018234e+01,-9.34644282e-01,1.02429354e+00,2.77025010e-02,2.22891220e-03,8.59486929e-04,-8.25194758e-04},{9.46704865e+00,1.32792931e+01,1.60040706e-01,-2.98728418e+00,-2.02762306e-01,1.21811636e-01,5.05910208e-03,6.06671022e-03},{-2.57560158e+00,-6.44084573e-01,4.79908139e-01,3.90282609e-02,-1.16118472e-02,-8.32462218e-04,7.33511479e-05,1.17008576e-05},{2.00866127e+00,-1.46386782e-02,-1.67112122e-03,7.75608583e-04,5.13667583e-05,-1.04310375e-05,-8.09330174e-07,2.34388846e-08}},
+  {{-2.83920670e+01,1.11864948e+01,5.75340939e+00,-8.09257209e-01,-1.70356646e-01,4.11166251e-02,1.36567478e-03,-2.75238953e-03},{-4.17902088e+00,-1.24808006e+01,7.62926626e+00,2.00777102e+00,-1.06295276e+00,-9.24676210e-02,7.58218989e-02,-1.39584788e-03},{7.50122309e-01,1.75299442e+00,-1.50710687e-01,-1.00456595e-01,4.81583457e-03,1.87156757e-03,-8.98209255e-05,-2.42666229e-05},{1.97715950e+00,4.35773935e-03,4.48716385e-03,-2.58405023e-04,-1.27352410e-04,5.40593282e-06,1.72674424e-06,-8.99503121e-08}},
+  {{3.11769867e+01,8.70092583e+00,-5.71011686e+00,-4.95014071e-01,1.53343290e-01,2.02585105e-02,-2.50226608e-03,-1.53305277e-03},{-4.98362684e+00,-1.90842319e+00,-4.41792774e+00,1.80017924e+00,7.06653237e-01,-1.27280518e-01,-5.02588861e-02,2.73917196e-03},{1.69127834e+00,-1.41335928e+00,-3.07413489e-01,7.59130046e-02,6.72855787e-03,-1.08535425e-03,-1.68225342e-05,4.44061016e-06},{2.01917005e+00,9.54444055e-03,-3.56652914e-03,-4.87072655e-04,9.11531388e-05,5.46812635e-06,-8.10224492e-07,1.65060339e-08}},
+  {{-6.12505770e+00,-2.14520798e+01,9.25286412e-01,1.08862245e+00,2.84373350e-02,-1.34106958e-03,-2.90521723e-03,-1.00855110e-03},{1.17552710e+01,1.05956717e+01,-4.78291941e+00,-2.94507504e+00,2.20617443e-01,1.63741440e-01,1.82990227e-02,7.91016791e-04},{-2.74877429e+00,-8.20185542e-02,5.21439612e-01,9.72636044e-03,-1.35310367e-02,-4.84125776e-04,1.25069259e-04,1.36072131e-05},{2.00110912e+00,-1.57037862e-02,-2.61416368e-04,8.54782760e-04,1.71899555e-05,-1.29291484e-05,-6.07021775e-07,7.49025517e-08}},
+  {{-2.17111378e+01,1.67686939e+01,4.16039085e+00,-1.08661497e+00,-6.24478646e-02,3.33303399e-02,-5.62265469e-03,-6.61791477e-04},{-7.79048109e+00,-4.66468334e+00,9.12368965e+00,-3.46626103e-01,-1.02986443e+00,1.20266482e-01,4.38780710e-02,-1.45896776e-02},{1.55181873e+00,1.49749613e+00,-3.09328020e-01,-8.37474689e-02,9.61957220e-03,1.41783850e-03,-1.67272054e-04,-1.36264352e-05},{1.98043132e+00,8.99417792e-03,3.81256337e-03,-5.27123164e-04,-1.04015780e-04,1.05874951e-05,1.21493247e-06,-1.60765566e-07}},
+  {{3.38502274e+01,2.04351592e+00,-6.20991373e+00,-1.01743951e-01,1.88475400e-01,4.32280544e-03,-6.45377208e-03,-4.40946780e-04},{-3.25284624e+00,-4.11329985e+00,-7.63698697e-01,2.77242589e+00,1.71018466e-01,-2.42953107e-01,-1.44292368e-02,1.49649540e-02},{9.19327199e-01,-1.68044317e+00,-1.65655762e-01,8.78750458e-02,3.49787669e-03,-1.12217583e-03,-4.47292405e-06,1.54913118e-06},{2.02286625e+00,5.17520541e-03,-4.21539182e-03,-2.60636618e-04,1.03164559e-04,2.72962097e-06,-7.48639536e-07,1.38107934e-08}},
+  {{-1.62293720e+01,-1.92152615e+01,2.84543800e+00,1.11491036e+00,1.92773659e-04,-1.74746569e-02,-6.20543119e-03,-6.19916420e-04},{1.22683344e+01,3.67669082e+00,-8.61947346e+00,-1.81194794e+00,7.30666399e-01,1.87012389e-01,-6.21890277e-03,-1.27855213e-02},{-2.63868475e+00,4.95058000e-01,5.09769976e-01,-2.24920716e-02,-1.41703654e-02,4.16660441e-05,1.73797438e-04,1.02922158e-05},{1.99346292e+00,-1.51546225e-02,1.20778719e-03,8.47731950e-04,-2.26486573e-05,-1.43232000e-05,-1.80404115e-07,1.33261210e-07}},
+  {{-1.26291838e+01,2.04567165e+01,2.22959852e+00,-1.16120267e+00,6.79646526e-03,1.37101216e-02,-5.36803855e-03,8.26641161e-04},{-1.00441217e+01,3.33278203e+00,7.18949652e+00,-2.20927882e+00,-5.82381487e-01,1.91654414e-01,-2.83260248e-03,-8.55910685e-03},{2.19253588e+00,1.08533204e+00,-4.31484133e-01,-5.77368811e-02,1.28277317e-02,7.76397064e-04,-1.96406530e-04,-5.76595482e-07},{1.98575139e+00,1.26602342e-02,2.73347064e-03,-7.27995473e-04,-6.86287676e-05,1.36550125e-05,5.29539875e-07,-1.74765049e-07}},
+  {{3.32099190e+01,-4.78774214e+00,-6.03691530e+00,3.11406642e-01,1.72109067e-01,-1.57448575e-02,-4.80586942e-03,1.26542978e-03},{-1.33239782e+00,-2.86397147e+00,3.37881565e+00,2.44204021e+00,-4.69903469e-01,-2.01709643e-01,3.74940895e-02,1.07786469e-02},{5.36567457e-02,-1.77946496e+00,-9.63262282e-03,9.22020674e-02,2.00576193e-04,-1.13010418e-03,-1.68474102e-07,5.17377941e-07},{2.02424312e+00,3.01691471e-04,-4.45475150e-03,-1.51126960e-05,1.07389307e-04,1.53976501e-07,-7.18686806e-07,9.04095299e-10}},
+  {{-2.45052013e+01,-1.48958168e+01,4.66136742e+00,1.01147676e+00,-8.01619738e-02,-3.73167619e-02,-4.88892058e-03,1.21901033e-03},{1.07486563e+01,-5.28875303e+00,-9.69536209e+00,2.86458760e-01,1.10083282e+00,7.33298436e-02,-5.83605319e-02,-1.31283030e-02},{-2.25594497e+00,1.02671373e+00,4.43145931e-01,-5.41332774e-02,-1.30885942e-02,6.94030954e-04,1.96485227e-04,8.92327819e-07},{1.98651254e+00,-1.30193308e-02,2.58095493e-03,7.46601843e-04,-6.38213533e-05,-1.38643036e-05,4.45397973e-07,1.72690093e-07}},
+  {{-2.09044337e+00,2.19344120e+01,2.33737648e-01,-1.12409472e+00,2.95300558e-02,1.34410884e-03,-1.62677898e-03,1.00900268e-03},{-1.05758915e+01,8.63795376e+00,2.96012688e+00,-2.99121141e+00,-6.73855245e-02,1.60157531e-01,-1.40598686e-02,3.23648960e-03},{2.60613823e+00,5.63226759e-01,-5.04565954e-01,-2.64419168e-02,1.41373156e-02,1.15942807e-04,-1.78410221e-04,9.45901593e-06},{1.99256647e+00,1.49770677e-02,1.38276804e-03,-8.40491208e-04,-2.76815390e-05,1.43793559e-05,-1.13444266e-07,-1.39651831e-07}},
+  {{2.93107014e+01,-1.11156445e+01,-5.23468447e+00,6.45589530e-01,1.15826644e-01,-2.34144591e-02,4.67444741e-04,1.35265710e-03},{9.22262847e-01,1.49244273e+00,6.16088629e+00,9.95800018e-01,-8.28629971e-01,-4.44359630e-02,5.05634658e-02,-4.39122692e-03},{-8.17435861e-01,-1.70166731e+00,1.47203296e-01,8.88064578e-02,-3.09953815e-03,-1.12408737e-03,3.67724306e-06,1.32496416e-06},{2.02316117e+00,-4.60087787e-03,-4.26673470e-03,2.31481288e-04,1.04078616e-04,-2.41071734e-06,-7.42487771e-07,-1.26021131e-08}},
+  {{-3.01186638e+01,-8.86441135e+00,6.08127403e+00,6.91031218e-01,-1.91506997e-01,-3.97629552e-02,3.62310023e-03,2.96773086e-03},{7.64796352e+00,-1.32443533e+01,-7.24336004e+00,2.59650707e+00,9.65265632e-01,-1.62858531e-01,-7.42344782e-02,5.11418609e-03},{-1.63962615e+00,1.45491254e+00,3.26391429e-01,-8.10081065e-02,-1.01036737e-02,1.34656054e-03,1.73545748e-04,-1.20523555e-05},{1.98097873e+00,-9.49928723e-03,3.70058371e-03,5.55625011e-04,-1.00235338e-04,-1.10829878e-05,1.13643557e-06,1.65583842e-07}},
+  {{8.73745060e+00,2.11533337e+01,-1.67402422e+00,-1.04805756e+00,3.49761061e-02,1.99670345e-03,1.96537864e-03,7.42702628e-04},{-9.68640423e+00,9.64196873e+00,-1.72870839e+00,-2.65773225e+00,3.62519115e-01,1.30175397e-01,-3.00948741e-03,2.53298134e-03},{2.75034714e+00,-1.15564410e-02,-5.22905946e-01,5.91023406e-03,1.36857787e-02,-4.29450331e-04,-1.31552137e-04,1.35258051e-05},{2.00016952e+00,1.57229193e-02,-8.32424194e-05,-8.58700078e-04,1.25893457e-05,1.31716897e-05,-5.67578525e-07,-8.20291746e-08}},
+  {{2.24793987e+01,-1.63310680e+01,-3.95488381e+00,8.54243219e-01,5.88262267e-02,-1.58318821e-02,3.74643807e-03,2.45049916e-04},{3.66664052e+00,7.28118944e+00,6.35022545e+00,-8.31726491e-01,-7.79608250e-01,8.28635618e-02,2.12438721e-02,-1.03079500e-02},{-1.60512757e+00,-1.45393991e+00,2.91379094e-01,7.77560398e-02,-6.34334143e-03,-1.09237700e-03,1.46611419e-05,3.99634882e-06},{2.01973009e+00,-9.05500073e-03,-3.66538786e-03,4.61184303e-04,9.30327078e-05,-5.12465385e-06,-8.02633338e-07,-1.70042167e-08}},
+  {{-3.25642738e+01,-1.76405537e+00,6.78402710e+00,1.67751685e-01,-2.65879452e-01,-1.23006403e-02,1.18195331e-02,1.14210916e-03},{3.66246367e+00,-1.75043869e+01,-1.99174058e+00,3.93799615e+00,2.49258265e-01,-3.32877815e-01,-2.09607687e-02,2.12116819e-02},{-8.53318870e-01,1.73129511e+00,1.71318740e-01,-9.90219563e-02,-5.46166161e-03,1.83147145e-03,1.01287202e-04,-2.32888997e-05},{1.97743666e+00,-4.95609315e-03,4.42972779e-03,2.93579185e-04,-1.25332357e-04,-6.12068970e-06,1.68076622e-06,1.01093541e-07}},
+  {{1.86545715e+01,1.82656002e+01,-3.40630984e+00,-9.36901748e-01,5.58506846e-02,1.20126894e-02,3.64899472e-03,9.04242625e-05},{-8.09533882e+00,6.68937540e+00,-5.07950354e+00,-1.41301024e+00,7.04112828e-01,1.03829868e-01,-1.27615789e-02,-7.28194136e-03},{2.61103058e+00,-5.78503668e-01,-4.87528741e-01,3.57133746e-02,1.18945651e-02,-7.99413363e-04,-7.91551211e-05,1.21191642e-05},{2.00777435e+00,1.48489419e-02,-1.50774478e-03,-7.89238256e-04,4.76065106e-05,1.07667775e-05,-7.95245171e-07,-2.87454878e-08}},
+  {{1.33389702e+01,-1.99530506e+01,-2.37438321e+00,9.64448929e-01,3.02351713e-02,-3.53430584e-03,3.15443752e-03,-5.50371187e-04},{6.85854387e+00,1.19819441e+01,3.78118062e+00,-2.31560183e+00,-4.93541837e-01,1.15738235e-01,-1.81472604e-03,-1.15264033e-03},{-2.22879124e+00,-1.05854726e+00,4.09794211e-01,5.93524650e-02,-9.39989835e-03,-9.97714698e-04,3.96561445e-05,8.17355794e-06},{2.01429796e+00,-1.26192626e-02,-2.69716349e-03,6.55295909e-04,7.37728842e-05,-8.02195245e-06,-8.44952012e-07,-4.04509271e-09}},
+  {{-3.16419697e+01,5.57685471e+00,6.57987022e+00,-4.15337205e-01,-2.47065738e-01,2.55517457e-02,9.41118598e-03,-2.35746661e-03},{-6.64031327e-01,-1.67095528e+01,3.95904803e+00,3.52201605e+00,-6.27981782e-01,-2.75868863e-01,5.28529212e-02,1.53126549e-02},{2.15011761e-02,1.82389462e+00,-4.33468027e-03,-1.05175309e-01,1.39659503e-04,2.00550305e-03,-2.65396966e-06,-2.75956645e-05},{1.97625518e+00,1.25074846e-04,4.67515504e-03,-7.44830913e-06,-1.34026413e-04,1.57661319e-07,1.88150943e-06,-2.68672351e-09}},
+  {{2.66221981e+01,1.35835896e+01,-4.85120964e+00,-7.43839502e-01,1.04800947e-01,2.15572454e-02,1.66682666e-03,-1.04642287e-03},{-6.38248014e+00,1.77210307e+00,-5.87810421e+00,3.76106471e-01,8.57544243e-01,5.77591825e-03,-4.29740362e-02,-7.83384871e-03},{2.20340538e+00,-1.08056819e+00,-4.04833049e-01,6.04036599e-02,9.25926119e-03,-1.00454362e-03,-3.80494857e-05,7.95398137e-06},{2.01459885e+00,1.24728866e-02,-2.75139068e-03,-6.46990316e-04,7.49010578e-05,7.87903991e-06,-8.44464410e-07,5.16578336e-09}},
+  {{2.80528617e+00,-2.16484299e+01,-6.15530252e-01,1.03591275e+00,2.83128116e-02,2.53801257e-03,2.53607868e-04,-8.66306655e-04},{9.95589828e+00,1.31710262e+01,-7.07540751e-01,-3.05298305e+00,-1.35430321e-01,1.26123220e-01,8.32848717e-03,6.39192993e-03},{-2.62408209e+00,-5.52104831e-01,4.90382969e-01,3.43693234e-02,-1.20042609e-02,-7.85519020e-04,8.15262028e-05,1.22750753e-05},{2.00741816e+00,-1.49268471e-02,-1.44184718e-03,7.94394233e-04,4.60726951e-05,-1.08991999e-05,-7.88865293e-07,3.09500372e-08}},
+  {{-2.74242687e+01,1.22808599e+01,5.51324034e+00,-8.74692142e-01,-1.50791764e-01,4.16150689e-02,-3.22972104e-04,-2.49276892e-03},{-4.86064720e+00,-1.12582178e+01,8.14619827e+00,1.60440063e+00,-1.10088181e+00,-4.91273738e-02,7.42206275e-02,-4.86400537e-03},{8.94042790e-01,1.72187638e+00,-1.79453358e-01,-9.83994156e-02,5.71556157e-03,1.81413325e-03,-1.05734129e-04,-2.28684203e-05},{1.97755694e+00,5.19234873e-03,4.40478837e-03,-3.07456823e-04,-1.24456375e-04,6.40072403e-06,1.66092514e-06,-1.05378298e-07}},
+  {{3.18815594e+01,7.57363081e+00,-5.84497166e+00,-4.31648225e-01,1.62460968e-01,1.84738562e-02,-3.44613940e-03,-1.48123212e-03},{-4.70472383e+00,-2.52771831e+00,-3.88758445e+00,2.05114770e+00,6.36485815e-01,-1.55258343e-01,-4.73721027e-02,5.49952593e-03},{1.57009614e+00,-1.46946311e+00,-2.84868211e-01,7.84594268e-02,6.18856400e-03,-1.09492044e-03,-1.38556397e-05,3.82556618e-06},{2.01994443e+00,8.85596219e-03,-3.70320422e-03,-4.50690277e-04,9.37476652e-05,4.98804047e-06,-7.99541169e-07,1.71312955e-08}},
+  {{-7.98845005e+00,-2.12176552e+01,1.26117647e+00,1.09780812e+00,2.65672170e-02,-3.32575268e-03,-3.59693053e-03,-1.01061375e-03},{1.19920092e+01,9.65773296e+00,-5.59138012e+00,-2.82790470e+00,3.06570232e-01,1.72760084e-01,1.74753647e-02,-1.57177332e-03},{-2.74965191e+00,1.65661015e-02,5.23240089e-01,4.37516719e-03,-1.37412669e-02,-4.06792678e-04,1.34113623e-04,1.34680049e-05},{1.99979532e+00,-1.57229956e-02,-1.19752758e-05,8.59853870e-04,1.07274609e-05,-1.32629339e-05,-5.50766856e-07,8.48965982e-08}},
+  {{-2.02675972e+01,1.75681171e+01,3.83729219e+00,-1.11236942e+00,-4.66131642e-02,3.00679971e-02,-6.05445635e-03,-2.89543415e-04},{-8.28433609e+00,-3.18814492e+00,9.01241207e+00,-7.35328019e-01,-9.70748782e-01,1.44258142e-01,3.47477421e-02,-1.48452558e-02},{1.67375946e+00,1.43719459e+00,-3.33012283e-01,-7.98712820e-02,1.02891643e-02,1.31726800e-03,-1.75825044e-04,-1.14149507e-05},{1.98120642e+00,9.69562773e-03,3.65400035e-03,-5.66659728e-04,-9.86701780e-05,1.12706939e-05,1.10435485e-06,-1.67242248e-07}},
+  {{3.39820175e+01,8.34958553e-01,-6.22964907e+00,-2.73295138e-02,1.89629689e-01,5.46127558e-04,-6.62125973e-03,-1.06387357e-04},{-2.95379019e+00,-4.15986824e+00,-1.00681307e-02,2.81458521e+00,5.34680784e-02,-2.48425812e-01,-4.68863128e-03,1.56271923e-02},{7.76431978e-01,-1.70925105e+00,-1.39775410e-01,8.91382694e-02,2.93993251e-03,-1.12468749e-03,-3.39075109e-06,1.24436929e-06},{2.02326655e+00,4.36961837e-03,-4.28507756e-03,-2.19749956e-04,1.04402665e-04,2.28365889e-06,-7.40167138e-07,1.20804504e-08}},
+  {{-1.78473015e+01,-1.86013451e+01,3.17901206e+00,1.10919130e+00,-9.96476132e-03,-2.11642738e-02,-6.46001147e-03,-4.10429348e-04},{1.21502342e+01,2.17876554e+00,-9.04912758e+00,-1.50122917e+00,8.16612422e-01,1.79276884e-01,-1.48529774e-02,-1.43385995e-02},{-2.59172869e+00,5.90112567e-01,5.02196729e-01,-2.80118994e-02,-1.41147487e-02,1.46157283e-04,1.80100687e-04,9.09753362e-06},{1.99221373e+00,-1.48978550e-02,1.45193411e-03,8.37096770e-04,-2.96934304e-05,-1.43915813e-05,-8.57631477e-08,1.42088851e-07}},
+  {{-1.08516426e+01,2.08843555e+01,1.87819088e+00,-1.16027689e+00,1.35697452e-02,1.06836213e-02,-4.82301461e-03,9.27666726e-04},{-1.02486115e+01,4.52092266e+00,6.56240511e+00,-2.43184137e+00,-4.89006132e-01,1.90290645e-01,-7.90084433e-03,-6.24469249e-03},{2.27988338e+00,1.00276387e+00,-4.47519928e-01,-5.26671521e-02,1.31825935e-02,6.61045488e-04,-1.96284280e-04,1.46349237e-06},{1.98682344e+00,1.31547172e-02,2.51867599e-03,-7.53535482e-04,-6.18727936e-05,1.39356889e-05,4.12041430e-07,-1.71623753e-07}},
+  {{3.27581062e+01,-5.95777035e+00,-5.93888235e+00,3.78535122e-01,1.64161384e-01,-1.83406789e-02,-3.97696625e-03,1.42925128e-03},{-9.87482488e-01,-2.29277301e+00,4.02063608e+00,2.25214815e+00,-5.62506855e-01,-1.78650796e-01,4.37196568e-02,8.36398173e-03},{-9.63588208e-02,-1.77842164e+00,1.73134897e-02,9.21550989e-02,-3.60878883e-04,-1.12993934e-03,3.09182440e-07,5.27694112e-07},{2.02422881e+00,-5.42041264e-04,-4.45221318e-03,2.71740792e-05,1.07341555e-04,-2.77264405e-07,-7.18871490e-07,-1.62049185e-09}},
+  {{-2.57087841e+01,-1.39455147e+01,4.94970131e+00,9.72344697e-01,-9.89388600e-02,-3.96681800e-02,-3.86028574e-03,1.63943786e-03},{1.03113089e+01,-6.83914375e+00,-9.52435589e+00,7.08593428e-01,1.12231147e+00,3.69726978e-02,-6.56766966e-02,-1.09485937e-02},{-2.16590095e+00,1.10802472e+00,4.26537365e-01,-5.91422804e-02,-1.27125597e-02,8.09104589e-04,1.96117311e-04,-1.17721493e-06},{1.98545730e+00,-1.25089111e-02,2.79264315e-03,7.20042037e-04,-7.05133716e-05,-1.35580176e-05,5.63323397e-07,1.75326662e-07}},
+  {{-1.70864046e-01,2.19628906e+01,-1.11058362e-01,-1.11286843e+00,3.06822304e-02,5.38618129e-04,-9.24755645e-04,9.79950535e-04},{-1.04963799e+01,9.13261795e+00,2.11124325e+00,-3.00970483e+00,1.50249470e-02,1.52940363e-01,-1.24246757e-02,4.27551288e-03},{2.64991760e+00,4.67589498e-01,-5.11500359e-01,-2.09092051e-02,1.41729880e-02,1.25933684e-05,-1.71796812e-04,1.05948402e-05},{1.99382424e+00,1.52153652e-02,1.13733578e-03,-8.50034936e-04,-2.06418172e-05,1.42895806e-05,-2.06147448e-07,-1.30594273e-07}},
+  {{2.83102741e+01,-1.21328859e+01,-5.03909349e+00,6.91839039e-01,1.04634918e-01,-2.30068248e-02,1.31987745e-03,1.19337451e-03},{1.34382582e+00,2.47643447e+00,6.40821075e+00,6.77249312e-01,-8.47745419e-01,-1.58870108e-02,4.74729650e-02,-6.61933515e-03},{-9.59283471e-01,-1.67086864e+00,1.72919407e-01,8.74507949e-02,-3.65627347e-03,-1.12109992e-03,4.84192742e-06,1.64912035e-06},{2.02273345e+00,-5.40078245e-03,-4.19217488e-03,2.72140256e-04,1.02743637e-04,-2.85764440e-06,-7.51134678e-07,-1.42376129e-08}},
+  {{-3.07938175e+01,-7.67112875e+00,6.26561356e+00,6.11244500e-01,-2.09467918e-01,-3.70145515e-02,5.45209553e-03,2.96021905e-03},{7.01065588e+00,-1.43157873e+01,-6.48124790e+00,2.93583155e+00,8.75642717e-01,-2.04071790e-01,-6.95385784e-02,8.89631175e-03},{-1.51575625e+00,1.51340485e+00,3.02279562e-01,-8.47784877e-02,-9.41633061e-03,1.44509354e-03,1.64491692e-04,-1.42401032e-05},{1.98022711e+00,-8.78628436e-03,3.85449152e-03,5.15302934e-04,-1.05445557e-04,-1.03766351e-05,1.24519352e-06,1.58515462e-07}},
+  {{1.05847855e+01,2.07947788e+01,-1.99497271e+00,-1.03237629e+00,3.68258096e-02,3.29447212e-03,2.45095952e-03,6.66995998e-04},{-9.43532562e+00,9.35680676e+00,-2.46241331e+00,-2.49732924e+00,4.29869860e-01,1.27347052e-01,-2.36858195e-03,9.79682314e-04},{2.74614811e+00,-1.10011294e-01,-5.20477593e-01,1.12326471e-02,1.34599265e-02,-5.04956639e-04,-1.22431084e-04,1.36097824e-05},{2.00148249e+00,1.56847443e-02,-3.32133204e-04,-8.52606900e-04,1.89949133e-05,1.28240899e-05,-6.21504114e-07,-7.20778175e-08}},
+  {{2.10159416e+01,-1.70993862e+01,-3.69358325e+00,8.79360199e-01,5.12806065e-02,-1.36370240e-02,3.90156219e-03,5.73128127e-05},{4.18404770e+00,8.27467346e+00,6.09085035e+00,-1.13489354e+00,-7.39821911e-01,9.48850587e-02,1.51948687e-02,-9.53898672e-03},{-1.72431982e+00,-1.39612782e+00,3.13602597e-01,7.51226246e-02,-6.88010547e-03,-1.08192791e-03,1.77749025e-05,4.62348044e-06},{2.01893258e+00,-9.73259658e-03,-3.52444872e-03,4.97107743e-04,9.03391410e-05,-5.60534454e-06,-8.12936037e-07,-1.62036251e-08}},
+  {{-3.26527634e+01,-4.62899327e-01,6.81681204e+00,6.41013011e-02,-2.69999534e-01,-5.40136732e-03,1.22996643e-02,4.79248672e-04},{2.93430948e+00,-1.77416782e+01,-9.26213562e-01,4.00063086e+00,8.92799422e-02,-3.41007292e-01,-7.12339533e-03,2.19707992e-02},{-7.08442092e-01,1.76024997e+00,1.42358214e-01,-1.00941658e-01,-4.55225306e-03,1.88544276e-03,8.50722499e-05,-2.46136788e-05},{1.97706699e+00,-4.11570724e-03,4.50642873e-03,2.44119350e-04,-1.28039857e-04,-5.11272947e-06,1.74277716e-06,8.52852153e-08}},
+  {{2.02293930e+01,1.75619392e+01,-3.68724680e+00,-9.10683095e-01,6.26174957e-02,1.41104041e-02,3.60769150e-03,-8.85758418e-05},{-7.79944944e+00,5.87940788e+00,-5.42786503e+00,-1.12239301e+00,7.50653207e-01,9.34759229e-02,-1.76480748e-02,-8.51498079e-03},{2.55943251e+00,-6.69682145e-01,-4.76500452e-01,4.03128639e-02,1.14918221e-02,-8.44569178e-04,-7.10780369e-05,1.15152234e-05},{2.00900745e+00,1.45432865e-02,-1.73482578e-03,-7.69596547e-04,5.28136916e-05,1.02922140e-05,-8.13856957e-07,-2.14266649e-08}},
+  {{1.15525913e+01,-2.04017048e+01,-2.07443285e+00,9.78320241e-01,2.84090787e-02,-1.77241757e-03,2.76053953e-03,-6.28255773e-04},{7.42049026e+00,1.25164356e+01,3.09650230e+00,-2.50786185e+00,-4.33920801e-01,1.16218321e-01,-2.20999750e-03,9.22686595e-04},{-2.31307721e+00,-9.78995025e-01,4.26382363e-01,5.55321425e-02,-9.88228898e-03,-9.71349480e-04,4.56125454e-05,8.93862762e-06},{2.01321149e+00,-1.31060965e-02,-2.50108726e-03,6.83220336e-04,6.96464995e-05,-8.52087214e-06,-8.44638748e-07,3.16072279e-10}},
+  {{-3.11350079e+01,6.83049917e+00,6.45031071e+00,-5.09698391e-01,-2.34128505e-01,3.06055024e-02,7.90129323e-03,-2.69433646e-03},{-1.40509784e+00,-1.60504494e+01,4.88294649e+00,3.27000785e+00,-7.53060699e-01,-2.43199170e-01,6.18384257e-02,1.21397525e-02},{1.72354430e-01,1.81992733e+00,-3.47042829e-02,-1.04912497e-01,1.11686171e-03,1.99812301e-03,-2.11986971e-05,-2.74142858e-05},{1.97630572e+00,1.00194581e-03,4.66464693e-03,-5.96011487e-05,-1.33655514e-04,1.26008683e-06,1.87298087e-06,-2.14442206e-08}},
+  {{2.77664375e+01,1.26049547e+01,-5.06576586e+00,-6.97732627e-01,1.15468115e-01,2.22161580e-02,8.94833182e-04,-1.22852798e-03},{-6.09933567e+00,8.86224210e-01,-5.71792793e+00,7.03930140e-01,8.49984109e-01,-2.07526870e-02,-4.70280014e-02,-6.20945683e-03},{2.10985732e+00,-1.15554643e+00,-3.86708617e-01,6.39547110e-02,8.75825435e-03,-1.02618174e-03,-3.27621528e-05,7.18740193e-06},{2.01562548e+00,1.19350636e-02,-2.93566170e-03,-6.16827921e-04,7.86840901e-05,7.37875462e-06,-8.40913629e-07,8.65993854e-09}},
+  {{8.83943379e-01,-2.17316761e+01,-2.91112363e-01,1.04754543e+00,2.89528556e-02,2.47269566e-03,-3.85025924e-04,-9.05300956e-04},{1.04134274e+01,1.29148769e+01,-1.58840775e+00,-3.08946037e+00,-6.54759705e-02,1.32000774e-01,1.15972757e-02,6.16372330e-03},{-2.66470265e+00,-4.58341509e-01,4.99468625e-01,2.95648295e-02,-1.23716854e-02,-7.33684516e-04,9.00329542e-05,1.27648918e-05},{2.00615406e+00,-1.51709858e-02,-1.20754912e-03,8.11039645e-04,4.05554165e-05,-1.13529031e-05,-7.63055084e-07,3.90348802e-08}},
+  {{-2.63616924e+01,1.33372688e+01,5.25320387e+00,-9.33371782e-01,-1.30964831e-01,4.11962345e-02,-1.86597218e-03,-2.15490721e-03},{-5.51909971e+00,-9.95420647e+00,8.55742264e+00,1.18819678e+00,-1.11906528e+00,-7.08581042e-03,7.05521181e-02,-7.96927698e-03},{1.03521347e+00,1.68545246e+00,-2.07555383e-01,-9.59996060e-02,6.58527808e-03,1.74770423e-03,-1.20649078e-04,-2.12693521e-05},{1.97802246e+00,6.01023529e-03,4.30844631e-03,-3.55293334e-04,-1.21086399e-04,7.35419735e-06,1.58517173e-06,-1.19559928e-07}},
+  {{3.24914017e+01,6.41745996e+00,-5.96158123e+00,-3.64793390e-01,1.70644015e-01,1.61610227e-02,-4.33340529e-03,-1.36269559e-03},{-4.42453384e+00,-3.06018949e+00,-3.29603291e+00,2.27298594e+00,5.54024816e-01,-1.81055680e-01,-4.28193845e-02,8.15408956e-03},{1.44429421e+00,-1.52121449e+00,-2.61603743e-01,8.07914510e-02,5.64392190e-03,-1.10280036e-03,-1.12927237e-05,3.25903193e-06},{2.02065969e+00,8.14247970e-03,-3.82909016e-03,-4.13323171e-04,9.61050464e-05,4.51401411e-06,-7.88524801e-07,1.72602501e-08}},
+  {{-9.83130836e+00,-2.09130554e+01,1.60041726e+00,1.10557806e+00,2.35694647e-02,-5.72065450e-03,-4.27109189e-03,-9.91229201e-04},{1.21707764e+01,8.59205055e+00,-6.35547209e+00,-2.67560720e+00,3.95461440e-01,1.80664673e-01,1.51694175e-02,-4.11947863e-03},{-2.74228454e+00,1.15265034e-01,5.23472250e-01,-1.04570063e-03,-1.39118554e-02,-3.24287656e-04,1.42977937e-04,1.31628740e-05},{1.99848306e+00,-1.56950448e-02,2.38402412e-04,8.62357789e-04,4.11560723e-06,-1.35609289e-05,-4.87768773e-07,9.50078984e-08}},
+  {{-1.87449780e+01,1.83088055e+01,3.50366664e+00,-1.13221216e+00,-3.22190709e-02,2.65642982e-02,-6.25158334e-03,4.22518351e-05},{-8.73301125e+00,-1.72504091e+00,8.79426670e+00,-1.10239029e+00,-9.00496423e-01,1.63142666e-01,2.55727116e-02,-1.44449873e-02},{1.79060888e+00,1.37255847e+00,-3.55547547e-01,-7.57440031e-02,1.09089287e-02,1.21210248e-03,-1.82889024e-04,-9.16395675e-06},{1.98203838e+00,1.03664231e-02,3.48430662e-03,-6.04063738e-04,-9.30062088e-05,1.18882408e-05,9.89912337e-07,-1.71985121e-07}},
+  {{3.40069389e+01,-3.81752640e-01,-6.22729111e+00,4.76386882e-02,1.88981682e-01,-3.29180527e-03,-6.58173021e-03,2.36634849e-04},{-2.64843869e+00,-4.09024954e+00,7.49107301e-01,2.81261563e+00,-6.53548464e-02,-2.48239860e-01,5.27305854e-03,1.56673491e-02},{6.31285965e-01,-1.73309338e+00,-1.13556847e-01,9.01797861e-02,2.38077412e-03,-1.12656353e-03,-2.50148878e-06,9.94489596e-07},{2.02359796e+00,3.55196116e-03,-4.34270641e-03,-1.78417074e-04,1.05418861e-04,1.84219334e-06,-7.32889816e-07,1.00997966e-08}},
+  {{-1.94070492e+01,-1.79175606e+01,3.50949192e+00,1.09858954e+00,-2.19421536e-02,-2.49258541e-02,-6.53789891e-03,-1.45753511e-04},{1.19701214e+01,6.29733920e-01,-9.38213253e+00,-1.16070437e+00,8.96374822e-01,1.66387975e-01,-2.42045391e-02,-1.53224235e-02},{-2.53699708e+00,6.83521211e-01,4.93034661e-01,-3.34949270e-02,-1.40071930e-02,2.53956649e-04,1.85522484e-04,7.72457133e-06},{1.99098885e+00,-1.45956669e-02,1.69243943e-03,8.23714363e-04,-3.67510656e-05,-1.44024407e-05,1.44176848e-08,1.50218114e-07}},
+  {{-9.02484703e+00,2.12400284e+01,1.52408481e+00,-1.15635490e+00,1.89524945e-02,7.97457341e-03,-4.19801567e-03,9.91051202e-04},{-1.03998919e+01,5.60496378e+00,5.87030506e+00,-2.61757660e+00,-3.95496458e-01,1.86227813e-01,-1.15712779e-02,-3.87396617e-03},{2.36033392e+00,9.17298138e-01,-4.62076604e-01,-4.74680513e-02,1.34814456e-02,5.46086871e-04,-1.94828433e-04,3.38709992e-06},{1.98793542e+00,1.36083215e-02,2.29682052e-03,-7.76426343e-04,-5.49933029e-05,1.41482296e-05,2.96955449e-07,-1.67138424e-07}},
+  {{3.21965256e+01,-7.11207962e+00,-5.81957436e+00,4.42815125e-01,1.54974639e-01,-2.04448327e-02,-3.05124838e-03,1.52698066e-03},{-6.30588293e-01,-1.62224853e+00,4.60763931e+00,2.02804017e+00,-6.43628597e-01,-1.52339458e-01,4.83419709e-02,5.66806877e-03},{-2.46035889e-01,-1.77224600e+00,4.42080498e-02,9.18851718e-02,-9.22081410e-04,-1.12942921e-03,8.14353712e-07,5.90491140e-07},{2.02414274e+00,-1.38395221e-03,-4.43728315e-03,6.93915936e-05,1.07077627e-04,-7.09041785e-07,-7.20693777e-07,-4.11109635e-09}},
+  {{-2.68230782e+01,-1.29370241e+01,5.22368288e+00,9.25462067e-01,-1.18563764e-01,-4.13161293e-02,-2.58106459e-03,2.04391638e-03},{9.82960224e+00,-8.33968639e+00,-9.23646641e+00,1.13218927e+00,1.12508476e+00,-2.98252678e-03,-7.13628605e-02,-8.17353465e-03},{-2.06936407e+00,1.18603611e+00,4.08516437e-01,-6.39903396e-02,-1.22809373e-02,9.23429558e-04,1.94331864e-04,-3.33217758e-06},{1.98444688e+00,-1.19598377e-02,2.99615506e-03,6.90927089e-04,-7.70333427e-05,-1.31824854e-05,6.82302925e-07,1.76467637e-07}},
+  {{1.75703704e+00,2.19149094e+01,-4.53821748e-01,-1.10052240e+00,3.15163955e-02,1.60950192e-04,-2.40550435e-04,9.42092855e-04},{-1.03783340e+01,9.47887993e+00,1.25913382e+00,-2.99235535e+00,9.44005549e-02,1.46433741e-01,-1.02868695e-02,4.80174087e-03},{2.68571854e+00,3.70757878e-01,-5.16831279e-01,-1.53693063e-02,1.41589958e-02,-8.67440540e-05,-1.64464698e-04,1.15449257e-05},{1.99510062e+00,1.54072884e-02,8.89457879e-04,-8.56840110e-04,-1.36552508e-05,1.41468872e-05,-2.92690089e-07,-1.21049467e-07}},
+  {{2.72093258e+01,-1.31111250e+01,-4.82721996e+00,7.33787000e-01,9.36076641e-02,-2.21057050e-02,2.07307748e-03,1.00346829e-03},{1.78403103e+00,3.49856067e+00,6.56381035e+00,3.50996584e-01,-8.53214741e-01,1.06969960e-02,4.30790596e-02,-8.40616133e-03},{-1.09823668e+00,-1.63522315e+00,1.98195785e-01,8.58750194e-02,-4.21100995e-03,-1.11728627e-03,6.25248640e-06,2.02724777e-06},{2.02223897e+00,-6.18512044e-03,-4.10580682e-03,3.12211865e-04,1.01184349e-04,-3.30966805e-06,-7.60708360e-07,-1.55597935e-08}},
+  {{-3.13595543e+01,-6.44314098e+00,6.42396069e+00,5.24888039e-01,-2.25752518e-01,-3.32324207e-02,7.20601995e-03,2.80960673e-03},{6.35095787e+00,-1.52534351e+01,-5.63456917e+00,3.23593092e+00,7.67266572e-01,-2.41711706e-01,-6.24809004e-02,1.24402102e-02},{-1.38735795e+00,1.56726336e+00,2.77134359e-01,-8.82711709e-02,-8.68296344e-03,1.53784978e-03,1.54010617e-04,-1.63478435e-05},{1.97953606e+00,-8.04591924e-03,3.99640994e-03,4.73048596e-04,-1.10293346e-04,-9.60874422e-06,1.34849381e-06,1.49748530e-07}},
+  {{1.23964243e+01,2.03635483e+01,-2.31019473e+00,-1.01513052e+00,3.93844470e-02,4.86741820e-03,2.86716130e-03,5.76330931e-04},{-9.17121124e+00,8.94642544e+00,-3.14100981e+00,-2.30795574e+00,4.94557858e-01,1.24345951e-01,-2.70512211e-03,-8.01426184e-04},{2.73372245e+00,-2.07904205e-01,-5.16511738e-01,1.64623223e-02,1.31979622e-02,-5.75141166e-04,-1.13280068e-04,1.35417358e-05},{2.00279117e+00,1.55997518e-02,-5.78964362e-04,-8.44032271e-04,2.52254940e-05,1.24461822e-05,-6.68803352e-07,-6.23936245e-08}},
+  {{1.94753170e+01,-1.78099098e+01,-3.42227483e+00,9.01259065e-01,4.47746627e-02,-1.13585014e-02,3.92801687e-03,-1.11470574e-04},{4.71868801e+00,9.21836472e+00,5.74013710e+00,-1.42265856e+00,-6.93563700e-01,1.03613667e-01,9.71307885e-03,-8.27565510e-03},{-1.83834624e+00,-1.33419573e+00,3.35011303e-01,7.22792596e-02,-7.41064874e-03,-1.06944493e-03,2.13284366e-05,5.29183990e-06},{2.01807928e+00,-1.03821354e-02,-3.37322080e-03,5.31900616e-04,8.74062825e-05,-6.09135168e-06,-8.22412062e-07,-1.48597303e-08}},
+  {{-3.26241875e+01,8.41751099e-01,6.81777954e+00,-4.04864065e-02,-2.70759553e-01,1.65502494e-03,1.23708462e-02,-2.10559418e-04},{2.19883752e+00,-1.78092422e+01,1.47474244e-01,4.00185442e+00,-7.25872517e-02,-3.40882242e-01,6.94010640e-03,2.19062995e-02},{-5.61478317e-01,1.78374565e+00,1.12907082e-01,-1.02504089e-01,-3.61939939e-03,1.92970014e-03,6.80585508e-05,-2.57105748e-05},{1.97676706e+00,-3.26259225e-03,4.56871232e-03,1.93723637e-04,-1.30248140e-04,-4.07221387e-06,1.79382403e-06,6.84708752e-08}},
+  {{2.17304935e+01,1.67975044e+01,-3.95727539e+00,-8.81115377e-01,7.03374222e-02,1.61182359e-02,3.43181682e-03,-2.84712762e-04},{-7.50718784e+00,5.01977777e+00,-5.68449306e+00,-8.15954745e-01,7.89973080e-01,8.01494867e-02,-2.30892394e-02,-9.30940267e-03},{2.50020909e+00,-7.58678615e-01,-4.64147568e-01,4.47516739e-02,1.10674826e-02,-8.85087065e-04,-6.34109529e-05,1.08483137e-05},{2.01021361e+00,1.41951190e-02,-1.95593969e-03,-7.47944287e-04,5.77863502e-05,9.80751884e-06,-8.27654048e-07,-1.47329144e-08}},
+  {{9.72530842e+00,-2.07806015e+01,-1.76914763e+00,9.90965486e-01,2.73969937e-02,-2.68493081e-04,2.30440637e-03,-6.92231464e-04},{7.97957993e+00,1.29221582e+01,2.35406828e+00,-2.67340827e+00,-3.72702569e-01,1.16577893e-01,-1.42578990e-03,2.80823419e-03},{-2.39043951e+00,-8.96456659e-01,4.41814423e-01,5.15270308e-02,-1.03500588e-02,-9.41291917e-04,5.20670510e-05,9.69196390e-06},{2.01208663e+00,-1.35547481e-02,-2.29720725e-03,7.09451269e-04,6.52761883e-05,-9.01790190e-06,-8.41039935e-07,5.33627187e-09}},
+  {{-3.05161018e+01,8.05524540e+00,6.29221773e+00,-5.98717391e-01,-2.18897566e-01,3.47404927e-02,6.20838255e-03,-2.88840733e-03},{-2.13939238e+00,-1.52460403e+01,5.73391294e+00,2.97230196e+00,-8.61432076e-01,-2.05768406e-01,6.86605349e-02,8.60517565e-03},{3.22633594e-01,1.81030881e+00,-6.49396554e-02,-1.04272865e-01,2.08771904e-03,1.97999435e-03,-3.95294774e-05,-2.69639550e-05},{1.97642827e+00,1.87532126e-03,4.63914778e-03,-1.11498513e-04,-1.32750924e-04,2.35368771e-06,1.85199758e-06,-3.99285227e-08}},
+  {{2.88112068e+01,1.15849886e+01,-5.26293659e+00,-6.47398829e-01,1.26191676e-01,2.23724358e-02,2.88846841e-05,-1.37614342e-03},{-5.82108688e+00,3.87092456e-02,-5.46490097e+00,1.02337885e+00,8.28676820e-01,-4.90757860e-02,-4.98666391e-02,-4.13885992e-03},{2.01006246e+00,-1.22700322e+00,-3.67568105e-01,6.73068613e-02,8.24683998e-03,-1.04480959e-03,-2.79825981e-05,6.43689737e-06},{2.01660562e+00,1.13630323e-02,-3.11093009e-03,-5.85212954e-04,8.22206785e-05,6.88074260e-06,-8.35119749e-07,1.15198509e-08}},
+  {{-1.03467059e+00,-2.17403889e+01,3.58089954e-02,1.05867934e+00,2.94311941e-02,1.99826481e-03,-1.04746758e-03,-9.40683414e-04},{1.08348112e+01,1.24998827e+01,-2.47262716e+00,-3.09304905e+00,7.55457906e-03,1.39285937e-01,1.45215476e-02,5.36393328e-03},{-2.69734025e+00,-3.63064677e-01,5.07125854e-01,2.46254038e-02,-1.27117140e-02,-6.76796248e-04,9.88073953e-05,1.31545057e-05},{2.00487232e+00,-1.53702516e-02,-9.68870823e-04,8.25461117e-04,3.48233298e-05,-1.17888967e-05,-7.31544219e-07,4.76453828e-08}},
+  {{-2.52051945e+01,1.43381414e+01,4.97511911e+00,-9.84200299e-01,-1.11408159e-01,3.99158150e-02,-3.19951307e-03,-1.76566793e-03},{-6.14960003e+00,-8.58181381e+00,8.85304070e+00,7.65994430e-01,-1.11726701e+00,3.24498527e-02,6.50068596e-02,-1.05732083e-02},{1.17320967e+00,1.64384842e+00,-2.34920636e-01,-9.32694003e-02,7.42079504e-03,1.67289446e-03,-1.34439964e-04,-1.94927979e-05},{1.97855473e+00,6.80883741e-03,4.19850787e-03,-4.01735946e-04,-1.17263640e-04,8.26083306e-06,1.50035316e-06,-1.32349697e-07}},
+  {{3.29902420e+01,5.24434566e+00,-6.05593681e+00,-2.95388639e-01,1.77490160e-01,1.33763757e-02,-5.11221960e-03,-1.17876893e-03},{-4.14335871e+00,-3.49192262e+00,-2.64946604e+00,2.45976210e+00,4.60211039e-01,-2.03600630e-01,-3.66737507e-02,1.05597936e-02},{1.31424963e+00,-1.56847966e+00,-2.37683669e-01,8.29072073e-02,5.09544229e-03,-1.10922172e-03,-9.10104609e-06,2.74396575e-06},{2.02131367e+00,7.40607874e-03,-3.94390570e-03,-3.75065138e-04,9.82280544e-05,4.04617867e-06,-7.77502351e-07,1.69302155e-08}},
+  {{-1.16291132e+01,-2.05364761e+01,1.93858242e+00,1.11121178e+00,1.92789640e-02,-8.48547742e-03,-4.89936536e-03,-9.42921615e-04},{1.22889404e+01,7.40493107e+00,-7.06245422e+00,-2.48689699e+00,4.86203760e-01,1.86556056e-01,1.13040488e-02,-6.70952583e-03},{-2.72669339e+00,2.13780701e-01,5.22120357e-01,-6.52011298e-03,-1.40403863e-02,-2.36761465e-04,1.51548767e-04,1.26832310e-05},{1.99717641e+00,-1.56198842e-02,4.88961290e-04,8.62243178e-04,-2.62676394e-06,-1.38192236e-05,-4.18014594e-07,1.05117550e-07}},
+  {{-1.71585159e+01,1.89783592e+01,3.16393018e+00,-1.14619362e+00,-1.95230264e-02,2.29777843e-02,-6.23128470e-03,3.22629407e-04},{-9.13291073e+00,-2.94354081e-01,8.47231197e+00,-1.44269633e+00,-8.21206331e-01,1.76859707e-01,1.67545136e-02,-1.34383170e-02},{1.90201771e+00,1.30380452e+00,-3.76864135e-01,-7.13850409e-02,1.14768278e-02,1.10320945e-03,-1.88446182e-04,-6.90313482e-06},{1.98292494e+00,1.10045355e-02,3.30410618e-03,-6.39217382e-04,-8.70559452e-05,1.24381822e-05,8.72750263e-07,-1.75004658e-07}},
+  {{3.39221954e+01,-1.59032845e+00,-6.20232105e+00,1.21604756e-01,1.86514795e-01,-7.02591427e-03,-6.33483985e-03,5.65855415e-04},{-2.33662128e+00,-3.90271139e+00,1.50178039e+00,2.76601982e+00,-1.82670623e-01,-2.42333144e-01,1.50487451e-02,1.50762210e-02},{4.84320641e-01,-1.75191069e+00,-8.70660096e-02,9.09990966e-02,1.82072655e-03,-1.12790696e-03,-1.76721778e-06,7.98933968e-07},{2.02385974e+00,2.72455765e-03,-4.38815868e-03,-1.36726623e-04,1.06215077e-04,1.40450709e-06,-7.26962526e-07,7.91554822e-09}},
+  {{-2.08892517e+01,-1.71726913e+01,3.83196092e+00,1.08270562e+00,-3.55821066e-02,-2.86090970e-02,-6.40909513e-03,1.69683000e-04},{1.17302561e+01,-9.52604830e-01,-9.61191273e+00,-7.94140399e-01,9.67499971e-01,1.48123443e-01,-3.38786989e-02,-1.56559609e-02},{-2.47465420e+00,7.74990022e-01,4.82299536e-01,-3.89207527e-02,-1.38463164e-02,3.64511128e-04,1.89949118e-04,6.18165996e-06},{1.98979223e+00,-1.42488675e-02,1.92851305e-03,8.07588804e-04,-4.37927156e-05,-1.43527877e-05,1.19599292e-07,1.57497112e-07}},
+  {{-7.17253733e+00,2.15213013e+01,1.17204750e+00,-1.15000606e+00,2.30530798e-02,5.65093243e-03,-3.52568622e-03,1.02328591e-03},{-1.04986095e+01,6.57448769e+00,5.12490654e+00,-2.76620531e+00,-3.03236216e-01,1.80246025e-01,-1.38423191e-02,-1.58893375e-03},{2.43365049e+00,8.29211652e-01,-4.75118726e-01,-4.21610810e-02,1.37246046e-02,4.32274275e-04,-1.92120933e-04,5.17496392e-06},{1.98908389e+00,1.40197705e-02,2.06867000e-03,-7.96624459e-04,-4.80229501e-05,1.42942308e-05,1.85143975e-07,-1.61438678e-07}},
+  {{3.15369377e+01,-8.23668861e+00,-5.68219090e+00,5.03182709e-01,1.44933358e-01,-2.19961200e-02,-2.08026031e-03,1.55756110e-03},{-2.61553168e-01,-8.63779247e-01,5.13217545e+00,1.77499318e+00,-7.12084711e-01,-1.23814553e-01,5.12446314e-02,2.83190235e-03},{-3.94931108e-01,-1.76095557e+00,7.09847808e-02,9.13924873e-02,-1.48281583e-03,-1.12854526e-03,1.38405187e-06,7.05842240e-07},{2.02398562e+00,-2.22166697e-03,-4.40999819e-03,1.11452871e-04,1.06597086e-04,-1.14227316e-06,-7.24112681e-07,-6.51868914e-09}},
+  {{-2.78415680e+01,-1.18865595e+01,5.48014784e+00,8.71540546e-01,-1.38505161e-01,-4.21498790e-02,-1.09537656e-03,2.40378827e-03},{9.30812931e+00,-9.77489567e+00,-8.83769989e+00,1.55016172e+00,1.10850072e+00,-4.54171859e-02,-7.51292482e-02,-4.92385821e-03},{-1.96662557e+00,1.26049376e+00,3.89133930e-01,-6.86563179e-02,-1.17943659e-02,1.03616959e-03,1.91083163e-04,-5.54759390e-06},{1.98348427e+00,-1.13737397e-02,3.19077470e-03,6.59332785e-04,-8.33478189e-05,-1.27374869e-05,8.01305646e-07,1.76022695e-07}},
+  {{3.67102194e+00,2.17985039e+01,-7.90907741e-01,-1.08753109e+00,3.22270095e-02,1.85884448e-04,4.11298126e-04,8.97822028e-04},{-1.02251663e+01,9.68351364e+00,4.15073395e-01,-2.94213033e+00,1.70819566e-01,1.40891194e-01,-7.96056353e-03,4.80999099e-03},{2.71344042e+00,2.73032159e-01,-5.20557702e-01,-9.84118599e-03,1.40973199e-02,-1.81679876e-04,-1.56536902e-04,1.23084674e-05},{1.99639177e+00,1.55524146e-02,6.39923383e-04,-8.60929780e-04,-6.74691864e-06,1.39549147e-05,-3.72775645e-07,-1.11165846e-07}},
+  {{2.60299644e+01,-1.40443335e+01,-4.60421705e+00,7.71483898e-01,8.31104144e-02,-2.08020490e-02,2.70464574e-03,7.98065215e-04},{2.24144459e+00,4.54149199e+00,6.63089991e+00,2.26946641e-02,-8.46684277e-01,3.46740931e-02,3.77258472e-02,-9.68453288e-03},{-1.23388362e+00,-1.59482467e+00,2.22967476e-01,8.40802044e-02,-4.76325909e-03,-1.11248926e-03,7.94515381e-06,2.45898514e-06},{2.02167869e+00,-6.95165526e-03,-4.00782283e-03,3.51606082e-04,9.93983413e-05,-3.76722710e-06,-7.70977920e-07,-1.65249130e-08}},
+  {{-3.18242016e+01,-5.19750309e+00,6.55700588e+00,4.33744729e-01,-2.39975318e-01,-2.85608489e-02,8.80014058e-03,2.52100057e-03},{5.67213821e+00,-1.60552692e+01,-4.71929646e+00,3.49324942e+00,6.43057346e-01,-2.74721861e-01,-5.33608571e-02,1.55989220e-02},{-1.25481963e+00,1.61630857e+00,2.51038462e-01,-9.14693028e-02,-7.90659245e-03,1.62402540e-03,1.42167031e-04,-1.83463999e-05},{1.97890747e+00,-7.28049036e-03,4.12581395e-03,4.29008738e-04,-1.14750139e-04,-8.78286482e-06,1.44523631e-06,1.39338383e-07}},
+  {{1.41609669e+01,1.98748455e+01,-2.61784101e+00,-9.96684074e-01,4.27052863e-02,6.64682640e-03,3.20576364e-03,4.69931547e-04},{-8.89568520e+00,8.43023872e+00,-3.76107025e+00,-2.09384084e+00,5.56607962e-01,1.20759904e-01,-4.08410281e-03,-2.68468354e-03},{2.71311474e+00,-3.04946005e-01,-5.11035800e-01,2.15854328e-02,1.29024405e-02,-6.40005339e-04,-1.04197141e-04,1.33348376e-05},{2.00409174e+00,1.54683618e-02,-8.23020586e-04,-8.33045342e-04,3.12668344e-05,1.20417790e-05,-7.09668029e-07,-5.30671826e-08}},
+  {{1.78818817e+01,-1.84667168e+01,-3.14559340e+00,9.20770228e-01,3.93662527e-02,-9.09541827e-03,3.84438364e-03,-2.58454471e-04},{5.26555872e+00,1.01006317e+01,5.31026602e+00,-1.69348395e+00,-6.42958283e-01,1.09574534e-01,5.06337639e-03,-6.62747072e-03},{-1.94686735e+00,-1.26830947e+00,3.55544180e-01,6.92289248e-02,-7.93386810e-03,-1.05466426e-03,2.53452708e-05,5.99570831e-06},{2.01717305e+00,-1.10017061e-02,-3.21205938e-03,5.65468101e-04,8.42320587e-05,-6.58203362e-06,-8.30679255e-07,-1.29423299e-08}},
+  {{-3.24979286e+01,2.13890576e+00,6.79157734e+00,-1.44371465e-01,-2.68425018e-01,8.61616991e-03,1.20531050e-02,-8.83986999e-04},{1.45781052e+00,-1.77202168e+01,1.21441090e+00,3.94639397e+00,-2.32613489e-01,-3.33036065e-01,2.07208879e-02,2.10659709e-02},{-4.12871897e-01,1.80170381e+00,8.30684602e-02,-1.03701353e-01,-2.66788574e-03,1.96383102e-03,5.04029849e-05,-2.65633753e-05},{1.97653806e+00,-2.39944761e-03,4.61634621e-03,1.42587218e-04,-1.31943307e-04,-3.00569332e-06,1.83331451e-06,5.08442461e-08}},
+  {{2.31615009e+01,1.59890308e+01,-4.21681261e+00,-8.48742008e-01,7.88793117e-02,1.79705229e-02,3.12694511e-03,-4.92072140e-04},{-7.21635199e+00,4.12906694e+00,-5.85615444e+00,-4.98375237e-01,8.21766734e-01,6.38605356e-02,-2.88076848e-02,-9.62195639e-03},{2.43354440e+00,-8.45243216e-01,-4.50517297e-01,4.90214527e-02,1.06237531e-02,-9.21210623e-04,-5.61932975e-05,1.01341211e-05},{2.01138949e+00,1.38056008e-02,-2.17050593e-03,-7.24373211e-04,6.25197717e-05,9.31541035e-06,-8.37058508e-07,-8.68554739e-09}},
+  {{7.87477064e+00,-2.11018085e+01,-1.46100819e+00,1.00327861e+00,2.70402711e-02,9.50132904e-04,1.80239358e-03,-7.46740028e-04},{8.52828789e+00,1.32020092e+01,1.56801939e+00,-2.81424785e+00,-3.10388803e-01,1.17504776e-01,3.48643342e-04,4.39264346e-03},{-2.46064591e+00,-8.11161399e-01,4.56038296e-01,4.73436303e-02,-1.08013162e-02,-9.07263369e-04,5.90041564e-05,1.04202272e-05},{2.01092649e+00,-1.39638167e-02,-2.08604289e-03,7.33894354e-04,6.06639042e-05,-9.51094717e-06,-8.33713727e-07,1.10148921e-08}},
+  {{-2.98082047e+01,9.25014782e+00,6.11194611e+00,-6.82112336e-01,-2.02025115e-01,3.79333422e-02,4.42352518e-03,-2.94582476e-03},{-2.86482525e+00,-1.43177700e+01,6.50846100e+00,2.63865018e+00,-9.52529252e-01,-1.65138736e-01,7.32793435e-02,4.88372380e-03},{4.71885175e-01,1.79507411e+00,-9.49339941e-02,-1.03259861e-01,3.04710423e-03,1.95129355e-03,-5.74703881e-05,-2.62515186e-05},{1.97662258e+00,2.74243345e-03,4.59876191e-03,-1.62936398e-04,-1.31318666e-04,3.43131865e-06,1.81881569e-06,-5.79163704e-08}},
+  {{2.97726536e+01,1.05359764e+01,-5.44551277e+00,-5.93602955e-01,1.36813805e-01,2.20347214e-02,-9.00024315e-04,-1.48158486e-03},{-5.54390764e+00,-7.63634324e-01,-5.13288832e+00,1.33105707e+00,7.94505894e-01,-7.84459040e-02,-5.13576642e-02,-1.73239957e-03},{1.90432298e+00,-1.29474711e+00,-3.47470164e-01,7.04559907e-02,7.72645092e-03,-1.06071855e-03,-2.36992528e-05,5.71175224e-06},{2.01753640e+00,1.07585331e-02,-3.27677769e-03,-5.52242156e-04,8.55118924e-05,6.38622805e-06,-8.27506994e-07,1.37664724e-08}},
+  {{-2.94554615e+00,-2.16895332e+01,3.65191758e-01,1.06986237e+00,2.95640081e-02,1.12899847e-03,-1.72844110e-03,-9.72467940e-04},{1.12144375e+01,1.19432096e+01,-3.35019588e+00,-3.06671691e+00,8.38940516e-02,1.47784159e-01,1.68024506e-02,4.04795539e-03},{-2.72189569e+00,-2.66550928e-01,5.13318896e-01,1.95625965e-02,-1.30218770e-02,-6.14732504e-04,1.07775450e-04,1.34284819e-05},{2.00357699e+00,-1.55239264e-02,-7.26478815e-04,8.37579020e-04,2.88864667e-05,-1.22037409e-05,-6.94016251e-07,5.67216638e-08}},
+  {{-2.39730968e+01,1.52919788e+01,4.68395329e+00,-1.02826107e+00,-9.25012082e-02,3.79478969e-02,-4.30620182e-03,-1.35378877e-03},{-6.74990177e+00,-7.16088915e+00,9.04219341e+00,3.45026970e-01,-1.09830129e+00,6.86727986e-02,5.80229796e-02,-1.26117868e-02},{1.30761623e+00,1.59720743e+00,-2.61456609e-01,-9.02225748e-02,8.21822975e-03,1.59038568e-03,-1.46997045e-04,-1.75644327e-05},{1.97915208e+00,7.58566754e-03,4.07539401e-03,-4.46614547e-04,-1.13011803e-04,9.11563620e-06,1.40742702e-06,-1.43626451e-07}},
+  {{3.33992958e+01,4.05816221e+00,-6.13230133e+00,-2.24010319e-01,1.83034122e-01,1.02124484e-02,-5.76190557e-03,-9.39122343e-04},{-3.85855198e+00,-3.82918143e+00,-1.96235752e+00,2.61192107e+00,3.57505143e-01,-2.22418875e-01,-2.92097032e-02,1.26194237e-02},{1.18035138e+00,-1.61113679e+00,-2.13172108e-01,8.48051235e-02,4.54382878e-03,-1.11439347e-03,-7.24582287e-06,2.28233444e-06},{2.02190471e+00,6.64889580e-03,-4.04739892e-03,-3.36008932e-04,1.00119476e-04,3.58448187e-06,-7.66774747e-07,1.61806444e-08}},
+  {{-1.33896170e+01,-2.01000977e+01,2.27745390e+00,1.11487329e+00,1.35834748e-02,-1.15805184e-02,-5.46811055e-03,-8.60410859e-04},{1.23462744e+01,6.11929464e+00,-7.70885706e+00,-2.26519561e+00,5.78015387e-01,1.89837605e-01,5.95901906e-03,-9.20530502e-03},{-2.70292401e+00,3.11813831e-01,5.19173563e-01,-1.20310672e-02,-1.41245415e-02,-1.44431659e-04,1.59708157e-04,1.20228551e-05},{1.99587929e+00,-1.54976044e-02,7.38933799e-04,8.59466556e-04,-9.47895751e-06,-1.40339371e-05,-3.41574889e-07,1.15096519e-07}},
+  {{-1.55160780e+01,1.95900154e+01,2.81970143e+00,-1.15576088e+00,-8.44135508e-03,1.94219761e-02,-6.03373349e-03,5.52247919e-04},{-9.48389339e+00,1.09277213e+00,8.06120586e+00,-1.75517893e+00,-7.35867977e-01,1.85959741e-01,8.62313900e-03,-1.19356951e-02},{2.00765324e+00,1.23116255e+00,-3.96897763e-01,-6.68145418e-02,1.19912354e-02,9.91461566e-04,-1.92498017e-04,-4.66144365e-06},{1.98386300e+00,1.16080511e-02,3.11405584e-03,-6.72015129e-04,-8.08522818e-05,1.29192249e-05,7.54000780e-07,-1.76336926e-07}},
+  {{3.37453041e+01,-2.79544139e+00,-6.15863323e+00,1.94617093e-01,1.82461008e-01,-1.05861016e-02,-5.90297487e-03,8.68171745e-04},{-2.01725483e+00,-3.61069679e+00,2.23857355e+00,2.67934012e+00,-2.96317101e-01,-2.31261149e-01,2.42998395e-02,1.39095848e-02},{3.35972428e-01,-1.76565683e+00,-6.03690110e-02,9.15958434e-02,1.26006955e-03,-1.12879858e-03,-1.15018452e-06,6.57064106e-07},{2.02405095e+00,1.88975304e-03,-4.42134170e-03,-9.47666413e-05,1.06792882e-04,9.69801704e-07,-7.22507821e-07,5.57532776e-09}},
+  {{-2.23087597e+01,-1.63720188e+01,4.14900541e+00,1.06143868e+00,-5.08594699e-02,-3.21323127e-02,-6.05848897e-03,5.31503931e-04},{1.14348478e+01,-2.54882193e+00,-9.74111557e+00,-4.06383544e-01,1.02855182e+00,1.24641031e-01,-4.34956662e-02,-1.53173516e-02},{-2.40488791e+00,8.64229321e-01,4.70012933e-01,-4.42685597e-02,-1.36310179e-02,4.77205089e-04,1.93273736e-04,4.48033234e-06},{1.98862720e+00,-1.38584096e-02,2.15936918e-03,7.88735633e-04,-5.07882251e-05,-1.42399822e-05,2.29144760e-07,1.63776889e-07}},
+  {{-5.29108524e+00,2.17396240e+01,8.20453823e-01,-1.14215207e+00,2.61282846e-02,3.71347670e-03,-2.82479753e-03,1.03276770e-03},{-1.05478458e+01,7.42839146e+00,4.33893061e+00,-2.88028669e+00,-2.13093191e-01,1.73194915e-01,-1.48333795e-02,4.90956532e-04},{2.49961710e+00,7.38787770e-01,-4.86616939e-01,-3.67675796e-02,1.39127383e-02,3.20310588e-04,-1.88255581e-04,6.81074607e-06},{1.99026525e+00,1.43879289e-02,1.83500198e-03,-8.14098399e-04,-4.09935383e-05,1.43757679e-05,7.73818982e-08,-1.54664718e-07}},
+  {{3.07867146e+01,-9.34109592e+00,-5.52853060e+00,5.60270786e-01,1.34253502e-01,-2.30189841e-02,-1.09414023e-03,1.52712048e-03},{1.20113567e-01,-3.20351571e-02,5.59128952e+00,1.49870646e+00,-7.67752588e-01,-9.40844864e-02,5.24471700e-02,-1.16306137e-05},{-5.42603552e-01,-1.74458086e+00,9.75775048e-02,9.06773359e-02,-2.04284652e-03,-1.12723676e-03,2.05524975e-06,8.73986380e-07},{2.02375770e+00,-3.05282162e-03,-4.37041977e-03,1.53270696e-04,1.05899082e-04,-1.57784166e-06,-7.29053795e-07,-8.79461215e-09}},
+  {{-2.87776070e+01,-1.07915401e+01,5.72122908e+00,8.10371399e-01,-1.58578441e-01,-4.21048701e-02,5.66414441e-04,2.69777258e-03},{8.75187397e+00,-1.11323566e+01,-8.33551502e+00,1.95665538e+00,1.07245469e+00,-8.92492160e-02,-7.67900422e-02,-1.32888206e-03},{-1.85799563e+00,1.33115375e+00,3.68446529e-01,-7.31194392e-02,-1.12538887e-02,1.14646845e-03,1.86342586e-04,-7.79664333e-06},{1.98257232e+00,-1.07523752e-02,3.37580964e-03,6.25347719e-04,-8.94234254e-05,-1.22234133e-05,9.19250908e-07,1.73922018e-07}},
+  {{5.58180141e+00,2.16181526e+01,-1.12555504e+00,-1.07405365e+00,3.30309048e-02,5.90123178e-04,1.03105907e-03,8.47187242e-04},{-1.00416670e+01,9.75253963e+00,-4.12183166e-01,-2.86123681e+00,2.44702131e-01,1.36367351e-01,-5.74551104e-03,4.32204781e-03},{2.73300648e+00,1.74713045e-01,-5.22684097e-01,-4.34305519e-03,1.39901200e-02,-2.71895260e-04,-1.48136256e-04,1.28876563e-05},{1.99769390e+00,1.56504698e-02,3.89514491e-04,-8.62336601e-04,5.98575696e-08,1.37174520e-05,-4.46204041e-07,-1.01085654e-07}},
+  {{2.47679062e+01,-1.49410677e+01,-4.36920357e+00,8.05696726e-01,7.31919333e-02,-1.91584844e-02,3.21326940e-03,5.85780712e-04},{2.71588254e+00,5.59106970e+00,6.61039734e+00,-3.03796500e-01,-8.29521358e-01,5.56654707e-02,3.17357406e-02,-1.04147801e-02},{-1.36582196e+00,-1.54977942e+00,2.47169942e-01,8.20676684e-02,-5.31244930e-03,-1.10653066e-03,9.95533264e-06,2.94343363e-06},{2.02105498e+00,-7.69819180e-03,-3.89844296e-03,3.90231959e-04,9.73830829e-05,-4.23061465e-06,-7.81683070e-07,-1.70908638e-08}},
+  {{-3.21922722e+01,-3.92657757e+00,6.66520548e+00,3.37664992e-01,-2.51921177e-01,-2.30619106e-02,1.01781758e-02,2.10008584e-03},{4.97770309e+00,-1.67143211e+01,-3.74663353e+00,3.70336652e+00,5.05253017e-01,-3.02111000e-01,-4.24485654e-02,1.82449594e-02},{-1.11854208e+00,1.66037631e+00,2.24078879e-01,-9.43572521e-02,-7.09060999e-03,1.70286000e-03,1.29044216e-04,-2.02076390e-05},{1.97834337e+00,-6.49238238e-03,4.24222415e-03,3.83340608e-04,-1.18789249e-04,-7.90316608e-06,1.53436781e-06,1.27367571e-07}},
+  {{1.58883190e+01,1.93246956e+01,-2.92070842e+00,-9.76536870e-01,4.69374284e-02,8.60337168e-03,3.45838838e-03,3.44163709e-04},{-8.61282921e+00,7.81837320e+00,-4.31572247e+00,-1.85619915e+00,6.15624189e-01,1.16014458e-01,-6.53629843e-03,-4.55011241e-03},{2.68439412e+00,-4.00852501e-01,-5.04081309e-01,2.65891142e-02,1.25759114e-02,-6.99605211e-04,-9.52715272e-05,1.30035378e-05},{2.00537992e+00,1.52911302e-02,-1.06360647e-03,-8.19720619e-04,3.71064962e-05,1.16145702e-05,-7.44348199e-07,-4.41764314e-08}},
+  {{1.62236958e+01,-1.90722523e+01,-2.86070609e+00,9.38363194e-01,3.49699780e-02,-6.88500050e-03,3.66030284e-03,-3.85005551e-04},{5.82243586e+00,1.09068317e+01,4.80368137e+00,-1.94532692e+00,-5.88881016e-01,1.13236845e-01,1.44209177e-03,-4.69396403e-03},{-2.04955959e+00,-1.19864655e+00,3.75141382e-01,6.59750924e-02,-8.44853185e-03,-1.03731151e-03,2.98443465e-05,6.72805754e-06},{2.01621652e+00,-1.15894703e-02,-3.04134772e-03,5.97714738e-04,8.08147815e-05,-7.07651952e-06,-8.37336927e-07,-1.04248503e-08}},
+  {{-3.22669258e+01,3.43576503e+00,6.73654509e+00,-2.47478753e-01,-2.62946993e-01,1.53361643e-02,1.13520678e-02,-1.50919450e-03},{7.14143872e-01,-1.74718990e+01,2.26082349e+00,3.83380222e+00,-3.87469143e-01,-3.17570984e-01,3.37606668e-02,1.94739867e-02},{-2.63072014e-01,1.81406486e+00,5.29473908e-02,-1.04527414e-01,-1.70266896e-03,1.98751618e-03,3.22718115e-05,-2.71594308e-05},{1.97638047e+00,-1.52900838e-03,4.64915205e-03,9.09097362e-05,-1.33114736e-04,-1.92001539e-06,1.86078819e-06,3.26136451e-08}},
+  {{2.45240707e+01,1.51267767e+01,-4.46651220e+00,-8.12653899e-01,8.82574171e-02,1.95990615e-02,2.68311799e-03,-7.06202467e-04},{-6.92918301e+00,3.22080326e+00,-5.93684578e+00,-1.72361076e-01,8.44348907e-01,4.44496162e-02,-3.44992541e-02,-9.39979032e-03},{2.35964417e+00,-9.29134667e-01,-4.35659289e-01,5.31146862e-02,1.01627251e-02,-9.53204348e-04,-4.94543237e-05,9.38767789e-06},{2.01253152e+00,1.33760041e-02,-2.37797084e-03,-6.98977034e-04,6.70105073e-05,8.81836331e-06,-8.42505870e-07,-3.29648930e-09}},
+  {{5.98923016e+00,-2.13593063e+01,-1.14675319e+00,1.01521599e+00,2.71815341e-02,1.85705314e-03,1.25396438e-03,-7.94548076e-04},{9.06171989e+00,1.33417397e+01,7.43340194e-01,-2.92779064e+00,-2.46489108e-01,1.19422331e-01,2.92065577e-03,5.56999817e-03},{-2.52348518e+00,-7.23347843e-01,4.69004095e-01,4.29892279e-02,-1.12340422e-02,-8.68997944e-04,6.63991668e-05,1.11091076e-05},{2.00973487e+00,-1.43320076e-02,-1.86813949e-03,7.56456458e-04,5.58126922e-05,-9.99765689e-06,-8.22223853e-07,1.73433019e-08}},
+  {{-2.89956970e+01,1.04165354e+01,5.90655518e+00,-7.59577751e-01,-1.83676332e-01,4.01256643e-02,2.60471529e-03,-2.87008169e-03},{-3.57701874e+00,-1.32698307e+01,7.19276905e+00,2.27294827e+00,-1.02427185e+00,-1.22372463e-01,7.55370259e-02,1.12253497e-03},{6.19658947e-01,1.77427745e+00,-1.24581732e-01,-1.01878859e-01,3.98999825e-03,1.91229698e-03,-7.48513121e-05,-2.52877308e-05},{1.97688782e+00,3.60053894e-03,4.54364950e-03,-2.13713734e-04,-1.29368156e-04,4.48602350e-06,1.77383481e-06,-7.51936682e-08}},
+  {{3.06407642e+01,9.44785023e+00,-5.61127996e+00,-5.35532534e-01,1.47123769e-01,2.11379547e-02,-1.87072286e-03,-1.53317407e-03},{-5.26862812e+00,-1.50385582e+00,-4.71956491e+00,1.62118876e+00,7.46301830e-01,-1.08062804e-01,-5.12551069e-02,9.15059587e-04},{1.79295826e+00,-1.35859787e+00,-3.26474756e-01,7.33985677e-02,7.19838310e-03,-1.07419246e-03,-1.98945636e-05,5.01984096e-06},{2.01841521e+00,1.01233888e-02,-3.43281403e-03,-5.18012093e-04,8.85593545e-05,5.89619231e-06,-8.18484637e-07,1.54251047e-08}},
+  {{-4.85220146e+00,-2.15662003e+01,6.98927522e-01,1.08040535e+00,2.91108768e-02,-1.66714308e-04,-2.42492487e-03,-9.96679417e-04},{1.15466089e+01,1.12360678e+01,-4.21060610e+00,-3.00633049e+00,1.63893044e-01,1.56979859e-01,1.81178637e-02,2.25671032e-03},{-2.73829389e+00,-1.69082507e-01,5.18015444e-01,1.43888965e-02,-1.32996710e-02,-5.47418254e-04,1.16853385e-04,1.35721048e-05},{2.00227213e+00,-1.56314224e-02,-4.81061026e-04,8.47318093e-04,2.27565688e-05,-1.25938350e-05,-6.50201855e-07,6.61915820e-08}},
+  {{-2.26487827e+01,1.61917324e+01,4.37700415e+00,-1.06522119e+00,-7.44430795e-02,3.53607684e-02,-5.16330497e-03,-9.38518904e-04},{-7.31431532e+00,-5.70611525e+00,9.11509132e+00,-6.87176287e-02,-1.06237304e+00,1.00714646e-01,4.98792380e-02,-1.39965592e-02},{1.43802953e+00,1.54568911e+00,-2.87074804e-01,-8.68743211e-02,8.97403900e-03,1.50091830e-03,-1.58228038e-04,-1.55117468e-05},{1.97981262e+00,8.33831448e-03,3.93957179e-03,-4.89768339e-04,-1.08356850e-04,9.91418347e-06,1.30742262e-06,-1.53294991e-07}},
+  {{3.36989861e+01,2.85426474e+00,-6.18631220e+00,-1.50524095e-01,1.86956376e-01,6.70634117e-03,-6.24491647e-03,-6.49374968e-04},{-3.56999588e+00,-4.05417347e+00,-1.23998940e+00,2.72293949e+00,2.47070149e-01,-2.36503810e-01,-2.05971301e-02,1.42080681e-02},{1.04299927e+00,-1.64907682e+00,-1.88133731e-01,8.64839256e-02,3.98968812e-03,-1.11850351e-03,-5.69084523e-06,1.87526848e-06},{2.02243090e+00,5.87311946e-03,-4.13934374e-03,-2.96246493e-04,1.01782069e-04,3.12870111e-06,-7.56615009e-07,1.50528638e-08}},
+  {{-1.51039410e+01,-1.95892830e+01,2.61593604e+00,1.11521828e+00,6.24905434e-03,-1.49708185e-02,-5.94326062e-03,-7.33943714e-04},{1.23395386e+01,4.73791504e+00,-8.27874088e+00,-2.00785398e+00,6.68988466e-01,1.89468846e-01,-8.12703220e-04,-1.14542777e-02},{-2.67104673e+00,4.09064353e-01,5.14626145e-01,-1.75607353e-02,-1.41621307e-02,-4.75844099e-05,1.67335354e-04,1.11781646e-05},{1.99459553e+00,-1.53284436e-02,9.87542560e-04,8.53992940e-04,-1.64184585e-05,-1.42012632e-05,-2.58609589e-07,1.24807059e-07}},
+  {{-1.38088799e+01,2.01299858e+01,2.46967411e+00,-1.16065168e+00,9.87376785e-04,1.59830227e-02,-5.67519851e-03,7.30211323e-04},{-9.78222466e+00,2.41297412e+00,7.55899286e+00,-2.03449798e+00,-6.45659864e-01,1.90559834e-01,1.48066517e-03,-1.00166593e-02},{2.10720015e+00,1.15487337e+00,-4.15589869e-01,-6.20532110e-02,1.24509418e-02,8.77725659e-04,-1.95064684e-04,-2.46664172e-06},{1.98485005e+00,1.21751809e-02,2.91484082e-03,-7.02364021e-04,-7.44285935e-05,1.33307167e-05,6.34766366e-07,-1.76041866e-07}},
+  {{3.34538231e+01,-3.99288821e+00,-6.09165430e+00,2.65998185e-01,1.76683620e-01,-1.38554657e-02,-5.28929988e-03,1.12688972e-03},{-1.68865883e+00,-3.20193791e+00,2.94668269e+00,2.54962015e+00,-4.03558254e-01,-2.14974120e-01,3.26351374e-02,1.21860467e-02},{1.86681464e-01,-1.77429819e+00,-3.35320681e-02,9.19698030e-02,6.99048629e-04,-1.12929649e-03,-6.12873691e-07,5.68274061e-07},{2.02417135e+00,1.04990858e-03,-4.44218796e-03,-5.26246222e-05,1.07153479e-04,5.37216636e-07,-7.19615286e-07,3.12746229e-09}},
+  {{-2.36460495e+01,-1.55058470e+01,4.45600939e+00,1.03335762e+00,-6.76674768e-02,-3.53236161e-02,-5.45232650e-03,9.29752714e-04},{1.10843801e+01,-4.14339590e+00,-9.75494099e+00,-8.06319760e-04,1.07592773e+00,9.58307385e-02,-5.25806248e-02,-1.42517565e-02},{-2.32790756e+00,9.50954676e-01,4.56202328e-01,-4.95172106e-02,-1.33605106e-02,5.91364806e-04,1.95398388e-04,2.63525271e-06},{1.98749745e+00,-1.34253884e-02,2.38423003e-03,7.67182210e-04,-5.77063329e-05,-1.40617840e-05,3.42322750e-07,1.68914553e-07}},
+  {{-3.38525152e+00,2.18792286e+01,4.69916403e-01,-1.13242888e+00,2.83101425e-02,2.20418698e-03,-2.10947217e-03,1.02310604e-03},{-1.05488729e+01,8.14435482e+00,3.51934028e+00,-2.95605254e+00,-1.25520512e-01,1.65560275e-01,-1.46406544e-02,2.24339962e-03},{2.55804062e+00,6.46315396e-01,-4.96547908e-01,-3.13086100e-02,1.40468366e-02,2.10842380e-04,-1.83336175e-04,8.28120847e-06},{1.99147618e+00,1.47118056e-02,1.59660238e-03,-8.28829070e-04,-3.39358230e-05,1.43953421e-05,-2.56491557e-08,-1.46964169e-07}},
+  {{2.99292297e+01,-1.04128027e+01,-5.35583782e+00,6.13099813e-01,1.23089075e-01,-2.34584138e-02,-1.30486980e-04,1.43781991e-03},{5.17925024e-01,8.72795641e-01,5.97037697e+00,1.20124066e+00,-8.08929682e-01,-6.39854893e-02,5.18662147e-02,-2.72550574e-03},{-6.88615859e-01,-1.72316551e+00,1.23920202e-01,8.97401571e-02,-2.60190666e-03,-1.12543104e-03,2.86490808e-06,1.09526513e-06},{2.02345991e+00,-3.87506816e-03,-4.31863777e-03,1.94757507e-04,1.04982355e-04,-2.01657576e-06,-7.35409401e-07,-1.08908065e-08}},
+  {{-2.96076221e+01,-9.65212536e+00,5.94029999e+00,7.41579950e-01,-1.78174049e-01,-4.10428792e-02,2.34800670e-03,2.89365975e-03},{8.16298962e+00,-1.23902912e+01,-7.72575903e+00,2.34251547e+00,1.01520336e+00,-1.33145332e-01,-7.60421231e-02,2.47217901e-03},{-1.74380279e+00,1.39778352e+00,3.46516639e-01,-7.73594379e-02,-1.06609594e-02,1.25345960e-03,1.80099698e-04,-1.00510788e-05},{1.98171365e+00,-1.00976229e-02,3.55059677e-03,5.89072995e-04,-9.52272094e-05,-1.16412903e-05,1.03502259e-06,1.70118625e-07}},
+  {{7.47153807e+00,2.13619061e+01,-1.45505798e+00,-1.05946612e+00,3.41093764e-02,1.36535277e-03,1.60488696e-03,7.87935627e-04},{-9.83299828e+00,9.67632103e+00,-1.20965481e+00,-2.74744129e+00,3.15914124e-01,1.32651210e-01,-3.93692264e-03,3.36381234e-03},{2.74436474e+00,7.61005804e-02,-5.23219943e-01,1.10769819e-03,1.38396956e-02,-3.57141573e-04,-1.39383599e-04,1.32874820e-05},{1.99900305e+00,1.57013256e-02,1.39004143e-04,-8.61101784e-04,6.74357716e-06,1.34383845e-05,-5.12867416e-07,-9.09429829e-08}},
+  {{2.34194107e+01,-1.57848635e+01,-4.12213421e+00,8.35773766e-01,6.40779361e-02,-1.72272678e-02,3.58188595e-03,3.76618147e-04},{3.21038771e+00,6.63350821e+00,6.49335051e+00,-6.24152124e-01,-8.02026093e-01,7.32205510e-02,2.54129749e-02,-1.05505586e-02},{-1.49366009e+00,-1.50020635e+00,2.70739168e-01,7.98389688e-02,-5.85791701e-03,-1.09921244e-03,1.23171676e-05,3.47899595e-06},{2.02036929e+00,-8.42258148e-03,-3.77791515e-03,4.27997671e-04,9.51359470e-05,-4.69996212e-06,-7.92535445e-07,-1.72174150e-08}},
+  {{-3.24445801e+01,-2.64105463e+00,6.74307251e+00,2.37942696e-01,-2.60990143e-01,-1.68836676e-02,1.12510510e-02,1.56357908e-03},{4.26923704e+00,-1.72135944e+01,-2.72652912e+00,3.85833907e+00,3.56189728e-01,-3.22574854e-01,-3.00504081e-02,2.02316195e-02},{-9.78937507e-01,1.69931936e+00,1.96346804e-01,-9.69207808e-02,-6.23875204e-03,1.77364692e-03,1.14743343e-04,-2.19049853e-05},{1.97784531e+00,-5.68406144e-03,4.34520608e-03,3.36210913e-04,-1.22386162e-04,-6.97439873e-06,1.61490016e-06,1.13945070e-07}},
+  {{1.75541058e+01,1.87096901e+01,-3.21434712e+00,-9.54015553e-01,5.21146655e-02,1.06591759e-02,3.60466330e-03,1.97902613e-04},{-8.32733154e+00,7.11768293e+00,-4.79247475e+00,-1.59555638e+00,6.70327365e-01,1.09448597e-01,-1.00272615e-02,-6.26407890e-03},{2.64765406e+00,-4.95345235e-01,-4.95683372e-01,3.14614661e-02,1.22208931e-02,-7.54046312e-04,-8.65828406e-05,1.25632077e-05},{2.00665236e+00,1.50687443e-02,-1.30004762e-03,-8.04137264e-04,4.27337800e-05,1.11680911e-05,-7.73144336e-07,-3.57867371e-08}},
+  {{1.45121250e+01,-1.96121578e+01,-2.56981921e+00,9.53835368e-01,3.16400491e-02,-4.80585871e-03,3.38407792e-03,-4.90179227e-04},{6.38842916e+00,1.16181936e+01,4.22106695e+00,-2.17466903e+00,-5.31932175e-01,1.15057424e-01,-9.84865474e-04,-2.59264652e-03},{-2.14611650e+00,-1.12539554e+00,3.93744200e-01,6.25217557e-02,-8.95327237e-03,-1.01710367e-03,3.48391768e-05,7.48050752e-06},{2.01521254e+00,-1.21436706e-02,-2.86149746e-03,6.28544891e-04,7.71532941e-05,-7.57369844e-06,-8.41968813e-07,-7.28490779e-09}},
+  {{-3.19234486e+01,4.71514368e+00,6.65117979e+00,-3.47681493e-01,-2.54394740e-01,2.15418227e-02,1.02993073e-02,-2.04435736e-03},{-3.04789506e-02,-1.70611477e+01,3.27034640e+00,3.66420126e+00,-5.33283949e-01,-2.94808269e-01,4.55566794e-02,1.71871986e-02},{-1.12531304e-01,1.82078862e+00,2.26502512e-02,-1.04978129e-01,-7.28832383e-04,2.00053467e-03,1.38382775e-05,-2.74898903e-05},{1.97629464e+00,-6.54035131e-04,4.66700923e-03,3.88941880e-05,-1.33755093e-04,-8.22249547e-07,1.87592525e-06,1.39982888e-08}},
+  {{2.57967587e+01,1.42175236e+01,-4.70157671e+00,-7.72741377e-01,9.82067436e-02,2.08975952e-02,2.10584444e-03,-9.15427692e-04},{-6.64718294e+00,2.31073880e+00,-5.92197418e+00,1.57754615e-01,8.55980575e-01,2.20324490e-02,-3.98096479e-02,-8.62087309e-03},{2.27873540e+00,-1.01012123e+00,-4.19625521e-01,5.70246503e-02,9.68636386e-03,-9.81347752e-04,-4.32135857e-05,8.62312299e-06},{2.01363611e+00,1.29077053e-02,-2.57780799e-03,-6.71850808e-04,7.12562760e-05,8.31859415e-06,-8.44439001e-07,1.43077938e-09}},
+  {{4.09094524e+00,-2.15460701e+01,-8.29878807e-01,1.02668726e+00,2.76820716e-02,2.40833312e-03,6.69715344e-04,-8.37169006e-04},{9.57513905e+00,1.33315420e+01,-1.11124977e-01,-3.01193523e+00,-1.80724233e-01,1.22651666e-01,6.02565380e-03,6.25251187e-03},{-2.57876849e+00,-6.33263469e-01,4.80664253e-01,3.84718925e-02,-1.16461040e-02,-8.26248317e-04,7.42176853e-05,1.17435302e-05},{2.00851488e+00,-1.46581354e-02,-1.64406933e-03,7.77046138e-04,5.07268160e-05,-1.04754354e-05,-8.06145408e-07,2.43039509e-08}},
+  {{-2.80854492e+01,1.15377817e+01,5.67911053e+00,-8.29736710e-01,-1.64462030e-01,4.12854031e-02,8.44524009e-04,-2.67709116e-03},{-4.27269173e+00,-1.21140804e+01,7.77709007e+00,1.88219225e+00,-1.07558227e+00,-7.88482875e-02,7.54299834e-02,-2.50921049e-03},{7.65509427e-01,1.74799192e+00,-1.53779045e-01,-1.00137100e-01,4.91153682e-03,1.86337612e-03,-9.15103883e-05,-2.40870340e-05},{1.97722340e+00,4.44692792e-03,4.47402848e-03,-2.63633614e-04,-1.26912069e-04,5.51111589e-06,1.71759018e-06,-9.15593361e-08}},
+  {{3.14051800e+01,8.33508110e+00,-5.75732231e+00,-4.74093080e-01,1.56729519e-01,1.96886621e-02,-2.83484277e-03,-1.52258482e-03},{-4.99465609e+00,-2.17015457e+00,-4.23138618e+00,1.88847637e+00,6.84369802e-01,-1.36948153e-01,-4.94582877e-02,3.67151620e-03},{1.67630422e+00,-1.41838682e+00,-3.04642946e-01,7.61315152e-02,6.66379835e-03,-1.08550407e-03,-1.65458714e-05,4.36765049e-06},{2.01923919e+00,9.45949741e-03,-3.57867801e-03,-4.82618605e-04,9.13651311e-05,5.41138070e-06,-8.08444156e-07,1.65247815e-08}},
+  {{-6.73070526e+00,-2.13733253e+01,1.03302670e+00,1.09007263e+00,2.78910492e-02,-1.87554676e-03,-3.11992923e-03,-1.00912212e-03},{1.18275452e+01,1.03858318e+01,-5.04274845e+00,-2.91154075e+00,2.47365192e-01,1.66280895e-01,1.82214435e-02,8.47664487e-05},{-2.74648380e+00,-7.09468126e-02,5.21187186e-01,9.11774114e-03,-1.35425730e-02,-4.74829838e-04,1.25948412e-04,1.35717310e-05},{2.00096154e+00,-1.56922881e-02,-2.33325016e-04,8.54608254e-04,1.64471458e-05,-1.29554455e-05,-5.99886505e-07,7.59705756e-08}},
+  {{-2.12515163e+01,1.70282764e+01,4.05991411e+00,-1.09518373e+00,-5.76784834e-02,3.23299617e-02,-5.76175191e-03,-5.44540701e-04},{-7.83947802e+00,-4.23562241e+00,9.07566547e+00,-4.68882054e-01,-1.01177430e+00,1.28018782e-01,4.10152674e-02,-1.47016440e-02},{1.56405807e+00,1.48946881e+00,-3.11691076e-01,-8.32411274e-02,9.68504138e-03,1.40528055e-03,-1.68059079e-04,-1.33635467e-05},{1.98053443e+00,9.06445831e-03,3.79155390e-03,-5.31046651e-04,-1.03326740e-04,1.06526568e-05,1.20142408e-06,-1.61287204e-07}},
+  {{3.38937416e+01,1.64898264e+00,-6.21865892e+00,-7.64457956e-02,1.89165577e-01,3.00886435e-03,-6.53776899e-03,-3.27838847e-04},{-3.27710652e+00,-4.16791248e+00,-4.94969368e-01,2.79205799e+00,1.31543607e-01,-2.45436519e-01,-1.11897085e-02,1.52518740e-02},{9.02603149e-01,-1.68220329e+00,-1.62633628e-01,8.79425704e-02,3.43353953e-03,-1.12171855e-03,-4.39899350e-06,1.52322605e-06},{2.02289081e+00,5.08097745e-03,-4.21954272e-03,-2.55868712e-04,1.03218474e-04,2.67846235e-06,-7.47267336e-07,1.35898519e-08}},
+  {{-1.67565575e+01,-1.90161533e+01,2.95045137e+00,1.11209190e+00,-2.70983996e-03,-1.85558330e-02,-6.29537459e-03,-5.60111075e-04},{1.22701254e+01,3.28049517e+00,-8.76662922e+00,-1.71800470e+00,7.57445455e-01,1.84898734e-01,-8.77912901e-03,-1.33259688e-02},{-2.63115668e+00,5.05232513e-01,5.08477569e-01,-2.30905246e-02,-1.41511261e-02,5.34244937e-05,1.74308603e-04,1.01484366e-05},{1.99332905e+00,-1.51127866e-02,1.23400311e-03,8.45796545e-04,-2.34209911e-05,-1.43175284e-05,-1.69372711e-07,1.34104511e-07}},
+  {{-1.20612144e+01,2.06002121e+01,2.11915970e+00,-1.16183007e+00,8.78621265e-03,1.27779078e-02,-5.19690802e-03,8.60143336e-04},{-1.00277443e+01,3.65569854e+00,6.97935772e+00,-2.28002691e+00,-5.53016543e-01,1.91392630e-01,-4.46275482e-03,-7.82150682e-03},{2.20036268e+00,1.07518899e+00,-4.32887763e-01,-5.71221635e-02,1.28551461e-02,7.62852840e-04,-1.96184177e-04,-3.44831278e-07},{1.98588300e+00,1.27042569e-02,2.70717219e-03,-7.30183674e-04,-6.78184733e-05,1.36726330e-05,5.16105331e-07,-1.74201176e-07}},
+  {{3.30652008e+01,-5.17108297e+00,-6.00554705e+00,3.34682703e-01,1.69528261e-01,-1.67276096e-02,-4.53610905e-03,1.32976484e-03},{-1.35099447e+00,-2.69047284e+00,3.61740470e+00,2.38235521e+00,-5.02470672e-01,-1.94350362e-01,3.97743173e-02,1.00128120e-02},{3.68904248e-02,-1.77781487e+00,-6.62147114e-03,9.21208709e-02,1.37886178e-04,-1.12943631e-03,-1.18019265e-07,5.32077877e-07},{2.02422023e+00,2.07396297e-04,-4.45065834e-03,-1.03877392e-05,1.07297659e-04,1.05848848e-07,-7.18341084e-07,6.20785090e-10}},
+  {{-2.49001217e+01,-1.45911388e+01,4.75127316e+00,9.98973668e-01,-8.56596455e-02,-3.80542688e-02,-4.59846389e-03,1.34598895e-03},{1.06842012e+01,-5.71805620e+00,-9.65922451e+00,4.16190773e-01,1.10848629e+00,6.23630099e-02,-6.07422441e-02,-1.25079257e-02},{-2.24394560e+00,1.03488791e+00,4.40901309e-01,-5.46453781e-02,-1.30343465e-02,7.06264342e-04,1.96236055e-04,6.64077220e-07},{1.98640633e+00,-1.29510434e-02,2.60232878e-03,7.42968114e-04,-6.45148757e-05,-1.38164123e-05,4.58312996e-07,1.72776367e-07}},
+  {{-1.47452390e+00,2.19518394e+01,1.23581141e-01,-1.12175250e+00,2.98242830e-02,1.11813704e-03,-1.40075956e-03,1.00084150e-03},{-1.05048819e+01,8.72841454e+00,2.67974615e+00,-2.99738240e+00,-4.09708582e-02,1.58048972e-01,-1.35159064e-02,3.58880498e-03},{2.60875082e+00,5.52087784e-01,-5.04894257e-01,-2.58048400e-02,1.41281905e-02,1.04454739e-04,-1.77474416e-04,9.57631892e-06},{1.99271286e+00,1.49905533e-02,1.35426235e-03,-8.40808672e-04,-2.68793119e-05,1.43558245e-05,-1.23365126e-07,-1.38488957e-07}},
+  {{2.89885883e+01,-1.14494305e+01,-5.16971540e+00,6.61756456e-01,1.11864015e-01,-2.33734902e-02,7.71929102e-04,1.30320410e-03},{9.30371463e-01,1.83091784e+00,6.27161503e+00,8.89722645e-01,-8.36699545e-01,-3.45531479e-02,4.97185662e-02,-5.18516311e-03},{-8.32535684e-01,-1.69676614e+00,1.49947047e-01,8.85815248e-02,-3.15968716e-03,-1.12303358e-03,3.84995656e-06,1.37003053e-06},{2.02309322e+00,-4.68607992e-03,-4.25476674e-03,2.35825268e-04,1.03845312e-04,-2.45923025e-06,-7.43039152e-07,-1.27600330e-08}},
+  {{-3.03446808e+01,-8.48353958e+00,6.13887930e+00,6.66493535e-01,-1.96899951e-01,-3.90005112e-02,4.17508883e-03,2.97520845e-03},{7.54646015e+00,-1.35433750e+01,-7.02423334e+00,2.70289803e+00,9.38650191e-01,-1.75859302e-01,-7.29585811e-02,6.31241500e-03},{-1.62439215e+00,1.46016324e+00,3.23412180e-01,-8.13567266e-02,-1.00174425e-02,1.35627715e-03,1.72362998e-04,-1.22816891e-05},{1.98091114e+00,-9.41147748e-03,3.71450325e-03,5.50622120e-04,-1.00726909e-04,-1.09927923e-05,1.14748480e-06,1.64590276e-07}},
+  {{9.33327770e+00,2.10462990e+01,-1.77880788e+00,-1.04434752e+00,3.56073081e-02,2.45733163e-03,2.12755240e-03,7.19857228e-04},{-9.60192013e+00,9.47453499e+00,-1.97147691e+00,-2.60573387e+00,3.84885192e-01,1.29580021e-01,-2.76713865e-03,2.02520541e-03},{2.74748826e+00,-2.25067735e-02,-5.22179842e-01,6.49455935e-03,1.36484578e-02,-4.37238894e-04,-1.30396002e-04,1.35154787e-05},{2.00031543e+00,1.57049932e-02,-1.10846660e-04,-8.57274921e-04,1.32846035e-05,1.31216457e-05,-5.72744568e-07,-8.08621294e-08}},
+  {{2.20066891e+01,-1.65829620e+01,-3.86745453e+00,8.62692535e-01,5.59068657e-02,-1.51201263e-02,3.82047030e-03,1.79271810e-04},{3.72065282e+00,7.65348005e+00,6.29145718e+00,-9.35099661e-01,-7.66795695e-01,8.74281153e-02,1.91438422e-02,-1.01352856e-02},{-1.61701834e+00,-1.44623649e+00,2.93611795e-01,7.73959979e-02,-6.39889622e-03,-1.09031750e-03,1.50630240e-05,4.06321897e-06},{2.01962376e+00,-9.12273210e-03,-3.64651415e-03,4.64810611e-04,9.26543071e-05,-5.17522221e-06,-8.03219962e-07,-1.68664744e-08}},
+  {{-3.26021614e+01,-1.34862185e+00,6.79510736e+00,1.35923818e-01,-2.67234027e-01,-1.02424966e-02,1.19884312e-02,9.44203523e-04},{3.54954338e+00,-1.75627174e+01,-1.67610407e+00,3.96008682e+00,1.99757650e-01,-3.35956931e-01,-1.66681968e-02,2.15143282e-02},{-8.36428165e-01,1.73300695e+00,1.67937085e-01,-9.91471112e-02,-5.35507407e-03,1.83574297e-03,9.93822687e-05,-2.34139115e-05},{1.97741485e+00,-4.85806679e-03,4.43437416e-03,2.87795119e-04,-1.25518782e-04,-6.00185513e-06,1.68592635e-06,9.92048470e-08}},
+  {{1.91656761e+01,1.80449715e+01,-3.50036550e+00,-9.29527879e-01,5.82282059e-02,1.27557805e-02,3.64337279e-03,3.20869694e-05},{-8.03847408e+00,6.34961843e+00,-5.19502974e+00,-1.31656778e+00,7.20629692e-01,1.00762337e-01,-1.44044468e-02,-7.72421854e-03},{2.60301137e+00,-5.88152170e-01,-4.85880643e-01,3.61915343e-02,1.18398499e-02,-8.03478062e-04,-7.82005445e-05,1.20297764e-05},{2.00790477e+00,1.48020182e-02,-1.53169257e-03,-7.86378747e-04,4.81396673e-05,1.07056976e-05,-7.96398865e-07,-2.79512129e-08}},
+  {{1.27599964e+01,-2.00996037e+01,-2.27462220e+00,9.68284667e-01,2.92499233e-02,-2.90389638e-03,3.03624850e-03,-5.77840430e-04},{6.95628929e+00,1.22313023e+01,3.57679367e+00,-2.38262391e+00,-4.73423213e-01,1.15852416e-01,-2.20181118e-03,-4.62146330e-04},{-2.23624945e+00,-1.04875624e+00,4.11295474e-01,5.88734820e-02,-9.44658928e-03,-9.93752852e-04,4.03369959e-05,8.24331983e-06},{2.01416421e+00,-1.26626333e-02,-2.67294724e-03,6.57862809e-04,7.32470508e-05,-8.07221204e-06,-8.44146314e-07,-3.50495699e-09}},
+  {{-3.14879780e+01,5.97900724e+00,6.54086876e+00,-4.44621235e-01,-2.43261084e-01,2.71153692e-02,8.96430388e-03,-2.46939366e-03},{-7.73840129e-01,-1.65065250e+01,4.23394251e+00,3.44567204e+00,-6.67840838e-01,-2.65997648e-01,5.58094792e-02,1.43442033e-02},{3.82953957e-02,1.82185400e+00,-7.71570904e-03,-1.05051287e-01,2.48461787e-04,2.00276589e-03,-4.71993144e-06,-2.75498714e-05},{1.97628105e+00,2.22695555e-04,4.66985442e-03,-1.32544046e-05,-1.33860463e-04,2.80396961e-07,1.87855187e-06,-4.77569406e-09}},
+  {{2.69964657e+01,1.32699223e+01,-4.92516661e+00,-7.29354978e-01,1.08636633e-01,2.18381807e-02,1.40988408e-03,-1.11210486e-03},{-6.36709642e+00,1.41162717e+00,-5.82189131e+00,4.87999022e-01,8.56720626e-01,-2.97085242e-03,-4.44762520e-02,-7.32910028e-03},{2.19106531e+00,-1.08798087e+00,-4.02469873e-01,6.07453622e-02,9.19649936e-03,-1.00593048e-03,-3.74815281e-05,7.85351494e-06},{2.01470017e+00,1.24021843e-02,-2.76951818e-03,-6.43090520e-04,7.52558262e-05,7.81806375e-06,-8.43302359e-07,5.50027934e-09}},
+  {{2.18015933e+00,-2.16752586e+01,-5.09301424e-01,1.03837574e+00,2.83437725e-02,2.60600774e-03,5.39415596e-05,-8.77600047e-04},{1.00612192e+01,1.31804981e+01,-9.83957529e-01,-3.06898236e+00,-1.12823322e-01,1.27448484e-01,9.34695452e-03,6.40873006e-03},{-2.62632895e+00,-5.41163921e-01,4.90973979e-01,3.38005647e-02,-1.20352600e-02,-7.78791204e-04,8.24152521e-05,1.23079008e-05},{2.00727057e+00,-1.49411289e-02,-1.41442986e-03,7.95574335e-04,4.54118817e-05,-1.09414459e-05,-7.85071393e-07,3.18695008e-08}},
+  {{-2.70900059e+01,1.26230984e+01,5.43330526e+00,-8.93377841e-01,-1.44811943e-01,4.15149629e-02,-8.04792100e-04,-2.39260774e-03},{-4.94894218e+00,-1.08701801e+01,8.26330757e+00,1.47480607e+00,-1.10764992e+00,-3.58469896e-02,7.31919780e-02,-5.87416906e-03},{9.08997118e-01,1.71630943e+00,-1.82424396e-01,-9.80436355e-02,5.80705330e-03,1.80499279e-03,-1.07296379e-04,-2.26672983e-05},{1.97762799e+00,5.27893519e-03,4.39016940e-03,-3.12504562e-04,-1.23966180e-04,6.50025368e-06,1.65074403e-06,-1.06828814e-07}},
+  {{3.20837898e+01,7.19767427e+00,-5.88713980e+00,-4.09444958e-01,1.65587708e-01,1.77223366e-02,-3.76603240e-03,-1.44872861e-03},{-4.71898413e+00,-2.76045775e+00,-3.68067718e+00,2.13076305e+00,6.10123038e-01,-1.64337993e-01,-4.60239947e-02,6.41119573e-03},{1.55471182e+00,-1.47395706e+00,-2.82036722e-01,7.86522403e-02,6.12373091e-03,-1.09491253e-03,-1.36262870e-05,3.76033950e-06},{2.02000642e+00,8.76882486e-03,-3.71403550e-03,-4.46157064e-04,9.39316160e-05,4.93231437e-06,-7.97756684e-07,1.70977579e-08}},
+  {{-8.59077168e+00,-2.11186523e+01,1.37020743e+00,1.09896874e+00,2.57179923e-02,-3.98782035e-03,-3.80864507e-03,-1.00562698e-03},{1.20535698e+01,9.40876484e+00,-5.83931494e+00,-2.78400779e+00,3.34188104e-01,1.75087437e-01,1.69608947e-02,-2.35208427e-03},{-2.74643970e+00,2.75646001e-02,5.22810042e-01,3.76351108e-03,-1.37480749e-02,-3.97000200e-04,1.34959613e-04,1.34151442e-05},{1.99964893e+00,-1.57062057e-02,1.60034469e-05,8.59385473e-04,9.97352072e-06,-1.32847445e-05,-5.42918542e-07,8.59618154e-08}},
+  {{-1.97825356e+01,1.78125324e+01,3.73326516e+00,-1.11935329e+00,-4.22535688e-02,2.89897695e-02,-6.12284755e-03,-1.83511846e-04},{-8.32313824e+00,-2.76538372e+00,8.93248749e+00,-8.51321280e-01,-9.49243367e-01,1.50464550e-01,3.18553671e-02,-1.47512620e-02},{1.68532395e+00,1.42873716e+00,-3.35226089e-01,-7.93406069e-02,1.03484383e-02,1.30429829e-03,-1.76435526e-04,-1.11494246e-05},{1.98131514e+00,9.76187084e-03,3.63189285e-03,-5.70309756e-04,-9.79511096e-05,1.13278738e-05,1.09055259e-06,-1.67562405e-07}},
+  {{3.39941940e+01,4.35450464e-01,-6.23161650e+00,-1.59796106e-03,1.89725295e-01,-8.11163685e-04,-6.63717696e-03,1.23691661e-05},{-2.97813773e+00,-4.17452383e+00,2.61933774e-01,2.82003355e+00,1.32530900e-02,-2.49082029e-01,-1.33155764e-03,1.57148875e-02},{7.59580970e-01,-1.71043241e+00,-1.36737198e-01,8.91802385e-02,2.87582632e-03,-1.12418353e-03,-3.33265484e-06,1.22615870e-06},{2.02328300e+00,4.27473756e-03,-4.28782543e-03,-2.14965650e-04,1.04431114e-04,2.23325628e-06,-7.38945971e-07,1.18360486e-08}},
+  {{-1.83599968e+01,-1.83804569e+01,3.28368998e+00,1.10502636e+00,-1.34191057e-02,-2.22843532e-02,-6.50045322e-03,-3.33920878e-04},{1.21391001e+01,1.76457453e+00,-9.16809559e+00,-1.39811110e+00,8.41731310e-01,1.75652578e-01,-1.76753029e-02,-1.47141768e-02},{-2.58337307e+00,6.00019574e-01,5.00732839e-01,-2.86011416e-02,-1.40896933e-02,1.58169831e-04,1.80507064e-04,8.93597917e-06},{1.99208367e+00,-1.48511631e-02,1.47752662e-03,8.34861479e-04,-3.04605946e-05,-1.43792467e-05,-7.42153716e-08,1.42839454e-07}},
+  {{-1.02650051e+01,2.10073624e+01,1.76600957e+00,-1.16010129e+00,1.51526621e-02,9.84471850e-03,-4.62508388e-03,9.49563517e-04},{-1.02211237e+01,4.80975580e+00,6.33212471e+00,-2.49141383e+00,-4.59517837e-01,1.89189389e-01,-9.09185410e-03,-5.48194256e-03},{2.28686404e+00,9.92370665e-01,-4.48744684e-01,-5.20427749e-02,1.32034505e-02,6.47668028e-04,-1.95911067e-04,1.67994631e-06},{1.98695850e+00,1.31937480e-02,2.49178312e-03,-7.55406742e-04,-6.10554198e-05,1.39455424e-05,3.99017978e-07,-1.70915712e-07}},
+  {{3.25784149e+01,-6.33884001e+00,-5.90030909e+00,4.01076227e-01,1.61105737e-01,-1.91718955e-02,-3.66770755e-03,1.47210516e-03},{-1.00266409e+00,-2.08271742e+00,4.24247456e+00,2.18069267e+00,-5.91478944e-01,-1.70100525e-01,4.54953350e-02,7.49038160e-03},{-1.12956740e-01,-1.77619946e+00,2.02964786e-02,9.20490324e-02,-4.23207297e-04,-1.12923165e-03,3.71428968e-07,5.48167748e-07},{2.02419782e+00,-6.35406934e-04,-4.44673840e-03,3.18570710e-05,1.07225795e-04,-3.25227631e-07,-7.18707895e-07,-1.89559213e-09}},
+  {{-2.60781651e+01,-1.36208735e+01,5.03582430e+00,9.57479060e-01,-1.04752705e-01,-4.02100310e-02,-3.49063124e-03,1.76445511e-03},{1.02379665e+01,-7.25632191e+00,-9.45256519e+00,8.39281917e-01,1.12434363e+00,2.48103049e-02,-6.75909296e-02,-1.01320436e-02},{-2.15325522e+00,1.11575818e+00,4.24149364e-01,-5.96316792e-02,-1.26524344e-02,8.21132446e-04,1.95712433e-04,-1.41274916e-06},{1.98535705e+00,-1.24367494e-02,2.81291269e-03,7.16145267e-04,-7.11810135e-05,-1.35025866e-05,5.76213665e-07,1.75240871e-07}}
+  };
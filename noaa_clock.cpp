@@ -12,23 +12,70 @@
 *
 * HISTORY       2016 05 24   JPT   File documenting begins
 *
-* NOTES         Linked with Qt 5.4.
+* NOTES         Linked with Qt 5.4. CMakeLists.txt builds it and the
+*               benchmark noaa_bench on Linux.
 *
 *               Designed for Full HD display size. Adjust dimensions for
 *               your own needs.
 *
 \**************************************************************************/
 
+#ifdef _WIN32
 #include "stdafx.h"
 #include <Windows.h>
+#else
+#include <strings.h>
+#define strcmpi strcasecmp   // Case-insensitive compare by its MSVC name
+#endif
 #include <time.h>
+#include <math.h>
+#include <float.h>
+#include <stddef.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fb.h>
+#endif
+#endif
 #include <QtCore/QTime>
+#include <QtCore/QDateTime>
 #include <QtCore/QTimer>
 #include <QtCore/QMetaObject>
 #include <QtWidgets/qapplication.h>
 #include <QtWidgets/qmainwindow.h>
-#include <QtGui/QtGUi>
+#include <QtGui/QtGui>
 #include <QtGui/QPainter>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#include <immintrin.h>
+#define NOAA_SIMD                                         // AVX2 batch kernel compiled in
+#define NOAA_AVX2 __attribute__ ((target ("avx2,fma")))   // Function may use AVX2 and FMA
+#elif defined (_MSC_VER) && defined (_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#define NOAA_SIMD
+#define NOAA_AVX2
+#endif
+
+#ifndef NOAA_NOCHEB
+#include "noaa_cheb.h"                                    // Chebyshev ephemeris, generated by -cheb
+#endif
 
 #define OX   500          // Time display origin X coordinate
 #define OY   500          // Time display origin Y coordinate
@@ -38,25 +85,492 @@
 #define LOX 1500          // Sun longitude display origin X coordinate
 #define LOY  (OY + 250)   // Sun longitude display origin Y coordinate
 
+#define DST_NONE 0        // No daylight saving time
+#define DST_EU   1        // European Union daylight saving time
+#define DST_US   2        // United States and Canada daylight saving time
+#define DST_AU   3        // South-eastern Australia daylight saving time
+#define DST_NZ   4        // New Zealand daylight saving time
+#define DST_NR   5        // Daylight saving time rules
+
+#define DST_Y0   1900     // First year of the daylight saving time tables
+#define DST_NY    300     // Years in the daylight saving time tables
+
+#define NSPARE   4        // Free day table buffers
+
+#define GAZ_SHOW 200      // Locations listed at most
+
+#define NDIR  5760        // Time display direction table steps per full circle
+
+#define NTHRESH  6        // Sun event elevation thresholds, the last one user-defined
+
+#define CHEB_JD0 2433282.5   // Chebyshev ephemeris start, 1950 01 01 00 UT [Julian day]
+#define CHEB_JD1 2488434.5   // Chebyshev ephemeris end, 2101 01 01 00 UT [Julian day]
+#define CHEB_SEG 128         // Chebyshev ephemeris segment [Days]
+#define CHEB_N    8          // Chebyshev coefficients per quantity and segment
+
+#define PREC_FLOAT  0     // Precision tier: single precision, eight lanes with AVX2
+#define PREC_DOUBLE 1     // Precision tier: double precision, four lanes with AVX2
+#define PREC_EXACT  2     // Precision tier: full series at every time
+
+#define TABVER   5        // Day table cache version, bumped when the NOAA engine changes
+#define TABMAPS  4        // Day table cache files kept mapped
+#define TABFILL 16        // Days added to the day table cache per worker round
+
+#define GRID_MAX  64      // Sites of the grid display at most
+#define GRID_TXT  36      // Height of the text under a grid dial [Pixels]
+#define GRID_BUDGET 12    // Time for site layer redraws per grid frame [Milliseconds]
+
+#define FB_ARGB32  0      // Headless framebuffer format: 32-bit ARGB, opaque
+#define FB_RGB565  1      // Headless framebuffer format: 16-bit RGB 5-6-5
+#define FB_DATA   64      // Offset of the pixels in a headless framebuffer file [Bytes]
+
+#define QRY_MAGIC  0x3152514e   // Query daemon binary request magic, "NQR1"
+#define QRY_AMAGIC 0x3141514e   // Query daemon binary answer magic, "NQA1"
+#define QRY_POINT  1            // Query: Sun position at a time
+#define QRY_DAY    2            // Query: per-minute tables of a day
+#define QRY_EVENTS 3            // Query: Sun events of a day
+#define QRY_LRU    1024         // Query daemon day terms kept
+#define QRY_HASH   2048         // Query daemon day terms hash chains, a power of two
+#define QRY_FLUSH  512          // Query daemon point queries per batch at most
+#define QRY_CONNS  64           // Query daemon connections at most
+#define QRY_OUTMAX (4 << 20)    // Query daemon unsent answers before a connection is no longer read [Bytes]
+
+#ifdef NOAA_PERF
+#define PS_ELOOP 0        // Timed stage: display update timer response
+#define PS_LOAD  1        // Timed stage: day table computation
+#define PS_BATCH 2        // Timed stage: batch evaluation of the per-minute stage
+#define PS_FRAME 3        // Timed stage: update request, painting and the flush to the screen
+#define PS_PAINT 4        // Timed stage: paint event
+#define PS_LAYER 5        // Timed stage: redraw of a cached layer
+#define PS_RING  6        // Timed stage: twilight color ring
+#define PS_BLIT  7        // Timed stage: cached layer copied to the exposed region
+#define PS_UPD   8        // Timed stage: pointers and live values
+#define PS_NR    9        // Timed stages
+#define PERF_N   1024     // Samples kept per timed stage, a power of two
+#define PERF_DUMP 60      // Interval of the timer dump [Seconds]
+#define PERF_X   10       // Timer overlay X coordinate
+#define PERF_Y   930      // Timer overlay Y coordinate
+#define PERF_W   300      // Timer overlay width
+#define PERF_H   140      // Timer overlay height
+#define PERF(s)          PerfScope perf_scope (s)         // Times the rest of the scope as stage s
+#define PERF_BEGIN(v)    unsigned long long v = perfticks ()
+#define PERF_END(s, v)   perfadd (s, v, perfticks ())     // Times from PERF_BEGIN (v) as stage s
+#else
+#define PERF(s)
+#define PERF_BEGIN(v)
+#define PERF_END(s, v)
+#endif
+
+
+
+// NOAA solar equation input
+
+struct NoaaIn {
+  double lat_deg,        // Latitude [Decimal degrees]
+         long_deg,       // Longitude, positive east [Decimal degrees]
+         date_d,         // Date [Days since 1899 12 30]
+         wtime_day,      // Wall-clock time [Fraction of a day]
+         timezone_hr;    // Timezone, daylight saving time included [Hours]
+  };
+
+// NOAA solar equation results
+
+struct NoaaOut {
+  double jday,           // Julian day
+         jcen,           // Julian century
+         gmlong_deg,     // Sun geom mean longitude
+         gmanom_deg,     // Sun geom mean anomaly
+         eccent,         // Earth orbit eccentricity
+         eqofctr,        // Sun eq of ctr
+         truelong_deg,   // Sun true longitude
+         trueanom_deg,   // Sun true anomaly
+         radvect_au,
+         applong_deg,
+         moe_deg,        // Mean obliq ecliptic
+         ocorr_deg,      // Obliq corr
+         rtasc_deg,      // Sun right ascension
+         decl_deg,       // Sun declination
+         var_y,
+         eqoftime_min,   // Equation of time
+         ha_rise_deg,
+         noon_lst,
+         rise_lst,
+         set_lst,
+         lightdur_min,
+         soltime_min,
+         hrangle_deg,
+         zangle_deg,     // Zenith angle
+         elev_deg,       // Sun elevation
+         refract_deg,    // Atmospheric refraction
+         elevc_deg,      // Refraction-corrected sun elevation
+         az_deg;         // Sun azimuth
+  };
+
+// Per-day NOAA terms of one location and date
+
+struct NoaaDay {
+  double lat_deg,            // Latitude [Decimal degrees]
+         long_deg,           // Longitude [Decimal degrees]
+         date_d,             // Date [Days since 1899 12 30]
+         timezone_hr,        // Timezone [Hours]
+         sinlat,             // Sine of latitude
+         coslat,             // Cosine of latitude
+         decl_deg     [2],   // Sun declination at 00:00 and 24:00
+         eqoftime_min [2],   // Equation of time at 00:00 and 24:00
+         truelong_deg [2];   // Sun true longitude at 00:00 and 24:00, unwrapped
+  };
+
+// Sun events of one day, times in the day's timezone, NaN when none
+
+struct SunEvents {
+  double noon_day,                    // Solar noon [Fraction of day]
+         midnight_day,                // Solar midnight within the day where possible [Fraction of day]
+         noonelev_deg,                // Sun elevation at solar noon
+         midnightelev_deg,            // Sun elevation at solar midnight
+         thresh_deg [NTHRESH],        // Elevation thresholds
+         rise_day   [NTHRESH],        // Rising crossing before noon [Fraction of day]
+         set_day    [NTHRESH];        // Setting crossing after noon [Fraction of day]
+  int    polar      [NTHRESH];        // 1 above all day, -1 below all day, 0 otherwise
+  };
+
+// Context of the event solver's elevation function
+
+struct EventFn {
+  const NoaaDay *day;   // Per-day terms
+  double        h;      // Elevation threshold
+  };
+
+// Per-minute NOAA results
+
+struct NoaaMin {
+  double decl_deg,       // Sun declination
+         eqoftime_min,   // Equation of time
+         truelong_deg,   // Sun true longitude
+         soltime_min,    // Solar time in minutes
+         hrangle_deg,    // Hour angle
+         zangle_deg,     // Zenith angle
+         elev_deg,       // Sun elevation
+         refract_deg,    // Atmospheric refraction
+         elevc_deg,      // Refraction-corrected sun elevation
+         az_deg;         // Sun azimuth
+  };
+
+// Output columns of a batch evaluation
+
+struct NoaaCols {
+  float *solarmin,   // Solar time minute
+        *elev,       // Sun elevation
+        *elevc,      // Corrected Sun elevation
+        *azim,       // Sun azimuth
+        *sunlong;    // Sun longitude
+  };
+
+// Key of the per-minute tables of one day
+
+struct DayKey {
+  double date_d,        // Date [Days since 1899 12 30]
+         lat_deg,       // Latitude [Decimal degrees]
+         long_deg,      // Longitude [Decimal degrees]
+         timezone_hr;   // Timezone, daylight saving time included [Hours]
+  int    dst;           // Daylight saving time in effect [Hours]
+  };
+
+// Per-minute tables of one day
+
+struct DayTab {
+  float  solarmin [1440],   // Solar time minute
+         elev     [1440],   // Sun elevation
+         elevc    [1440],   // Corrected Sun elevation
+         azim     [1440],   // Sun azimuth
+         sunlong  [1440];   // Sun longitude
+  DayKey key;               // Location, date and timezone of the tables
+  };
+
+// Generator binary file header, followed by nsite GenSite records and then,
+// site by site and day by day, the five float columns of nsamp samples each
+// in NoaaCols order
+
+struct GenHead {
+  char   magic [8];    // "NOAAGEN1"
+  int    nsite,        // Sites
+         nday,         // Days per site
+         nsamp,        // Samples per day
+         step_s;       // Sample interval [Seconds]
+  double date0_d;      // First date [Days since 1899 12 30]
+  };
+
+// Generator site
+
+struct GenSite {
+  char   name [32];     // Location name or coordinates as given
+  double lat_deg,       // Latitude [Decimal degrees]
+         long_deg,      // Longitude [Decimal degrees]
+         timezone_hr;   // Standard timezone [Hours]
+  };
+
+// Generator job context: a chunk of tiles, tile = site * nday + day
+
+struct GenJob {
+  const GenSite *site;       // Sites
+  const double  *w;          // Sample times [Fraction of day]
+  double        date0_d;     // First date [Days since 1899 12 30]
+  int           nday,        // Days per site
+                nsamp,       // Samples per day
+                tile0;       // First tile of the chunk
+  float         *out;        // Columns of the chunk, 5 * nsamp per tile
+  };
+
+// Work-stealing range of a pool thread, padded to a cache line
+
+struct StealRange {
+  std :: atomic <unsigned long long> r;   // Next job in the low, end in the high 32 bits
+  char                               pad [56];
+  };
+
+// Gazetteer file header, followed by nplace GazPlace records, nplace GazNode
+// records, nslot GazSlot records and nname bytes of NUL-terminated UTF-8
+// names and keys
+
+struct GazHead {
+  char         magic [8];   // "NOAAGAZ2"
+  unsigned int nplace,      // Places
+               nslot,       // Hash slots, a power of two
+               nname,       // Name and key bytes
+               pad;
+  };
+
+// Gazetteer place
+
+struct GazPlace {
+  double       lat_deg,       // Latitude [Decimal degrees]
+               long_deg,      // Longitude [Decimal degrees]
+               timezone_hr;   // Standard timezone [Hours]
+  int          dst;           // Daylight saving time rule
+  unsigned int name;          // Offset of the name as written in the source
+  };
+
+// Gazetteer k-d tree node, implicit layout: the node of places lo...hi-1 is at
+// (lo + hi) / 2 and splits on coordinate depth % 3
+
+struct GazNode {
+  float        v [3];   // Unit vector of the place, X to 0 N 0 E, Z to the North Pole
+  unsigned int place;   // Place index
+  };
+
+// Gazetteer hash slot, open addressing with linear probing
+
+struct GazSlot {
+  unsigned int hash,    // FNV-1a hash of the key
+               place,   // Place index + 1, 0 for an empty slot
+               key;     // Offset of the case-folded UTF-8 key
+  };
+
+// Day table cache file header, followed by ndays records of the five float
+// columns of DayTab
+
+struct TabHead {
+  char          magic [8];     // "NOAATAB1"
+  unsigned int  version,       // TABVER
+                recsize,       // Bytes per day
+                ndays;         // Days of the year
+  int           year,          // Year
+                prec;          // Precision tier
+  double        lat_deg,       // Latitude [Decimal degrees]
+                long_deg,      // Longitude [Decimal degrees]
+                timezone_hr;   // Standard timezone [Hours]
+  unsigned int  hash,          // FNV-1a hash of the fields above
+                pad;
+  unsigned char have [368];    // Day present, its daylight saving time + 1, by day of the year - 1
+  };
+
+// Daylight saving time transitions of a zone, DST_Y0...DST_Y0 + DST_NY - 1
+
+struct DstZone {
+  double      timezone_hr;         // Standard timezone [Hours]
+  int         rule;                // Daylight saving time rule
+  int         n;                   // Transitions
+  long long   utc [2 * DST_NY];    // Transition instants, ascending [Seconds since 1970 UTC]
+  signed char off [2 * DST_NY];    // Daylight saving time from the instant on [Hours]
+  DstZone     *next;               // Next cached zone
+  };
+
+// Site of the grid display
+
+struct GridSite {
+  char          name [64];      // Location name or coordinates as given, UTF-8
+  double        lat_deg,        // Latitude [Decimal degrees]
+                long_deg,       // Longitude [Decimal degrees]
+                timezone_std;   // Standard timezone [Hours]
+  int           dst_rule;       // Daylight saving time rule
+  const DstZone *z;             // Daylight saving time transitions
+  DayKey        key;            // Key of the tables wanted
+  DayTab        *tab;           // Per-minute tables, NULL until built
+  QImage        layer;          // Dial template with the twilight ring and wall-clock scale
+  DayKey        layerkey;       // Key of the tables layer was drawn from
+  float         cf,             // Time display circle fraction
+                cec,            // Corrected Sun elevation
+                caz;            // Sun azimuth
+  int           hhmm;           // Local time [Minutes]
+  };
+
+// Headless framebuffer file header, shared memory or a file, followed at
+// FB_DATA by height lines of stride bytes. A reader copies the pixels
+// while seq is even and unchanged before and after.
+
+struct FbHead {
+  char                         magic [8];   // "NOAAFB1"
+  int                          width,       // Width [Pixels]
+                               height,      // Height [Pixels]
+                               stride,      // Line length [Bytes]
+                               format;      // FB_ARGB32 or FB_RGB565
+  std :: atomic <unsigned int> seq;         // Frames drawn times two, odd while a frame is drawn
+  int                          rx, ry,      // Bounding rectangle of the last frame's changes
+                               rw, rh;
+  };
+
+// Query daemon binary request, answered by a QryHead and len bytes: five
+// floats in NoaaCols order for a point, five columns of 1440 floats for a
+// day, a SunEvents for events
+
+struct QryReq {
+  unsigned int magic;         // QRY_MAGIC
+  int          op;            // QRY_POINT, QRY_DAY or QRY_EVENTS
+  double       lat_deg,       // Latitude [Decimal degrees]
+               long_deg,      // Longitude [Decimal degrees]
+               t,             // Point: UTC [Seconds since 1970 01 01], else date [Days since 1899 12 30]
+               timezone_hr,   // Timezone of a day or events [Hours]
+               user_deg;      // User-defined event elevation threshold [Degrees]
+  };
+
+struct QryHead {
+  unsigned int magic;    // QRY_AMAGIC
+  int          op,       // Query answered
+               status,   // 0, 1 for a bad request
+               len;      // Bytes following
+  };
+
+// Query daemon day terms, a hash chain and least recently used list member
+
+struct QryEnt {
+  DayKey  key;          // Location, date and timezone
+  NoaaDay day;          // Day terms
+  DayTab  *tab;         // Per-minute tables, NULL until a day query
+  bool    tabok;        // tab of these day terms
+  int     prev, next,   // Least recently used list neighbours, -1 for none
+          hnext;        // Next on the hash chain, -1 for none
+  };
+
+// Query daemon connection
+
+struct QryConn {
+  int    fd;                      // Socket
+  int    mode;                    // Protocol: 0 unknown yet, 1 line JSON, 2 binary
+  bool   eof;                     // Closing once the answers are sent
+  bool   held;                    // Requests left in in until the answers drain
+  bool   fail;                    // Out of memory, closing without further answers
+  char   *in, *out;               // Received, unsent
+  size_t inlen, incap,            // Received bytes, buffer size
+         outlen, outcap, outoff;  // Answer bytes, buffer size, sent
+  };
+
+// Query daemon point query waiting for the batch
+
+struct QryPend {
+  QryConn *c;         // Connection
+  int     ent;        // Day terms
+  double  w;          // Time [Fraction of the UTC day]
+  char    id [40];    // JSON id as given, empty if none
+  bool    json;       // Line JSON, else binary
+  float   r [5];      // Answer in NoaaCols order
+  };
+
+#ifdef NOAA_PERF
+
+// Samples of a timed stage, written lock-free by any thread
+
+struct PerfRing {
+  std :: atomic <unsigned int>       head;           // Samples written
+  std :: atomic <unsigned long long> end [PERF_N];   // End of the sample [Ticks]
+  std :: atomic <unsigned int>       dur [PERF_N];   // Duration [Ticks]
+  };
+
+unsigned long long perfticks (void);
+void perfadd (int s, unsigned long long t0, unsigned long long t1);
+void perfdraw (void);
+
+// Scoped timer of PERF ()
+
+struct PerfScope {
+  int                stage;
+  unsigned long long t0;
+  PerfScope  (int s) : stage (s), t0 (perfticks ()) {}
+  ~PerfScope (void) {perfadd (stage, t0, perfticks ());}
+  };
+
+#endif
+
+bool samekey (const DayKey *a, const DayKey *b);
+char *gazbuild (const char *src, const char *tzf, size_t *len);
+
 
 
 class DispWidget : public QWidget {
   Q_OBJECT
   public:
-                DispWidget  (void) {}
+                DispWidget  (void) : img (NULL), imgdata (NULL), layerfmt (QImage :: Format_RGB32), sc (1), shownok (false) {}
                 ~DispWidget (void) {}
+  void          updscale    (void);
+  void          updday      (void);
   void          upd         (void);
   void          drawtl      (float cf, int startl, int endl, unsigned int c);
   void          drawnum     (float cf, int n, int loc, unsigned int c);
+  void          drawring    (int startl, int endl);
+  QRegion       dynreg      (void);
+  QRegion       devreg      (const QRegion &r);
+  QRegion       dirty       (bool all);
+  void          invalidate  (bool all);
+  void          draw        (QPaintDevice *dev, const QRegion &reg);
   void          paintEvent  (QPaintEvent *e);
-  QImage        *img;
-  unsigned char *imgdata;
+#ifdef NOAA_PERF
+  void          keyPressEvent (QKeyEvent *e);
+  bool          event         (QEvent *e);
+#endif
+  QImage        *img;          // Headless framebuffer, NULL on the display
+  unsigned char *imgdata;      // Pixels of img, mapped
+  QImage :: Format layerfmt;   // Format of the cached layers
+  double        sc;            // Drawing scale, pixels per unit of the 1920 x 1080 layout
+  QImage        scalelayer;    // Cached scales that never change
+  QImage        daylayer;      // Cached scales of the day over scalelayer
+  DayKey        daylayerkey;   // Key of the tables daylayer was drawn from
+  QRegion       shownreg;      // Region of the pointers and values last drawn
+  float         shown [5];     // Values last drawn: cf, ce, cec, caz, csl
+  bool          shownok;       // shownreg and shown are valid
   public slots:
   void          eloop       (void);
   };
 
 
 
+// Grid display of several locations, reusing the drawing of DispWidget
+
+class GridWidget : public DispWidget {
+  Q_OBJECT
+  public:
+  QRect         cell        (int i);
+  void          layout      (void);
+  void          paintEvent  (QPaintEvent *e);
+  QSize         gridsize;      // Widget size of the layout
+  QImage        tpl;           // Dial template shared by the sites
+  int           cols,          // Columns of the grid
+                cellw,         // Cell width [Pixels]
+                cellh,         // Cell height [Pixels]
+                dial;          // Dial size [Pixels]
+  public slots:
+  void          gloop       (void);
+  };
+
+
+
 #include "noaa_clock.moc"
 
 
@@ -65,61 +579,92 @@ class DispWidget : public QWidget {
 
 QDate      d;
 QTime      t;
+QDateTime  clocknow;          // Fixed UTC clock, invalid for the system clock
 char       line     [1024];   // File line buffer
-float      solarmin [1440],   // Solar time minute
-           elev     [1440],   // Sun elevation
-           elevc    [1440],   // Corrected Sun elevation
-           azim     [1440],   // Sun azimuth
-           sunlong  [1440];   // Sun longitude
+DayTab     *tab = NULL;       // Per-minute tables of the current day
 DispWidget *dw = NULL;        // DIsplay widget
+QTimer     *ticker = NULL;    // Single-shot display update timer
 QPainter   *painter;          // Qt painter object
 double     dpi = 2.0 * 3.1415926535897932;
 float      cf,                // Current time display circle frction
-           cfs,               // Current fraction sine
-           cfc,               // Current fraction cosine
            caz,               // Current Sun azimuth
            ce,                // Current Sun elevation
            cec,               // Current corrected Sun elevation
            csl,               // Current Sun latitude
            idx;               // Solar time minute to access the per-minute tables
+float      dirx     [NDIR + 1],   // Time display direction table, X components
+           diry     [NDIR + 1];   // Time display direction table, Y components
 
-// Global NOAA variables
+// Global location variables
 
-double lat_deg, 
-       long_deg,
-       date_d,
-       wtime_day,
-       dst_hr,
-       timezone_hr;
+double lat_deg,        // Latitude [Decimal degrees]
+       long_deg,       // Longitude [Decimal degrees]
+       date_d,         // Current date [Days since 1899 12 30]
+       timezone_hr,    // Timezone of the location, daylight saving time included [Hours]
+       timezone_std;   // Standard timezone of the location [Hours]
+int    dst_rule,       // Daylight saving time rule of the location
+       dst_hr;         // Daylight saving time in effect [Hours]
+const DstZone *dstz;   // Daylight saving time transitions of the location
 double my_timezone;    // TImezone of user's own location [Hours]
-double jday,           // Julian day
-       jcen,           // Julian century
-       gmlong_deg,     // Sun geom mean longitude
-       gmanom_deg,     // Sun geom mean anomaly
-       eccent,         // Earth orbit eccentricity
-       eqofctr,        // Sun eq of ctr
-       truelong_deg,   // Sun true longitude
-       trueanom_deg,   // Sun true anomaly
-       radvect_au,
-       applong_deg,
-       moe_deg,        // Mean obliq ecliptic
-       ocorr_deg,      // Obliq corr
-       rtasc_deg,      // Sun right ascension
-       decl_deg,       // Sun declination
-       var_y,
-       eqoftime_min,   // Equation of time
-       ha_rise_deg,
-       noon_lst,
-       rise_lst,
-       set_lst,
-       lightdur_min,
-       soltime_min,
-       hrangle_deg,
-       zangle_deg,      // Zenith angle
-       elev_deg,        // Sun elevation
-       refract_deg,     // Atmospheric refraction
-       elevc_deg,       // Refraction-corrected sun elevation
-       az_deg;          // Sun azimuth
+bool   my_tz_given;    // my_timezone given on the command line
+bool   use_avx2;       // Batch evaluation by the AVX2 kernel
+int    precision = PREC_DOUBLE;   // Precision tier of batch evaluation
+bool   smooth;         // Sub-minute pointer and values
+const char *fbdst = NULL;   // Headless framebuffer, NULL for the display
+int    fbfmt = FB_ARGB32;   // Headless framebuffer format
+volatile sig_atomic_t quitreq; // Stop request of headless rendering and the query daemon
+
+// Day table buffers handed between the GUI thread and the precompute worker
+
+std :: atomic <DayTab *>  prep  [3];         // Precomputed tables: current day, next day, next daylight saving time change
+std :: atomic <DayTab *>  spare [NSPARE];    // Free table buffers
+std :: atomic <int>       prepgen (0);       // Bumped by the GUI thread after taking a table or missing one
+std :: atomic <bool>      prepmiss (true);   // GUI thread without the tables of its key, the current day wanted
+bool                      tabstale;          // Tables of a past key kept until the worker has the new ones
+std :: atomic <bool>      prepquit (false);  // Worker stop request
+std :: mutex              prepmtx;           // Mutex of the worker's wait, locked only by the worker
+std :: condition_variable prepcv;            // Condition of the worker's wait
+std :: mutex              tabmtx;            // Mutex of the day table cache
+
+// Memory-mapped gazetteer
+
+const char *gazmap = NULL;   // Mapped noaa_clock.gaz or one compiled from noaa_clock.cnf, NULL if none
+size_t     gazlen  = 0;      // Mapped length [Bytes]
+const char *gazsrc = NULL;   // File gazmap is from
+char       locname [256];    // Location shown on the display, UTF-8
+
+// Grid display
+
+GridSite   *grid = NULL;      // Sites of the grid display
+int        ngrid = 0;         // Number of sites
+
+// Query daemon
+
+QryEnt     *qent = NULL;      // Day terms
+int        qhash [QRY_HASH];  // Hash chain heads, -1 for none
+int        qnent = 0;         // Day terms in use
+int        qmru  = -1;        // Most recently used day terms, -1 if none
+int        qlru  = -1;        // Least recently used day terms, -1 if none
+QryPend    qpend [QRY_FLUSH]; // Point queries waiting for the batch
+int        qnpend = 0;        // Number of them
+
+#ifdef NOAA_PERF
+
+// Hot-path timers
+
+PerfRing   perf [PS_NR];     // Samples per stage
+const char *perfname [PS_NR] = {"eloop", "load", "batch", "frame", "paint", "layer", "ring", "blit", "upd"};
+unsigned long long perft0;   // Ticks at start-up
+std :: chrono :: steady_clock :: time_point perfs0;     // Steady clock at start-up
+std :: chrono :: steady_clock :: time_point perflast;   // Last timer dump
+bool       perfshow;         // Timer overlay shown, toggled by P
+FILE       *perflog  = NULL; // Timer dump log, NULL if none
+int        perfsock  = -1;   // Timer dump Unix datagram socket, -1 if none
+#ifndef _WIN32
+struct sockaddr_un perfaddr; // Timer dump socket address
+#endif
+
+#endif
 
 
 
@@ -167,6 +712,111 @@ double r2d (double r) {return (360.0 * r / dpi);}
 
 
 
+/**************************************************************************\
+*
+* FUNCTION      initdir
+*
+* DESCRIPTION   Time display direction table initialization.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       dpi    2 * pi
+*               dirx   Time display direction table, X components
+*               diry   Time display direction table, Y components
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   First version
+*
+* NOTES         Entry NDIR repeats entry 0 so that interpolation needs no
+*               wrap.
+*
+\**************************************************************************/
+
+void initdir (void) {
+  int i;
+  for (i = 0 ; i <= NDIR ; i++) {
+    dirx [i] = - cos (dpi * (0.25 - (double) i / NDIR));
+    diry [i] =   sin (dpi * (0.25 - (double) i / NDIR));
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      dirvec
+*
+* DESCRIPTION   Time display direction of a fraction of a full circle.
+*
+* ARGUMENTS     f    Fraction of a full circle, 0 down, 0.25 left
+*               dx   Unit vector X component
+*               dy   Unit vector Y component
+*
+* GLOBALS       dirx   Time display direction table, X components
+*               diry   Time display direction table, Y components
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   First version
+*
+* NOTES         Linear interpolation between table entries, exact at the
+*               scale ticks. At NDIR steps the length error is < 2e-7.
+*
+\**************************************************************************/
+
+void dirvec (float f, float *dx, float *dy) {
+  float g, a;
+  int   i;
+  g  = f * NDIR;
+  i  = (int) g;
+  if (g < i) i--;
+  a  = g - i;
+  i %= NDIR;
+  if (i < 0) i += NDIR;
+  *dx = dirx [i] + a * (dirx [i + 1] - dirx [i]);
+  *dy = diry [i] + a * (diry [i + 1] - diry [i]);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      rayreg
+*
+* DESCRIPTION   Region covering a radial line.
+*
+* ARGUMENTS     ox       Origin X coordinate
+*               oy       Origin Y coordinate
+*               dx       Direction unit vector X component
+*               dy       Direction unit vector Y component
+*               startl   Starting radius
+*               endl     Ending radius
+*
+* GLOBALS       -
+*
+* RETURNS       Region
+*
+* HISTORY       2026 10 15   JPT   First version
+*
+* NOTES         A quadrangle 3 pixels to each side of the line and
+*               2 pixels past its ends.
+*
+\**************************************************************************/
+
+QRegion rayreg (int ox, int oy, float dx, float dy, int startl, int endl) {
+  QPolygon p (4);
+  startl -= 2;
+  endl   += 2;
+  p.setPoint (0, ox + startl * dx - 3 * dy, oy + startl * dy + 3 * dx);
+  p.setPoint (1, ox + endl   * dx - 3 * dy, oy + endl   * dy + 3 * dx);
+  p.setPoint (2, ox + endl   * dx + 3 * dy, oy + endl   * dy - 3 * dx);
+  p.setPoint (3, ox + startl * dx + 3 * dy, oy + startl * dy - 3 * dx);
+  return (QRegion (p));
+  }
+
+
+
 /**************************************************************************\
 *
 * METHOD        DispWidget :: drawtl
@@ -178,21 +828,22 @@ double r2d (double r) {return (360.0 * r / dpi);}
 *               endl     Ending radius
 *               c        Color
 *
-* GLOBALS       dpi   2 * pi
+* GLOBALS       -
 *
 * RETURNS       -
 *
 * HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Direction from the table
 *
 * NOTES         -
 *
 \**************************************************************************/
 
 void DispWidget :: drawtl (float f, int startl, int endl, unsigned int c) {
-  cfs =   sin (dpi * (- f + 0.25));
-  cfc = - cos (dpi * (- f + 0.25));
+  float fs, fc;
+  dirvec (f, &fc, &fs);
   painter -> setPen (QColor (c));
-  painter -> drawLine (OX + startl * cfc, OY + startl * cfs, OX + endl * cfc, OY + endl * cfs);
+  painter -> drawLine (OX + startl * fc, OY + startl * fs, OX + endl * fc, OY + endl * fs);
   }
 
 
@@ -208,11 +859,12 @@ void DispWidget :: drawtl (float f, int startl, int endl, unsigned int c) {
 *               loc   Radius of placement
 *               c     Color
 *
-* GLOBALS       dpi   2 * pi
+* GLOBALS       -
 *
 * RETURNS       -
 *
 * HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Direction from the table
 *
 * NOTES         -
 *
@@ -224,58 +876,109 @@ void DispWidget :: drawnum (float f, int n, int loc, unsigned int c) {
   char    s [4];
   sprintf (s, "%d", n);
   str = QString (s);
-  fs =   sin (dpi * (- f + 0.25));
-  fc = - cos (dpi * (- f + 0.25));
+  dirvec (f, &fc, &fs);
   painter -> setPen (QColor (c));
   painter -> drawText (OX + loc * fc - 8, OY + loc * fs, 16, 10, Qt :: AlignCenter, str);
   }
 
 
+
 /**************************************************************************\
 *
-* METHOD        DispWidget :: upd
+* METHOD        DispWidget :: drawring
+*
+* DESCRIPTION   Time display twilight color zones.
+*
+* ARGUMENTS     startl   Starting radius
+*               endl     Ending radius
+*
+* GLOBALS       tab       Per-minute tables of the current day
+*               painter   Qt painter object
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Replaces 5760 drawtl () calls
+*
+* NOTES         The ring is split into runs of equal twilight band, day,
+*               golden hour, civil, nautical and astronomical, and all
+*               runs of a band are drawn as arcs of one path, i.e. at most
+*               five antialiased draw calls. Qt angles are counterclockwise
+*               from three o'clock, fraction 0 of the display is at six.
+*
+\**************************************************************************/
+
+void DispWidget :: drawring (int startl, int endl) {
+  static const unsigned int bc [5] = { 0x00ffffff, 0x00ffff00, 0x00ff0000, 0x000000ff, 0x00808080 };
+  QPainterPath p [5];
+  QPen         pen;
+  double       r, a;
+  int          i, j, b, bs, js;
+  PERF (PS_RING);
+  r = 0.5 * (startl + endl);
+  QRectF rr (OX - r, OY - r, 2 * r, 2 * r);
+  bs = -1;
+  js = 0;
+  for (j = 0 ; j <= 5760 ; j++) {
+    b = -1;
+    if (j < 5760) {
+      i = j / 4;
+      i = i - tab -> solarmin [0]; if (i < 0) i += 1440; if (i >= 1440) i -= 1440;
+      if      (tab -> elevc [i] >=   3.0) b =  0;
+      else if (tab -> elevc [i] >=   0.0) b =  1;
+      else if (tab -> elevc [i] >=  -6.0) b =  2;
+      else if (tab -> elevc [i] >= -12.0) b =  3;
+      else if (tab -> elevc [i] >= -18.0) b =  4;
+      }
+    if ((j == 5760) || (b != bs)) {
+      if (bs >= 0) {
+        a = 270.0 - 360.0 * js / 5760.0;
+        p [bs].arcMoveTo (rr, a);
+        p [bs].arcTo (rr, a, - 360.0 * (j - js) / 5760.0);
+        }
+      bs = b;
+      js = j;
+      }
+    }
+  pen.setWidthF (endl - startl);
+  pen.setCapStyle (Qt :: FlatCap);
+  painter -> setRenderHint (QPainter :: Antialiasing, true);
+  for (b = 0 ; b < 5 ; b++) {
+    if (p [b].isEmpty ()) continue;
+    pen.setColor (QColor (bc [b]));
+    painter -> setPen (pen);
+    painter -> drawPath (p [b]);
+    }
+  painter -> setRenderHint (QPainter :: Antialiasing, false);
+  }
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: updscale
 *
-* DESCRIPTION   Display updating.
+* DESCRIPTION   Display updating, scales that never change: solar time
+*               scale, Sun elevation scale, captions, dials and location.
 *
 * ARGUMENTS     -
 *
-* GLOBALS       dpi        2 * pi
-*               solarmin   Solar time in minutes
-*               elevc      Corrected elevation of Sun
-*               cf         Current time display circle fraction
-*               ce         Current elevation of Sun
-*               cec        Current corrected elevation of Sun
-*               caz        Current azimuth of Sun
-*               csl        Current longitude of Sun
-~               painter    Qt painter object
+* GLOBALS       painter    Qt painter object
+*               locname    Location shown
 *
 * RETURNS       -
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Split out of upd ()
+*               2026 10 15   JPT   Location caption
 *
-* NOTES         -
+* NOTES         Drawn once into scalelayer.
 *
 \**************************************************************************/
 
-void DispWidget :: upd (void) {
+void DispWidget :: updscale (void) {
 
   QString str;
   char    s [32];
-  int     i, j, e, ec;
-  float   f, as, ac;
-
-  // Time display, color zones (i and j before addition are local for the tables, solar for the display)
-
-  for (j = 0 ; j < 5760 ; j++) {
-    i = j / 4;
-    i = i - solarmin [0]; if (i < 0) i += 1440; if (i >= 1440) i -= 1440;
-    f = j / 5760.0;
-    if  (elevc [i] >=  3.0)                          drawtl (f, 310, 315, 0x00ffffff);
-    if ((elevc [i] <   3.0) && (elevc [i] >=   0.0)) drawtl (f, 310, 315, 0x00ffff00);
-    if ((elevc [i] <   0.0) && (elevc [i] >=  -6.0)) drawtl (f, 310, 315, 0x00ff0000);
-    if ((elevc [i] <  -6.0) && (elevc [i] >= -12.0)) drawtl (f, 310, 315, 0x000000ff);
-    if ((elevc [i] < -12.0) && (elevc [i] >= -18.0)) drawtl (f, 310, 315, 0x00808080);
-    }
+  int     i;
+  float   f;
 
   // Time display, solar time
 
@@ -286,20 +989,6 @@ void DispWidget :: upd (void) {
     else if (i %  20 == 0) drawtl (f, 420, 430, 0x00ffffff);
     }
 
-  // Time display, wall clock time
-
-  for (i = 0 ; i < 1440 ; i++) {
-    f = (i + solarmin [0]) / 1440.0;
-    if      (i % 360 == 0) drawtl  (f, 360,    410, 0x00ffffff);
-    if      (i %  60 == 0) drawtl  (f, 360,    390, 0x00ffffff);
-    else if (i %  20 == 0) drawtl  (f, 360,    370, 0x00ffffff);
-    if      (i % 180 == 0) drawnum (f, i / 60, 340, 0x00ffffff);
-    }
-
-  // Time display, pointer
-
-  drawtl (cf, 0, 425, 0x00ff8000);
-
   // Sun elevation
 
   sprintf (s, "Sun elevation");
@@ -323,24 +1012,6 @@ void DispWidget :: upd (void) {
     painter -> setPen (QColor (  0,   0, 255)); painter -> drawLine (i, OY - 5 * ( -6), i, OY - 5 * (-12));
     painter -> setPen (QColor (128, 128, 128)); painter -> drawLine (i, OY - 5 * (-12), i, OY - 5 * (-18));
     }
-  for (i = -2 ; i <= 2 ; i++) {
-    ec = OY - 5 * cec ; painter -> setPen (QColor (255, 192,   0));
-    painter -> drawLine (EOX - 20, ec + i, EOX - 8 * abs (i), ec + i);
-    }
-  for (i = -2 ; i <= 2 ; i++) {
-    e  = OY - 5 * ce;  painter -> setPen (QColor (192, 192, 192));
-    painter -> drawLine (EOX - 20, e,  EOX - 8 * abs (i), e);
-    }
-  sprintf (s, "%+5.1f", cec);
-  str = QString (s);
-  painter -> setPen (QColor (255, 255, 255));
-  painter -> drawText (EOX - 60, ec - 4, 40, 10, Qt :: AlignCenter, str);
-  if (fabs ((double) (cec - ce)) > 0.1) {
-    sprintf (s, "%+5.1f", ce);
-    str = QString (s);
-    painter -> setPen (QColor (128, 128, 128));
-    painter -> drawText (EOX + 30, e - 4, 40, 10, Qt :: AlignCenter, str);
-    }
 
   // Sun azimuth
 
@@ -350,14 +1021,6 @@ void DispWidget :: upd (void) {
   painter -> drawText (AOX - 40, 10, 88, 10, Qt :: AlignCenter, str);
   painter -> setPen (QColor (255, 255, 255));
   painter -> drawEllipse (AOX - 200, AOY - 200, 400, 400);
-  painter -> setPen (QColor (255, 128,   0));
-  as = - sin (dpi * (caz - 90.0) / 360.0);
-  ac = - cos (dpi * (caz - 90.0) / 360.0);
-  painter -> drawLine (AOX, AOY,  AOX + 200 * ac, AOY + 200 * as);
-  sprintf (s, "%3.0f", caz);
-  str = QString (s);
-  painter -> setPen (QColor (255, 255, 255));
-  painter -> drawText (AOX + 220 * ac - 12, AOY + 220 * as - 8, 24, 10, Qt :: AlignCenter, str);
 
   // Sun longitude
 
@@ -367,12 +1030,133 @@ void DispWidget :: upd (void) {
   painter -> drawText (LOX - 60, OY + 10, 104, 14, Qt :: AlignCenter, str);
   painter -> setPen (QColor (255, 255, 255));
   painter -> drawEllipse (LOX - 200, LOY - 200, 400, 400);
-  painter -> setPen (QColor (255, 128,   0));
-  as = - sin (dpi * csl / 360.0);
-  ac = - cos (dpi * csl / 360.0);
-  painter -> drawLine (LOX, LOY,  LOX + 200 * ac, LOY + 200 * as);
-  sprintf (s, "%3.0f", csl);
-  str = QString (s);
+
+  // Location
+
+  painter -> setPen (QColor (255, 255, 255));
+  painter -> drawText (10, 10, 400, 14, Qt :: AlignLeft | Qt :: AlignVCenter, QString :: fromUtf8 (locname));
+
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: updday
+*
+* DESCRIPTION   Display updating, scales that change daily: twilight color
+*               zones and wall clock time scale.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       tab        Per-minute tables of the current day
+*               painter    Qt painter object
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Split out of upd ()
+*
+* NOTES         Drawn into daylayer over a copy of scalelayer.
+*
+\**************************************************************************/
+
+void DispWidget :: updday (void) {
+
+  int     i;
+  float   f;
+
+  // Time display, color zones
+
+  drawring (310, 315);
+
+  // Time display, wall clock time
+
+  for (i = 0 ; i < 1440 ; i++) {
+    f = (i + tab -> solarmin [0]) / 1440.0;
+    if      (i % 360 == 0) drawtl  (f, 360,    410, 0x00ffffff);
+    if      (i %  60 == 0) drawtl  (f, 360,    390, 0x00ffffff);
+    else if (i %  20 == 0) drawtl  (f, 360,    370, 0x00ffffff);
+    if      (i % 180 == 0) drawnum (f, i / 60, 340, 0x00ffffff);
+    }
+
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: upd
+*
+* DESCRIPTION   Display updating, pointers and live values.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       cf         Current time display circle fraction
+*               ce         Current elevation of Sun
+*               cec        Current corrected elevation of Sun
+*               caz        Current azimuth of Sun
+*               csl        Current longitude of Sun
+~               painter    Qt painter object
+*
+* RETURNS       -
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Scales moved to updscale () and updday ()
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void DispWidget :: upd (void) {
+
+  QString str;
+  char    s [32];
+  int     i, e, ec;
+  float   as, ac;
+  PERF (PS_UPD);
+
+  // Time display, pointer
+
+  drawtl (cf, 0, 425, 0x00ff8000);
+
+  // Sun elevation
+
+  for (i = -2 ; i <= 2 ; i++) {
+    ec = OY - 5 * cec ; painter -> setPen (QColor (255, 192,   0));
+    painter -> drawLine (EOX - 20, ec + i, EOX - 8 * abs (i), ec + i);
+    }
+  for (i = -2 ; i <= 2 ; i++) {
+    e  = OY - 5 * ce;  painter -> setPen (QColor (192, 192, 192));
+    painter -> drawLine (EOX - 20, e,  EOX - 8 * abs (i), e);
+    }
+  sprintf (s, "%+5.1f", cec);
+  str = QString (s);
+  painter -> setPen (QColor (255, 255, 255));
+  painter -> drawText (EOX - 60, ec - 4, 40, 10, Qt :: AlignCenter, str);
+  if (fabs ((double) (cec - ce)) > 0.1) {
+    sprintf (s, "%+5.1f", ce);
+    str = QString (s);
+    painter -> setPen (QColor (128, 128, 128));
+    painter -> drawText (EOX + 30, e - 4, 40, 10, Qt :: AlignCenter, str);
+    }
+
+  // Sun azimuth
+
+  painter -> setPen (QColor (255, 128,   0));
+  dirvec (caz / 360.0, &ac, &as);
+  painter -> drawLine (AOX, AOY,  AOX + 200 * ac, AOY + 200 * as);
+  sprintf (s, "%3.0f", caz);
+  str = QString (s);
+  painter -> setPen (QColor (255, 255, 255));
+  painter -> drawText (AOX + 220 * ac - 12, AOY + 220 * as - 8, 24, 10, Qt :: AlignCenter, str);
+
+  // Sun longitude
+
+  painter -> setPen (QColor (255, 128,   0));
+  dirvec (csl / 360.0 + 0.25, &ac, &as);
+  painter -> drawLine (LOX, LOY,  LOX + 200 * ac, LOY + 200 * as);
+  sprintf (s, "%3.0f", csl);
+  str = QString (s);
   painter -> setPen (QColor (255, 255, 255));
   painter -> drawText (LOX + 220 * ac - 12, LOY + 220 * as - 8, 24, 10, Qt :: AlignCenter, str);
 
@@ -382,432 +1166,6741 @@ void DispWidget :: upd (void) {
 
 /**************************************************************************\
 *
-* METHOD        DispWidget :: paintEvent
+* METHOD        DispWidget :: draw
+*
+* DESCRIPTION   Display drawing.
+*
+* ARGUMENTS     dev   Paint device: the widget or the headless framebuffer
+*               reg   Region to draw
+*
+* GLOBALS       painter   Qt painter object
+*               tab       Per-minute tables of the current day
+*
+* RETURNS       -
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Scales composited from cached layers
+*               2026 10 15   JPT   Only the exposed region painted
+*               2026 10 15   JPT   Timers and their overlay
+*               2026 10 15   JPT   Split out of paintEvent () for headless rendering
+*               2026 10 16   JPT   Scaled by sc
+*
+* NOTES         The layout is 1920 x 1080, drawn scaled by sc to the
+*               size of a headless framebuffer; reg is in pixels.
+*               scalelayer is redrawn only when the widget is resized,
+*               daylayer also when the tables change, i.e. at a new day,
+*               a daylight saving time change or a new location.
+*               Everything is clipped to reg, which after dirty () is just
+*               the old and new pointers and values. The timer overlay
+*               goes over everything. The layers are in layerfmt, the
+*               format of the headless framebuffer, so the blit does not
+*               convert.
+*
+\**************************************************************************/
+
+void DispWidget :: draw (QPaintDevice *dev, const QRegion &reg) {
+  PERF (PS_PAINT);
+  if (tab == NULL) return;
+  if (scalelayer.size () != size ()) {
+    PERF (PS_LAYER);
+    scalelayer = QImage (size (), layerfmt);
+    scalelayer.fill (QColor (0, 0, 0));
+    painter -> begin (&scalelayer);
+    painter -> scale (sc, sc);
+    updscale ();
+    painter -> end ();
+    daylayer = QImage ();
+    }
+  if ((daylayer.size () != size ()) || (! samekey (&daylayerkey, &tab -> key))) {
+    PERF (PS_LAYER);
+    daylayer = scalelayer.copy ();
+    painter -> begin (&daylayer);
+    painter -> scale (sc, sc);
+    updday ();
+    painter -> end ();
+    daylayerkey = tab -> key;
+    }
+  painter -> begin (dev);
+  painter -> setClipRegion (reg);
+  PERF_BEGIN (tb);
+  for (const QRect &r : reg) painter -> drawImage (r, daylayer, r);
+  PERF_END (PS_BLIT, tb);
+  painter -> scale (sc, sc);
+  upd ();
+#ifdef NOAA_PERF
+  if (perfshow) perfdraw ();
+#endif
+  painter -> end ();
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: paintEvent
+*
+* DESCRIPTION   Display painting callback.
+*
+* ARGUMENTS     e   Paint event
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Drawing moved to draw ()
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void DispWidget :: paintEvent (QPaintEvent *e) {
+  draw (this, e -> region ());
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: dynreg
+*
+* DESCRIPTION   Region of the pointers and live values.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       cf         Current time display circle fraction
+*               ce         Current elevation of Sun
+*               cec        Current corrected elevation of Sun
+*               caz        Current azimuth of Sun
+*               csl        Current longitude of Sun
+*
+* RETURNS       Region
+*
+* HISTORY       2026 10 15   JPT   First version
+*
+* NOTES         Covers everything upd () draws, with margin for the text.
+*
+\**************************************************************************/
+
+QRegion DispWidget :: dynreg (void) {
+  QRegion r;
+  float   dx, dy;
+  int     e, ec;
+  dirvec (cf, &dx, &dy);
+  r = rayreg (OX, OY, dx, dy, 0, 425);
+  ec = OY - 5 * cec;
+  e  = OY - 5 * ce;
+  r = r | QRegion (EOX - 62, ((ec < e) ? ec : e) - 8, 134, abs (ec - e) + 18);
+  dirvec (caz / 360.0, &dx, &dy);
+  r = r | rayreg (AOX, AOY, dx, dy, 0, 200);
+  r = r | QRegion (AOX + 220 * dx - 16, AOY + 220 * dy - 12, 32, 18);
+  dirvec (csl / 360.0 + 0.25, &dx, &dy);
+  r = r | rayreg (LOX, LOY, dx, dy, 0, 200);
+  r = r | QRegion (LOX + 220 * dx - 16, LOY + 220 * dy - 12, 32, 18);
+  return (r);
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: devreg
+*
+* DESCRIPTION   Region of the layout in pixels.
+*
+* ARGUMENTS     r   Region in the 1920 x 1080 layout
+*
+* GLOBALS       -
+*
+* RETURNS       Region
+*
+* HISTORY       2026 10 16   JPT   First version
+*
+* NOTES         Rounded outwards by a pixel for antialiased edges.
+*
+\**************************************************************************/
+
+QRegion DispWidget :: devreg (const QRegion &r) {
+  QRegion d;
+  if (sc == 1) return (r);
+  for (const QRect &q : r)
+    d += QRect (floor (q.x () * sc) - 1, floor (q.y () * sc) - 1, ceil (q.width () * sc) + 3, ceil (q.height () * sc) + 3);
+  return (d);
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: dirty
+*
+* DESCRIPTION   Region to redraw for the current values.
+*
+* ARGUMENTS     all   Whole widget changed
+*
+* GLOBALS       cf         Current time display circle fraction
+*               ce         Current elevation of Sun
+*               cec        Current corrected elevation of Sun
+*               caz        Current azimuth of Sun
+*               csl        Current longitude of Sun
+*
+* RETURNS       Region, empty if nothing changed
+*
+* HISTORY       2026 10 15   JPT   First version
+*               2026 10 15   JPT   Split out of invalidate ()
+*               2026 10 16   JPT   In pixels
+*
+* NOTES         Nothing is redrawn when the values are those last drawn,
+*               otherwise the old and new pointer regions, in pixels. The
+*               values are then taken as drawn.
+*
+\**************************************************************************/
+
+QRegion DispWidget :: dirty (bool all) {
+  QRegion r, u;
+  if ((! all) && shownok && (shown [0] == cf) && (shown [1] == ce) && (shown [2] == cec) &&
+      (shown [3] == caz) && (shown [4] == csl)) return (u);
+  r = devreg (dynreg ());
+  if (all || (! shownok)) u = QRegion (rect ());
+  else                    u = shownreg | r;
+  shownreg  = r;
+  shown [0] = cf;
+  shown [1] = ce;
+  shown [2] = cec;
+  shown [3] = caz;
+  shown [4] = csl;
+  shownok   = true;
+  return (u);
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: invalidate
+*
+* DESCRIPTION   Display repaint scheduling.
+*
+* ARGUMENTS     all   Whole widget changed
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   First version
+*               2026 10 15   JPT   Region from dirty ()
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void DispWidget :: invalidate (bool all) {
+  QRegion r;
+  r = dirty (all);
+  if (! r.isEmpty ()) update (r);
+  }
+
+
+
+#ifdef NOAA_PERF
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perfticks, perfscale
+*
+* DESCRIPTION   Timer clock and its scale.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       perft0   Ticks at start-up
+*               perfs0   Steady clock at start-up
+*
+* RETURNS       perfticks (): ticks; perfscale (): nanoseconds per tick
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The time stamp counter where there is one, which costs a
+*               few nanoseconds, scaled by the steady clock over the run
+*               so far. Elsewhere the steady clock in nanoseconds.
+*
+\**************************************************************************/
+
+unsigned long long perfticks (void) {
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+  return (__builtin_ia32_rdtsc ());
+#elif defined (_MSC_VER) && (defined (_M_X64) || defined (_M_IX86))
+  return (__rdtsc ());
+#else
+  return (std :: chrono :: duration_cast <std :: chrono :: nanoseconds> (std :: chrono :: steady_clock :: now ().time_since_epoch ()).count ());
+#endif
+  }
+
+double perfscale (void) {
+  double ns, tk;
+  ns = std :: chrono :: duration <double, std :: nano> (std :: chrono :: steady_clock :: now () - perfs0).count ();
+  tk = (double) (perfticks () - perft0);
+  return ((ns > 0) && (tk > 0) ? ns / tk : 1.0);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perfinit
+*
+* DESCRIPTION   Timer start-up.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       perft0     Ticks at start-up
+*               perfs0     Steady clock at start-up
+*               perflast   Last timer dump
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void perfinit (void) {
+  perft0   = perfticks ();
+  perfs0   = std :: chrono :: steady_clock :: now ();
+  perflast = perfs0;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perfadd
+*
+* DESCRIPTION   Recording a timed sample.
+*
+* ARGUMENTS     s    Stage
+*               t0   Start [Ticks]
+*               t1   End [Ticks]
+*
+* GLOBALS       perf   Samples per stage
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Lock-free, any thread. Each sample takes its own slot by
+*               an atomic increment; the oldest sample is overwritten.
+*
+\**************************************************************************/
+
+void perfadd (int s, unsigned long long t0, unsigned long long t1) {
+  unsigned int i;
+  i = perf [s].head.fetch_add (1, std :: memory_order_relaxed) & (PERF_N - 1);
+  perf [s].dur [i].store ((t1 - t0 > 0xffffffffULL) ? 0xffffffffU : (unsigned int) (t1 - t0), std :: memory_order_relaxed);
+  perf [s].end [i].store (t1, std :: memory_order_relaxed);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perfstats
+*
+* DESCRIPTION   Statistics of a timed stage.
+*
+* ARGUMENTS     s       Stage
+*               scale   Nanoseconds per tick
+*               now     Current time [Ticks]
+*               p50     Median [Microseconds]
+*               p99     99th percentile [Microseconds]
+*               n       Samples within the last minute
+*
+* GLOBALS       perf   Samples per stage
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The percentiles are over the last PERF_N samples. A
+*               sample being written meanwhile may be read half old, half
+*               new, which the statistics tolerate.
+*
+\**************************************************************************/
+
+void perfstats (int s, double scale, unsigned long long now, double *p50, double *p99, int *n) {
+  unsigned int       d [PERF_N], m, i;
+  unsigned long long w;
+  m  = perf [s].head.load (std :: memory_order_relaxed);
+  if (m > PERF_N) m = PERF_N;
+  w  = (unsigned long long) (60e9 / scale);
+  *n = 0;
+  for (i = 0 ; i < m ; i++) {
+    d [i] = perf [s].dur [i].load (std :: memory_order_relaxed);
+    if (now - perf [s].end [i].load (std :: memory_order_relaxed) < w) (*n)++;
+    }
+  if (m == 0) {
+    *p50 = *p99 = 0;
+    return;
+    }
+  std :: sort (d, d + m);
+  *p50 = d [m / 2] * scale / 1000;
+  *p99 = d [m * 99 / 100] * scale / 1000;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perfdraw
+*
+* DESCRIPTION   Timer overlay drawing.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       painter   Qt painter object
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Median and 99th percentile per stage and the samples of
+*               the last minute, in the bottom left corner outside the
+*               time display. Frames are paint events, wake-ups timer
+*               responses; the shown overlay itself wakes the display
+*               every second.
+*
+\**************************************************************************/
+
+void perfdraw (void) {
+  unsigned long long now;
+  char   s [64];
+  double scale, p50, p99;
+  int    k, n, nf, nw, y;
+  scale = perfscale ();
+  now   = perfticks ();
+  painter -> fillRect (PERF_X, PERF_Y, PERF_W, PERF_H, QColor (0, 0, 0));
+  painter -> setPen (QColor (0, 255, 0));
+  y = PERF_Y + 4;
+  painter -> drawText (PERF_X +   4, y,  60, 12, Qt :: AlignLeft  | Qt :: AlignVCenter, QString ("stage"));
+  painter -> drawText (PERF_X +  64, y,  70, 12, Qt :: AlignRight | Qt :: AlignVCenter, QString ("p50 [us]"));
+  painter -> drawText (PERF_X + 140, y,  70, 12, Qt :: AlignRight | Qt :: AlignVCenter, QString ("p99 [us]"));
+  painter -> drawText (PERF_X + 216, y,  70, 12, Qt :: AlignRight | Qt :: AlignVCenter, QString ("/min"));
+  nf = nw = 0;
+  for (k = 0 ; k < PS_NR ; k++) {
+    perfstats (k, scale, now, &p50, &p99, &n);
+    if (k == PS_PAINT) nf = n;
+    if (k == PS_ELOOP) nw = n;
+    y += 12;
+    painter -> drawText (PERF_X +   4, y,  60, 12, Qt :: AlignLeft  | Qt :: AlignVCenter, QString (perfname [k]));
+    sprintf (s, "%.1f", p50);
+    painter -> drawText (PERF_X +  64, y,  70, 12, Qt :: AlignRight | Qt :: AlignVCenter, QString (s));
+    sprintf (s, "%.1f", p99);
+    painter -> drawText (PERF_X + 140, y,  70, 12, Qt :: AlignRight | Qt :: AlignVCenter, QString (s));
+    sprintf (s, "%d", n);
+    painter -> drawText (PERF_X + 216, y,  70, 12, Qt :: AlignRight | Qt :: AlignVCenter, QString (s));
+    }
+  y += 12;
+  sprintf (s, "%d frames/min, %d wake-ups/min", nf, nw);
+  painter -> drawText (PERF_X + 4, y, PERF_W - 8, 12, Qt :: AlignLeft | Qt :: AlignVCenter, QString (s));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perfopen
+*
+* DESCRIPTION   Opening the timer dump.
+*
+* ARGUMENTS     dst   Log file, - for standard output, or unix:path of a
+*                     Unix datagram socket
+*
+* GLOBALS       perflog    Timer dump log
+*               perfsock   Timer dump socket
+*               perfaddr   Timer dump socket address
+*
+* RETURNS       true if opened
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The socket is not connected, so a listener such as
+*               socat UNIX-RECV:path - may come and go; nothing is sent
+*               while there is none.
+*
+\**************************************************************************/
+
+bool perfopen (const char *dst) {
+#ifndef _WIN32
+  if (strncmp (dst, "unix:", 5) == 0) {
+    if (strlen (dst + 5) >= sizeof (perfaddr.sun_path)) return (false);
+    perfsock = socket (AF_UNIX, SOCK_DGRAM, 0);
+    if (perfsock < 0) return (false);
+    fcntl (perfsock, F_SETFL, O_NONBLOCK);
+    memset (&perfaddr, 0, sizeof (perfaddr));
+    perfaddr.sun_family = AF_UNIX;
+    strcpy (perfaddr.sun_path, dst + 5);
+    return (true);
+    }
+#endif
+  perflog = (strcmp (dst, "-") == 0) ? stdout : fopen (dst, "a");
+  return (perflog != NULL);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      perftick
+*
+* DESCRIPTION   Timer dump when due.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       perflog    Timer dump log
+*               perfsock   Timer dump socket
+*               perflast   Last timer dump
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Called from the display update timer response; dumps
+*               every PERF_DUMP seconds one line of JSON with the
+*               samples of the last minute and the percentiles per
+*               stage in microseconds.
+*
+\**************************************************************************/
+
+void perftick (void) {
+  std :: chrono :: steady_clock :: time_point now;
+  unsigned long long tk;
+  char   buf [2048];
+  double scale, p50, p99;
+  time_t tt;
+  int    k, n, len;
+  if ((perflog == NULL) && (perfsock < 0)) return;
+  now = std :: chrono :: steady_clock :: now ();
+  if (now - perflast < std :: chrono :: seconds (PERF_DUMP)) return;
+  perflast = now;
+  scale = perfscale ();
+  tk    = perfticks ();
+  tt    = time (NULL);
+  len   = (int) strftime (buf, sizeof (buf), "{\"time\": \"%Y-%m-%dT%H:%M:%SZ\"", gmtime (&tt));
+  for (k = 0 ; k < PS_NR ; k++) {
+    perfstats (k, scale, tk, &p50, &p99, &n);
+    len += snprintf (buf + len, sizeof (buf) - len, ", \"%s\": {\"n\": %d, \"p50_us\": %.1f, \"p99_us\": %.1f}", perfname [k], n, p50, p99);
+    }
+  len += snprintf (buf + len, sizeof (buf) - len, "}\n");
+  if (perflog != NULL) {
+    fputs (buf, perflog);
+    fflush (perflog);
+    }
+#ifndef _WIN32
+  if (perfsock >= 0) sendto (perfsock, buf, len, 0, (struct sockaddr *) &perfaddr, sizeof (perfaddr));
+#endif
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: keyPressEvent
+*
+* DESCRIPTION   Key press callback, P toggles the timer overlay.
+*
+* ARGUMENTS     e   Key event
+*
+* GLOBALS       perfshow   Timer overlay shown
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void DispWidget :: keyPressEvent (QKeyEvent *e) {
+  if (e -> key () != Qt :: Key_P) {
+    QWidget :: keyPressEvent (e);
+    return;
+    }
+  perfshow = ! perfshow;
+  update ();
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: event
+*
+* DESCRIPTION   Event callback, timing of the update requests.
+*
+* ARGUMENTS     e   Event
+*
+* GLOBALS       -
+*
+* RETURNS       Event handled
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         An update request paints and then flushes the backing
+*               store to the screen, so the frame stage less the paint
+*               stage is the blit to the screen.
+*
+\**************************************************************************/
+
+bool DispWidget :: event (QEvent *e) {
+  if (e -> type () != QEvent :: UpdateRequest) return (QWidget :: event (e));
+  PERF (PS_FRAME);
+  return (QWidget :: event (e));
+  }
+
+#endif
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_sun
+*
+* DESCRIPTION   Date-dependent part of the NOAA solar equations, from the
+*               Julian century to the equation of time.
+*
+* ARGUMENTS     o   Results, jday set on entry
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Split out of noaa_eq ()
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void noaa_sun (NoaaOut *o) {
+  o -> jcen = (o -> jday - 2451545) / 36525;
+  o -> gmlong_deg   = fmod (280.46646 + o -> jcen * (36000.76983 + o -> jcen * 0.0003032), 360.0);
+  o -> gmanom_deg   = 357.52911 + o -> jcen * (35999.05029 - 0.0001537 * o -> jcen);
+  o -> eccent       = 0.016708634 - o -> jcen  * (0.000042037 + 0.0000001267 * o -> jcen);
+  o -> eqofctr      =   sin (d2r (o -> gmanom_deg)) * (1.914602 - o -> jcen * (0.004817 + 0.000014 * o -> jcen))
+                      + sin (d2r (2 * o -> gmanom_deg)) * (0.019993 - 0.000101 * o -> jcen)
+                      + sin (d2r (3 * o -> gmanom_deg)) * 0.000289;
+  o -> truelong_deg = o -> gmlong_deg + o -> eqofctr;
+  o -> trueanom_deg = o -> gmanom_deg + o -> eqofctr;
+  o -> radvect_au   = (1.000001018 * (1 - o -> eccent * o -> eccent)) / (1 + o -> eccent * cos (d2r (o -> trueanom_deg)));
+  o -> applong_deg  = o -> truelong_deg - 0.00569 - 0.00478 * sin (d2r (125.04 - 1934.136 * o -> jcen));
+  o -> moe_deg      = 23 + (26 + ((21.448 - o -> jcen * (46.815 + o -> jcen * (0.00059 - o -> jcen * 0.001813)))) / 60) / 60;
+  o -> ocorr_deg    = o -> moe_deg + 0.00256 * cos (d2r (125.04 - 1934.136 * o -> jcen));
+  o -> rtasc_deg    = r2d (atan2 (cos (d2r (o -> applong_deg)), cos (d2r (o -> ocorr_deg)) * sin (d2r (o -> applong_deg))));
+  o -> decl_deg     = r2d (asin (sin (d2r (o -> ocorr_deg)) * sin (d2r (o -> applong_deg))));
+  o -> var_y        = tan (d2r (o -> ocorr_deg / 2)) * tan (d2r (o -> ocorr_deg / 2));
+  o -> eqoftime_min =   4 * r2d (o -> var_y * sin (2 *d2r (o -> gmlong_deg))
+                      - 2 * o -> eccent * sin (d2r (o -> gmanom_deg))
+                      + 4 * o -> eccent * o -> var_y * sin (d2r (o -> gmanom_deg)) * cos (2 * d2r (o -> gmlong_deg))
+                      - 0.5 * o -> var_y * o -> var_y * sin (4 * d2r (o -> gmlong_deg))
+                      - 1.25 * o -> eccent * o -> eccent * sin (2 * d2r (o -> gmanom_deg)));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_chebfit
+*
+* DESCRIPTION   Chebyshev fit of the slowly varying solar terms over one
+*               ephemeris segment.
+*
+* ARGUMENTS     jd0   Start of the segment [Julian day]
+*               c     Coefficients of declination [deg], equation of time
+*                     [min], equation of centre [deg] and radius vector [AU]
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Interpolation at the CHEB_N Chebyshev nodes, which is
+*               within a hair of the minimax fit. The true longitude is
+*               fitted as the equation of centre, the smooth remainder of
+*               it after the exact mean longitude.
+*
+\**************************************************************************/
+
+void noaa_chebfit (double jd0, float c [4][CHEB_N]) {
+  NoaaOut o;
+  double  f [4][CHEB_N], a;
+  int     j, k, q;
+  for (k = 0 ; k < CHEB_N ; k++) {
+    o.jday = jd0 + CHEB_SEG * 0.5 * (1 + cos (M_PI * (k + 0.5) / CHEB_N));
+    noaa_sun (&o);
+    f [0][k] = o.decl_deg;
+    f [1][k] = o.eqoftime_min;
+    f [2][k] = o.eqofctr;
+    f [3][k] = o.radvect_au;
+    }
+  for (q = 0 ; q < 4 ; q++) {
+    for (j = 0 ; j < CHEB_N ; j++) {
+      a = 0;
+      for (k = 0 ; k < CHEB_N ; k++) a += f [q][k] * cos (M_PI * j * (k + 0.5) / CHEB_N);
+      c [q][j] = (float) (a * 2 / CHEB_N);
+      }
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_chebeval
+*
+* DESCRIPTION   Slowly varying solar terms from Chebyshev coefficients.
+*
+* ARGUMENTS     c   Coefficients of the segment from noaa_chebfit ()
+*               x   Position within the segment, -1...1
+*               o   Results, jday set on entry
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Clenshaw recurrence, two FMAs per coefficient and
+*               quantity. Fills jcen, gmlong_deg, eqofctr, truelong_deg,
+*               radvect_au, decl_deg and eqoftime_min.
+*
+\**************************************************************************/
+
+void noaa_chebeval (const float c [4][CHEB_N], double x, NoaaOut *o) {
+  double b1 [4], b2 [4], b, v [4];
+  int    j, q;
+  for (q = 0 ; q < 4 ; q++) {
+    b1 [q] = b2 [q] = 0;
+    for (j = CHEB_N - 1 ; j >= 1 ; j--) {
+      b = 2 * x * b1 [q] - b2 [q] + c [q][j];
+      b2 [q] = b1 [q];
+      b1 [q] = b;
+      }
+    v [q] = x * b1 [q] - b2 [q] + 0.5 * c [q][0];
+    }
+  o -> jcen         = (o -> jday - 2451545) / 36525;
+  o -> gmlong_deg   = fmod (280.46646 + o -> jcen * (36000.76983 + o -> jcen * 0.0003032), 360.0);
+  o -> decl_deg     = v [0];
+  o -> eqoftime_min = v [1];
+  o -> eqofctr      = v [2];
+  o -> truelong_deg = o -> gmlong_deg + v [2];
+  o -> radvect_au   = v [3];
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_chebcheck
+*
+* DESCRIPTION   Chebyshev ephemeris error against the full series.
+*
+* ARGUMENTS     tab    Coefficients, segment by segment
+*               nseg   Segments
+*               emax   Maximum errors of declination [deg], equation of
+*                      time [min], true longitude [deg], radius vector [AU]
+*
+* GLOBALS       -
+*
+* RETURNS       True if within the tolerances
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Tolerances of the displayed accuracy
+*
+* NOTES         Sampled every 0.1 day. The tolerances keep the shown
+*               values: 0.002 deg of declination is a fiftieth of the
+*               0.1 deg elevation shown, 0.01 min of equation of time
+*               0.6 s of the event times shown to the second. The 128-day
+*               segments of 8 coefficients, 55 KB, reach 1.0e-3 deg,
+*               5.2e-3 min, 3e-6 deg and 7e-8 AU.
+*
+\**************************************************************************/
+
+bool noaa_chebcheck (const float (*tab) [4][CHEB_N], int nseg, double emax [4]) {
+  const double tol [4] = {2e-3, 1e-2, 1e-4, 1e-6};
+  NoaaOut      o, r;
+  double       e [4];
+  int          k, i, q;
+  bool         ok;
+  for (q = 0 ; q < 4 ; q++) emax [q] = 0;
+  for (k = 0 ; k < nseg ; k++) {
+    for (i = 0 ; i <= 10 * CHEB_SEG ; i++) {
+      o.jday = r.jday = CHEB_JD0 + k * CHEB_SEG + i * 0.1;
+      noaa_chebeval (tab [k], i / (5.0 * CHEB_SEG) - 1, &o);
+      noaa_sun (&r);
+      e [0] = fabs (o.decl_deg     - r.decl_deg);
+      e [1] = fabs (o.eqoftime_min - r.eqoftime_min);
+      e [2] = fabs (o.truelong_deg - r.truelong_deg);
+      e [3] = fabs (o.radvect_au   - r.radvect_au);
+      for (q = 0 ; q < 4 ; q++) if ((e [q] > emax [q]) || (e [q] != e [q])) emax [q] = e [q];
+      }
+    }
+  ok = true;
+  for (q = 0 ; q < 4 ; q++) if (! (emax [q] <= tol [q])) ok = false;
+  return (ok);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_cheb
+*
+* DESCRIPTION   Slowly varying solar terms from the Chebyshev ephemeris.
+*
+* ARGUMENTS     o   Results, jday set on entry
+*
+* GLOBALS       -
+*
+* RETURNS       True if jday is within the ephemeris, else nothing is set
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         A fast stand-in for noaa_sun () in noaa_day (); the
+*               ephemeris error is checked by -check. Built without it
+*               under NOAA_NOCHEB, as needed to generate the first one.
+*
+\**************************************************************************/
+
+bool noaa_cheb (NoaaOut *o) {
+#ifdef NOAA_NOCHEB
+  return (false);
+#else
+  double s;
+  int    k;
+  s = (o -> jday - CHEB_JD0) / CHEB_SEG;
+  k = (int) floor (s);
+  if ((s < 0) || (k >= (int) (sizeof (cheb_tab) / sizeof (cheb_tab [0])))) return (false);
+  noaa_chebeval (cheb_tab [k], 2 * (s - k) - 1, o);
+  return (true);
+#endif
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      refraction
+*
+* DESCRIPTION   Atmospheric refraction of the NOAA solar equations.
+*
+* ARGUMENTS     elev_deg   Geometric Sun elevation
+*
+* GLOBALS       -
+*
+* RETURNS       Refraction [Degrees]
+*
+* HISTORY       2026 10 15   JPT   Split out of noaa_eq ()
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+double refraction (double elev_deg) {
+  double r, t;
+  if (elev_deg > 85) r = 0;
+  else {
+    t = tan (d2r (elev_deg));
+    if (elev_deg > 5) r = 58.1 / t - 0.07 / pow (t, 3) + 0.000086 / pow (t, 5);
+    else {
+      if (elev_deg > -0.575) r = 1735 + elev_deg * (-518.2 + elev_deg * (103.4 + elev_deg * (-12.79 + elev_deg * 0.711)));
+      else                   r = -20.772 / t;
+      }
+    }
+  return (r / 3600);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_eq
+*
+* DESCRIPTION   NOAA solar euations.
+*
+* ARGUMENTS     in   Location, date, wall-clock time and timezone
+*
+* GLOBALS       -
+*
+* RETURNS       All intermediate and final results of the equations
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Reentrant, no globals read or written
+*
+* NOTES         Safe to call from several threads at once. This is the
+*               reference for the faster two-stage noaa_day () and
+*               noaa_min ().
+*
+\**************************************************************************/
+
+NoaaOut noaa_eq (const NoaaIn *in) {
+  NoaaOut o;
+  double  lat_deg  = in -> lat_deg,
+          long_deg = in -> long_deg;
+  o.jday = in -> date_d + 2415018.5 + in -> wtime_day - in -> timezone_hr / 24;
+  noaa_sun (&o);
+  o.ha_rise_deg  = r2d (acos (cos (d2r (90.833)) / (cos (d2r (lat_deg)) * cos (d2r (o.decl_deg))) - tan (d2r (lat_deg)) * tan (d2r (o.decl_deg))));
+  o.noon_lst     = (720 - 4 * long_deg  - o.eqoftime_min + in -> timezone_hr * 60) / 1440;
+  o.rise_lst     = o.noon_lst - o.ha_rise_deg * 4 / 1440;
+  o.set_lst      = o.noon_lst + o.ha_rise_deg * 4 / 1440;
+  o.lightdur_min = 8 * o.ha_rise_deg;
+  o.soltime_min  = fmod ((in -> wtime_day * 1440 + o.eqoftime_min + 4 * long_deg - 60 * in -> timezone_hr), 1440.0);
+  o.hrangle_deg  = (o.soltime_min / 4 < 0) ? (o.soltime_min / 4 + 180) : (o.soltime_min / 4 - 180);
+  o.zangle_deg   = r2d (acos (sin (d2r (lat_deg)) * sin (d2r (o.decl_deg)) + cos (d2r (lat_deg)) * cos (d2r (o.decl_deg)) * cos (d2r (o.hrangle_deg))));
+  o.elev_deg     = 90 - o.zangle_deg;
+  o.refract_deg  = refraction (o.elev_deg);
+  o.elevc_deg    = o.elev_deg + o.refract_deg;
+  if (o.hrangle_deg > 0)
+    o.az_deg = fmod ((r2d (acos (((sin (d2r (lat_deg)) * cos (d2r (o.zangle_deg))) - sin (d2r (o.decl_deg))) / (cos (d2r (lat_deg)) * sin (d2r (o.zangle_deg))))) + 180), 360.0);
+  else
+    o.az_deg = fmod ((540 - r2d (acos (((sin (d2r (lat_deg)) * cos (d2r (o.zangle_deg))) - sin (d2r (o.decl_deg))) / (cos (d2r (lat_deg)) * sin (d2r (o.zangle_deg)))))), 360.0);
+  return (o);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_day
+*
+* DESCRIPTION   Per-day stage of the NOAA solar equations.
+*
+* ARGUMENTS     in    Location, date and timezone (wall-clock time unused)
+*               day   Per-day terms to fill
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Chebyshev ephemeris
+*
+* NOTES         The date-dependent series are evaluated only at the start
+*               and the end of the day; noaa_min () interpolates them
+*               linearly. Over one day the error of that is below 0.001
+*               degrees in declination and 0.002 minutes in the equation
+*               of time. The series come from the Chebyshev ephemeris
+*               within its years.
+*
+\**************************************************************************/
+
+void noaa_day (const NoaaIn *in, NoaaDay *day) {
+  NoaaOut o;
+  int     k;
+  day -> lat_deg     = in -> lat_deg;
+  day -> long_deg    = in -> long_deg;
+  day -> date_d      = in -> date_d;
+  day -> timezone_hr = in -> timezone_hr;
+  day -> sinlat      = sin (d2r (in -> lat_deg));
+  day -> coslat      = cos (d2r (in -> lat_deg));
+  for (k = 0 ; k < 2 ; k++) {
+    o.jday = in -> date_d + 2415018.5 + k - in -> timezone_hr / 24;
+    if (! noaa_cheb (&o)) noaa_sun (&o);
+    day -> decl_deg     [k] = o.decl_deg;
+    day -> eqoftime_min [k] = o.eqoftime_min;
+    day -> truelong_deg [k] = o.truelong_deg;
+    }
+  if (day -> truelong_deg [1] < day -> truelong_deg [0] - 180) day -> truelong_deg [1] += 360;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_min
+*
+* DESCRIPTION   Per-minute stage of the NOAA solar equations.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day ()
+*               wtime_day   Wall-clock time [Fraction of a day]
+*
+* GLOBALS       -
+*
+* RETURNS       Solar time, hour angle, elevation, refraction and azimuth
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Only the hour angle, zenith, refraction and azimuth are
+*               evaluated here: five or six libm calls against about forty
+*               in noaa_eq ().
+*
+\**************************************************************************/
+
+NoaaMin noaa_min (const NoaaDay *day, double wtime_day) {
+  NoaaMin m;
+  double  sindecl, cosdecl, cosz, sinz, a;
+  m.decl_deg     = day -> decl_deg     [0] + wtime_day * (day -> decl_deg     [1] - day -> decl_deg     [0]);
+  m.eqoftime_min = day -> eqoftime_min [0] + wtime_day * (day -> eqoftime_min [1] - day -> eqoftime_min [0]);
+  m.truelong_deg = day -> truelong_deg [0] + wtime_day * (day -> truelong_deg [1] - day -> truelong_deg [0]);
+  if (m.truelong_deg >= 360) m.truelong_deg -= 360;
+  m.soltime_min  = fmod ((wtime_day * 1440 + m.eqoftime_min + 4 * day -> long_deg - 60 * day -> timezone_hr), 1440.0);
+  m.hrangle_deg  = (m.soltime_min / 4 < 0) ? (m.soltime_min / 4 + 180) : (m.soltime_min / 4 - 180);
+  sindecl = sin (d2r (m.decl_deg));
+  cosdecl = cos (d2r (m.decl_deg));
+  cosz    = day -> sinlat * sindecl + day -> coslat * cosdecl * cos (d2r (m.hrangle_deg));
+  if (cosz >  1) cosz =  1;
+  if (cosz < -1) cosz = -1;
+  sinz    = sqrt (1 - cosz * cosz);
+  m.zangle_deg  = r2d (acos (cosz));
+  m.elev_deg    = 90 - m.zangle_deg;
+  m.refract_deg = refraction (m.elev_deg);
+  m.elevc_deg   = m.elev_deg + m.refract_deg;
+  a = (day -> sinlat * cosz - sindecl) / (day -> coslat * sinz);
+  if (a >  1) a =  1;
+  if (a < -1) a = -1;
+  if (m.hrangle_deg > 0) m.az_deg = fmod (r2d (acos (a)) + 180, 360.0);
+  else                   m.az_deg = fmod (540 - r2d (acos (a)), 360.0);
+  return (m);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_batch_scalar
+*
+* DESCRIPTION   Batch evaluation of the per-minute stage, scalar version.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day ()
+*               wtime_day   Wall-clock times [Fraction of a day]
+*               n           Number of wall-clock times
+*               cols        Output columns, n entries each
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void noaa_batch_scalar (const NoaaDay *day, const double *wtime_day, int n, NoaaCols *cols) {
+  NoaaMin m;
+  int     i;
+  for (i = 0 ; i < n ; i++) {
+    m = noaa_min (day, wtime_day [i]);
+    cols -> solarmin [i] = m.soltime_min;
+    cols -> elev     [i] = m.elev_deg;
+    cols -> elevc    [i] = m.elevc_deg;
+    cols -> azim     [i] = m.az_deg;
+    cols -> sunlong  [i] = m.truelong_deg;
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_batchf_scalar
+*
+* DESCRIPTION   Batch evaluation of the per-minute stage in single
+*               precision, scalar version.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day ()
+*               wtime_day   Wall-clock times [Fraction of a day]
+*               n           Number of wall-clock times
+*               cols        Output columns, n entries each
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         noaa_min () in float, for the float tier without AVX2,
+*               with the zenith and azimuth formulas of noaa_batchf_avx2 ().
+*
+\**************************************************************************/
+
+void noaa_batchf_scalar (const NoaaDay *day, const double *wtime_day, int n, NoaaCols *cols) {
+  const float d2 = (float) (dpi / 360.0), r2 = (float) (360.0 / dpi);
+  float       dd, de, dt, k, sp, cp, sl, cl, w, decl, tl, st, hr, sd, cd, s, c, hv, hc, el, t, rf, az;
+  int         i;
+  dd = (float) (day -> decl_deg     [1] - day -> decl_deg     [0]);
+  de = (float) (day -> eqoftime_min [1] - day -> eqoftime_min [0]);
+  dt = (float) (day -> truelong_deg [1] - day -> truelong_deg [0]);
+  k  = (float) (day -> eqoftime_min [0] + 4 * day -> long_deg - 60 * day -> timezone_hr);
+  sp = (float) sin (d2r (day -> lat_deg) / 2);
+  cp = (float) cos (d2r (day -> lat_deg) / 2);
+  sl = (float) day -> sinlat;
+  cl = (float) day -> coslat;
+  for (i = 0 ; i < n ; i++) {
+    w    = (float) wtime_day [i];
+    decl = (float) day -> decl_deg [0] + w * dd;
+    tl   = (float) day -> truelong_deg [0] + w * dt;
+    if (tl >= 360) tl -= 360;
+    st   = fmodf (w * 1440 + w * de + k, 1440.0f);
+    hr   = (st < 0) ? (st / 4 + 180) : (st / 4 - 180);
+    sd   = sinf (d2 * decl);
+    cd   = cosf (d2 * decl);
+    s    = sinf (d2 / 2 * decl);
+    c    = cosf (d2 / 2 * decl);
+    hv   = (sp * c - cp * s) * (sp * c - cp * s);
+    hc   = (sp * c + cp * s) * (sp * c + cp * s);
+    s    = sinf (d2 / 2 * hr);
+    c    = cosf (d2 / 2 * hr);
+    hv  += cl * cd * s * s;
+    hc  += cl * cd * c * c;
+    el   = 90 - 2 * r2 * atan2f (sqrtf (hv), sqrtf (hc));
+    if (el > 85) rf = 0;
+    else {
+      t = tanf (d2 * el);
+      if      (el > 5)      rf = 58.1f / t - 0.07f / (t * t * t) + 0.000086f / (t * t * t * t * t);
+      else if (el > -0.575) rf = 1735 + el * (-518.2f + el * (103.4f + el * (-12.79f + el * 0.711f)));
+      else                  rf = -20.772f / t;
+      }
+    az = r2 * atan2f (sinf (d2 * hr) * cd, cosf (d2 * hr) * cd * sl - sd * cl) + 180;
+    if (az >= 360) az -= 360;
+    cols -> solarmin [i] = st;
+    cols -> elev     [i] = el;
+    cols -> elevc    [i] = el + rf / 3600;
+    cols -> azim     [i] = az;
+    cols -> sunlong  [i] = tl;
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_batch_exact
+*
+* DESCRIPTION   Batch evaluation with the full series at every time.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day (), location, date
+*                           and timezone used
+*               wtime_day   Wall-clock times [Fraction of a day]
+*               n           Number of wall-clock times
+*               cols        Output columns, n entries each
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         No linear interpolation of the date-dependent terms over
+*               the day and no Chebyshev ephemeris: noaa_sun () for each
+*               time, then the guarded geometry of noaa_min (). The
+*               reference of -accuracy, about forty libm calls a time.
+*
+\**************************************************************************/
+
+void noaa_batch_exact (const NoaaDay *day, const double *wtime_day, int n, NoaaCols *cols) {
+  NoaaDay d;
+  NoaaOut o;
+  NoaaMin m;
+  int     i;
+  d = *day;
+  for (i = 0 ; i < n ; i++) {
+    o.jday = day -> date_d + 2415018.5 + wtime_day [i] - day -> timezone_hr / 24;
+    noaa_sun (&o);
+    d.decl_deg     [0] = d.decl_deg     [1] = o.decl_deg;
+    d.eqoftime_min [0] = d.eqoftime_min [1] = o.eqoftime_min;
+    d.truelong_deg [0] = d.truelong_deg [1] = o.truelong_deg;
+    m = noaa_min (&d, wtime_day [i]);
+    cols -> solarmin [i] = m.soltime_min;
+    cols -> elev     [i] = m.elev_deg;
+    cols -> elevc    [i] = m.elevc_deg;
+    cols -> azim     [i] = m.az_deg;
+    cols -> sunlong  [i] = m.truelong_deg;
+    }
+  }
+
+
+
+#ifdef NOAA_SIMD
+
+/**************************************************************************\
+*
+* FUNCTION      v_set, v_poly
+*
+* DESCRIPTION   AVX2 helpers: broadcast of a constant, polynomial by the
+*               Horner scheme.
+*
+* ARGUMENTS     d   Constant
+*               x   Polynomial variable
+*               c   Coefficients, highest order first
+*               n   Number of coefficients
+*
+* GLOBALS       -
+*
+* RETURNS       Four lanes of the result
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+NOAA_AVX2 static inline __m256d v_set (double d) {return (_mm256_set1_pd (d));}
+
+NOAA_AVX2 static inline __m256d v_poly (__m256d x, const double *c, int n) {
+  __m256d y = v_set (c [0]);
+  int     i;
+  for (i = 1 ; i < n ; i++) y = _mm256_fmadd_pd (y, x, v_set (c [i]));
+  return (y);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      v_sincos
+*
+* DESCRIPTION   AVX2 sine and cosine.
+*
+* ARGUMENTS     x   Angles [Radians]
+*               s   Sines
+*               c   Cosines
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Reduction to +-pi/4 by a three-part pi/2 and the Cephes
+*               polynomials. Within 1 ulp of libm for |x| < 1e5.
+*
+\**************************************************************************/
+
+NOAA_AVX2 static inline void v_sincos (__m256d x, __m256d *s, __m256d *c) {
+  static const double sc [6] = { 1.58962301576546568060E-10, -2.50507477628578072866E-8,  2.75573136213857245213E-6,
+                                -1.98412698295895385996E-4,   8.33333333332211858878E-3, -1.66666666666666307295E-1};
+  static const double cc [6] = {-1.13585365213876817300E-11,  2.08757008419747316778E-9, -2.75573141792967388112E-7,
+                                 2.48015872888517045348E-5,  -1.38888888888730564116E-3,  4.16666666666665929218E-2};
+  __m256d q, r, z, ps, pc, m, t, sw;
+  q  = _mm256_round_pd (_mm256_mul_pd (x, v_set (0.63661977236758134308)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  r  = _mm256_fnmadd_pd (q, v_set (1.57079632673412561417e+00), x);
+  r  = _mm256_fnmadd_pd (q, v_set (6.07710050630396597660e-11), r);
+  r  = _mm256_fnmadd_pd (q, v_set (2.02226624879595063154e-21), r);
+  z  = _mm256_mul_pd (r, r);
+  ps = _mm256_fmadd_pd (_mm256_mul_pd (r, z), v_poly (z, sc, 6), r);
+  pc = _mm256_fmadd_pd (_mm256_mul_pd (z, z), v_poly (z, cc, 6), _mm256_fnmadd_pd (v_set (0.5), z, v_set (1.0)));
+
+  // Quadrant m = q mod 4: odd quadrants swap sine and cosine, quadrants 2, 3 negate the sine, 1, 2 the cosine
+
+  m  = _mm256_sub_pd (q, _mm256_mul_pd (v_set (4.0), _mm256_floor_pd (_mm256_mul_pd (q, v_set (0.25)))));
+  sw = _mm256_cmp_pd (_mm256_sub_pd (m, _mm256_mul_pd (v_set (2.0), _mm256_floor_pd (_mm256_mul_pd (m, v_set (0.5))))), v_set (0.5), _CMP_GT_OQ);
+  t  = ps;
+  ps = _mm256_blendv_pd (ps, pc, sw);
+  pc = _mm256_blendv_pd (pc, t,  sw);
+  *s = _mm256_xor_pd (ps, _mm256_and_pd (_mm256_cmp_pd (m, v_set (1.5), _CMP_GT_OQ), v_set (-0.0)));
+  *c = _mm256_xor_pd (pc, _mm256_and_pd (_mm256_and_pd (_mm256_cmp_pd (m, v_set (0.5), _CMP_GT_OQ),
+                                                        _mm256_cmp_pd (m, v_set (2.5), _CMP_LT_OQ)), v_set (-0.0)));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      v_atan, v_atan2, v_acos
+*
+* DESCRIPTION   AVX2 arc tangent, two-argument arc tangent, arc cosine.
+*
+* ARGUMENTS     x   Arguments
+*               y   Ordinates for v_atan2 ()
+*
+* GLOBALS       -
+*
+* RETURNS       Four lanes of the result [Radians]
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Cephes rational approximation with the argument reduced
+*               at tan (3 pi / 8) and 0.66. Within 2 ulp of libm.
+*               v_acos () is v_atan2 (sqrt (1 - x * x), x), so that it
+*               stays accurate close to +-1.
+*
+\**************************************************************************/
+
+NOAA_AVX2 static inline __m256d v_atan (__m256d x) {
+  static const double p [5] = {-8.750608600031904122785E-1, -1.615753718733365076637E1,  -7.500855792314704667340E1,
+                               -1.228866684490136173410E2,  -6.485021904942025371773E1};
+  static const double q [6] = { 1.0,                         2.485846490142306297962E1,   1.650270098316988542046E2,
+                                4.328810604912902668951E2,   4.853903996359136964868E2,   1.945506571482613964425E2};
+  __m256d sg, t, big, mid, y0, xr, z;
+  sg  = _mm256_and_pd (x, v_set (-0.0));
+  t   = _mm256_andnot_pd (v_set (-0.0), x);
+  big = _mm256_cmp_pd (t, v_set (2.41421356237309504880), _CMP_GT_OQ);
+  mid = _mm256_andnot_pd (big, _mm256_cmp_pd (t, v_set (0.66), _CMP_GT_OQ));
+  xr  = _mm256_blendv_pd (t,  _mm256_div_pd (_mm256_sub_pd (t, v_set (1.0)), _mm256_add_pd (t, v_set (1.0))), mid);
+  xr  = _mm256_blendv_pd (xr, _mm256_div_pd (v_set (-1.0), t), big);
+  y0  = _mm256_blendv_pd (v_set (0.0), v_set (0.78539816339744830962 + 0.5 * 6.123233995736765886130E-17), mid);
+  y0  = _mm256_blendv_pd (y0,          v_set (1.57079632679489661923 +       6.123233995736765886130E-17), big);
+  z   = _mm256_mul_pd (xr, xr);
+  z   = _mm256_div_pd (_mm256_mul_pd (z, v_poly (z, p, 5)), v_poly (z, q, 6));
+  t   = _mm256_add_pd (y0, _mm256_fmadd_pd (xr, z, xr));
+  return (_mm256_xor_pd (t, sg));
+  }
+
+NOAA_AVX2 static inline __m256d v_atan2 (__m256d y, __m256d x) {
+  __m256d a;
+  a = v_atan (_mm256_div_pd (y, x));
+  return (_mm256_blendv_pd (a, _mm256_add_pd (a, _mm256_or_pd (v_set (3.14159265358979323846), _mm256_and_pd (y, v_set (-0.0)))), x));
+  }
+
+NOAA_AVX2 static inline __m256d v_acos (__m256d x) {
+  return (v_atan2 (_mm256_sqrt_pd (_mm256_mul_pd (_mm256_sub_pd (v_set (1.0), x), _mm256_add_pd (v_set (1.0), x))), x));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_batch_avx2
+*
+* DESCRIPTION   Batch evaluation of the per-minute stage, four wall-clock
+*               times per AVX2 register.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day ()
+*               wtime_day   Wall-clock times [Fraction of a day]
+*               n           Number of wall-clock times
+*               cols        Output columns, n entries each
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Same equations as noaa_min (), with the refraction ladder
+*               and the azimuth half selected by blends instead of
+*               branches. A tail of fewer than four times is left to
+*               noaa_batch_scalar ().
+*
+\**************************************************************************/
+
+NOAA_AVX2 void noaa_batch_avx2 (const NoaaDay *day, const double *wtime_day, int n, NoaaCols *cols) {
+  static const double rp [5] = {0.711, -12.79, 103.4, -518.2, 1735};
+  const double        d2 = dpi / 360.0, r2 = 360.0 / dpi;
+  __m256d             w, decl, eqt, tl, st, hr, sd, cd, sh, ch, cz, sz, el, s, c, it, rf, a, az;
+  NoaaCols            tail;
+  int                 i;
+  for (i = 0 ; i + 4 <= n ; i += 4) {
+    w    = _mm256_loadu_pd (wtime_day + i);
+    decl = _mm256_fmadd_pd (w, v_set (day -> decl_deg     [1] - day -> decl_deg     [0]), v_set (day -> decl_deg     [0]));
+    eqt  = _mm256_fmadd_pd (w, v_set (day -> eqoftime_min [1] - day -> eqoftime_min [0]), v_set (day -> eqoftime_min [0]));
+    tl   = _mm256_fmadd_pd (w, v_set (day -> truelong_deg [1] - day -> truelong_deg [0]), v_set (day -> truelong_deg [0]));
+    tl   = _mm256_sub_pd (tl, _mm256_and_pd (_mm256_cmp_pd (tl, v_set (360.0), _CMP_GE_OQ), v_set (360.0)));
+
+    // Solar time and hour angle
+
+    st = _mm256_add_pd (_mm256_fmadd_pd (w, v_set (1440.0), eqt), v_set (4 * day -> long_deg - 60 * day -> timezone_hr));
+    st = _mm256_fnmadd_pd (v_set (1440.0), _mm256_round_pd (_mm256_div_pd (st, v_set (1440.0)), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), st);
+    hr = _mm256_mul_pd (st, v_set (0.25));
+    hr = _mm256_add_pd (hr, _mm256_blendv_pd (v_set (-180.0), v_set (180.0), hr));
+
+    // Zenith and elevation
+
+    v_sincos (_mm256_mul_pd (decl, v_set (d2)), &sd, &cd);
+    v_sincos (_mm256_mul_pd (hr,   v_set (d2)), &sh, &ch);
+    cz = _mm256_fmadd_pd (v_set (day -> sinlat), sd, _mm256_mul_pd (_mm256_mul_pd (v_set (day -> coslat), cd), ch));
+    cz = _mm256_max_pd (_mm256_min_pd (cz, v_set (1.0)), v_set (-1.0));
+    sz = _mm256_sqrt_pd (_mm256_mul_pd (_mm256_sub_pd (v_set (1.0), cz), _mm256_add_pd (v_set (1.0), cz)));
+    el = _mm256_sub_pd (v_set (90.0), _mm256_mul_pd (v_acos (cz), v_set (r2)));
+
+    // Refraction, all three branches evaluated and blended
+
+    v_sincos (_mm256_mul_pd (el, v_set (d2)), &s, &c);
+    it = _mm256_div_pd (c, s);
+    a  = _mm256_mul_pd (it, it);
+    rf = _mm256_mul_pd (v_set (-20.772), it);
+    rf = _mm256_blendv_pd (rf, v_poly (el, rp, 5), _mm256_cmp_pd (el, v_set (-0.575), _CMP_GT_OQ));
+    rf = _mm256_blendv_pd (rf, _mm256_mul_pd (it, _mm256_fmadd_pd (a, _mm256_fmadd_pd (a, v_set (0.000086), v_set (-0.07)), v_set (58.1))),
+                           _mm256_cmp_pd (el, v_set (5.0), _CMP_GT_OQ));
+    rf = _mm256_andnot_pd (_mm256_cmp_pd (el, v_set (85.0), _CMP_GT_OQ), rf);
+
+    // Azimuth, morning and afternoon halves blended
+
+    a  = _mm256_div_pd (_mm256_fmsub_pd (v_set (day -> sinlat), cz, sd), _mm256_mul_pd (v_set (day -> coslat), sz));
+    a  = _mm256_mul_pd (v_acos (_mm256_max_pd (_mm256_min_pd (a, v_set (1.0)), v_set (-1.0))), v_set (r2));
+    az = _mm256_blendv_pd (_mm256_add_pd (a, v_set (180.0)), _mm256_sub_pd (v_set (180.0), a), _mm256_cmp_pd (hr, v_set (0.0), _CMP_LE_OQ));
+    az = _mm256_sub_pd (az, _mm256_and_pd (_mm256_cmp_pd (az, v_set (360.0), _CMP_GE_OQ), v_set (360.0)));
+
+    _mm_storeu_ps (cols -> solarmin + i, _mm256_cvtpd_ps (st));
+    _mm_storeu_ps (cols -> elev     + i, _mm256_cvtpd_ps (el));
+    _mm_storeu_ps (cols -> elevc    + i, _mm256_cvtpd_ps (_mm256_fmadd_pd (rf, v_set (1.0 / 3600), el)));
+    _mm_storeu_ps (cols -> azim     + i, _mm256_cvtpd_ps (az));
+    _mm_storeu_ps (cols -> sunlong  + i, _mm256_cvtpd_ps (tl));
+    }
+  if (i < n) {
+    tail.solarmin = cols -> solarmin + i;
+    tail.elev     = cols -> elev     + i;
+    tail.elevc    = cols -> elevc    + i;
+    tail.azim     = cols -> azim     + i;
+    tail.sunlong  = cols -> sunlong  + i;
+    noaa_batch_scalar (day, wtime_day + i, n - i, &tail);
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      f_set, f_poly, f_sincos
+*
+* DESCRIPTION   AVX2 single precision helpers: broadcast of a constant,
+*               polynomial by the Horner scheme, sine and cosine.
+*
+* ARGUMENTS     d   Constant
+*               x   Polynomial variable, angles [Radians]
+*               c   Coefficients, highest order first
+*               n   Number of coefficients
+*               s   Sines
+*               co  Cosines
+*
+* GLOBALS       -
+*
+* RETURNS       Eight lanes of the result
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Cephes sinf and cosf: reduction to +-pi/4 by a three-part
+*               pi/2, within 2 ulp for |x| < 8192.
+*
+\**************************************************************************/
+
+NOAA_AVX2 static inline __m256 f_set (float d) {return (_mm256_set1_ps (d));}
+
+NOAA_AVX2 static inline __m256 f_poly (__m256 x, const float *c, int n) {
+  __m256 y = f_set (c [0]);
+  int    i;
+  for (i = 1 ; i < n ; i++) y = _mm256_fmadd_ps (y, x, f_set (c [i]));
+  return (y);
+  }
+
+NOAA_AVX2 static inline void f_sincos (__m256 x, __m256 *s, __m256 *co) {
+  static const float sc [3] = {-1.9515295891E-4f,  8.3321608736E-3f, -1.6666654611E-1f};
+  static const float cc [3] = { 2.443315711809948E-5f, -1.388731625493765E-3f, 4.166664568298827E-2f};
+  __m256  r, z, ps, pc, t, sw;
+  __m256i q, m;
+  q  = _mm256_cvtps_epi32 (_mm256_mul_ps (x, f_set (0.63661977236758134308f)));
+  r  = _mm256_cvtepi32_ps (q);
+  t  = _mm256_fnmadd_ps (r, f_set (1.5703125f), x);
+  t  = _mm256_fnmadd_ps (r, f_set (4.837512969970703125e-4f), t);
+  t  = _mm256_fnmadd_ps (r, f_set (7.54978995489188216e-8f), t);
+  z  = _mm256_mul_ps (t, t);
+  ps = _mm256_fmadd_ps (_mm256_mul_ps (t, z), f_poly (z, sc, 3), t);
+  pc = _mm256_fmadd_ps (_mm256_mul_ps (z, z), f_poly (z, cc, 3), _mm256_fnmadd_ps (f_set (0.5f), z, f_set (1.0f)));
+
+  // Quadrant q mod 4, as for v_sincos ()
+
+  m  = _mm256_and_si256 (q, _mm256_set1_epi32 (3));
+  sw = _mm256_castsi256_ps (_mm256_cmpeq_epi32 (_mm256_and_si256 (m, _mm256_set1_epi32 (1)), _mm256_set1_epi32 (1)));
+  t  = ps;
+  ps = _mm256_blendv_ps (ps, pc, sw);
+  pc = _mm256_blendv_ps (pc, t,  sw);
+  *s  = _mm256_xor_ps (ps, _mm256_castsi256_ps (_mm256_slli_epi32 (_mm256_srli_epi32 (m, 1), 31)));
+  *co = _mm256_xor_ps (pc, _mm256_castsi256_ps (_mm256_slli_epi32 (_mm256_xor_si256 (_mm256_srli_epi32 (m, 1), _mm256_and_si256 (m, _mm256_set1_epi32 (1))), 31)));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      f_atan, f_atan2, f_acos
+*
+* DESCRIPTION   AVX2 single precision arc tangent, two-argument arc
+*               tangent, arc cosine.
+*
+* ARGUMENTS     x   Arguments
+*               y   Ordinates for f_atan2 ()
+*
+* GLOBALS       -
+*
+* RETURNS       Eight lanes of the result [Radians]
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Cephes atanf, argument reduced at tan (3 pi / 8) and
+*               tan (pi / 8). f_acos () as v_acos ().
+*
+\**************************************************************************/
+
+NOAA_AVX2 static inline __m256 f_atan (__m256 x) {
+  static const float p [4] = {8.05374449538e-2f, -1.38776856032E-1f, 1.99777106478E-1f, -3.33329491539E-1f};
+  __m256 sg, t, big, mid, y0, xr, z;
+  sg  = _mm256_and_ps (x, f_set (-0.0f));
+  t   = _mm256_andnot_ps (f_set (-0.0f), x);
+  big = _mm256_cmp_ps (t, f_set (2.414213562373095f), _CMP_GT_OQ);
+  mid = _mm256_andnot_ps (big, _mm256_cmp_ps (t, f_set (0.4142135623730950f), _CMP_GT_OQ));
+  xr  = _mm256_blendv_ps (t,  _mm256_div_ps (_mm256_sub_ps (t, f_set (1.0f)), _mm256_add_ps (t, f_set (1.0f))), mid);
+  xr  = _mm256_blendv_ps (xr, _mm256_div_ps (f_set (-1.0f), t), big);
+  y0  = _mm256_blendv_ps (f_set (0.0f), f_set (0.78539816339744830962f), mid);
+  y0  = _mm256_blendv_ps (y0,           f_set (1.57079632679489661923f), big);
+  z   = _mm256_mul_ps (xr, xr);
+  t   = _mm256_add_ps (y0, _mm256_fmadd_ps (_mm256_mul_ps (f_poly (z, p, 4), z), xr, xr));
+  return (_mm256_xor_ps (t, sg));
+  }
+
+NOAA_AVX2 static inline __m256 f_atan2 (__m256 y, __m256 x) {
+  __m256 a;
+  a = f_atan (_mm256_div_ps (y, x));
+  return (_mm256_blendv_ps (a, _mm256_add_ps (a, _mm256_or_ps (f_set (3.14159265358979323846f), _mm256_and_ps (y, f_set (-0.0f)))), x));
+  }
+
+NOAA_AVX2 static inline __m256 f_acos (__m256 x) {
+  return (f_atan2 (_mm256_sqrt_ps (_mm256_mul_ps (_mm256_sub_ps (f_set (1.0f), x), _mm256_add_ps (f_set (1.0f), x))), x));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_batchf_avx2
+*
+* DESCRIPTION   Batch evaluation of the per-minute stage in single
+*               precision, eight wall-clock times per AVX2 register.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day ()
+*               wtime_day   Wall-clock times [Fraction of a day]
+*               n           Number of wall-clock times
+*               cols        Output columns, n entries each
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         noaa_batch_avx2 () in float, with the per-day constants
+*               folded in double first. The zenith angle comes from the
+*               haversine formula, with 1 - haversine as a sum of squares
+*               too, and the azimuth from atan2, since the cosine forms
+*               lose all accuracy in float within a degree of the zenith,
+*               the nadir and the poles. A tail of fewer
+*               than eight times is left to noaa_batchf_scalar ().
+*
+\**************************************************************************/
+
+NOAA_AVX2 void noaa_batchf_avx2 (const NoaaDay *day, const double *wtime_day, int n, NoaaCols *cols) {
+  static const float rp [5] = {0.711f, -12.79f, 103.4f, -518.2f, 1735.0f};
+  const float        d2 = (float) (dpi / 360.0), r2 = (float) (360.0 / dpi);
+  const float        sp = (float) sin (d2r (day -> lat_deg) / 2), cp = (float) cos (d2r (day -> lat_deg) / 2);
+  __m256             w, decl, eqt, tl, st, hr, sd, cd, sh, ch, hv, hc, s, c, s2, el, it, rf, a, az;
+  NoaaCols           tail;
+  int                i;
+  for (i = 0 ; i + 8 <= n ; i += 8) {
+    w    = _mm256_set_m128 (_mm256_cvtpd_ps (_mm256_loadu_pd (wtime_day + i + 4)), _mm256_cvtpd_ps (_mm256_loadu_pd (wtime_day + i)));
+    decl = _mm256_fmadd_ps (w, f_set ((float) (day -> decl_deg     [1] - day -> decl_deg     [0])), f_set ((float) day -> decl_deg [0]));
+    eqt  = _mm256_mul_ps   (w, f_set ((float) (day -> eqoftime_min [1] - day -> eqoftime_min [0])));
+    tl   = _mm256_fmadd_ps (w, f_set ((float) (day -> truelong_deg [1] - day -> truelong_deg [0])), f_set ((float) day -> truelong_deg [0]));
+    tl   = _mm256_sub_ps (tl, _mm256_and_ps (_mm256_cmp_ps (tl, f_set (360.0f), _CMP_GE_OQ), f_set (360.0f)));
+
+    // Solar time and hour angle
+
+    st = _mm256_add_ps (_mm256_fmadd_ps (w, f_set (1440.0f), eqt), f_set ((float) (day -> eqoftime_min [0] + 4 * day -> long_deg - 60 * day -> timezone_hr)));
+    st = _mm256_fnmadd_ps (f_set (1440.0f), _mm256_round_ps (_mm256_mul_ps (st, f_set (1.0f / 1440)), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), st);
+    hr = _mm256_mul_ps (st, f_set (0.25f));
+    hr = _mm256_add_ps (hr, _mm256_blendv_ps (f_set (-180.0f), f_set (180.0f), hr));
+
+    // Zenith and elevation by the haversine formula
+
+    f_sincos (_mm256_mul_ps (decl, f_set (d2 / 2)), &s, &c);
+    sd = _mm256_mul_ps (f_set (2.0f), _mm256_mul_ps (s, c));
+    cd = _mm256_fnmadd_ps (f_set (2.0f), _mm256_mul_ps (s, s), f_set (1.0f));
+    hv = _mm256_fmsub_ps (f_set (sp), c, _mm256_mul_ps (f_set (cp), s));   // sin ((lat - decl) / 2)
+    hc = _mm256_fmadd_ps (f_set (sp), c, _mm256_mul_ps (f_set (cp), s));   // sin ((lat + decl) / 2)
+    hv = _mm256_mul_ps (hv, hv);
+    hc = _mm256_mul_ps (hc, hc);
+    f_sincos (_mm256_mul_ps (hr, f_set (d2 / 2)), &s, &c);
+    sh = _mm256_mul_ps (f_set (2.0f), _mm256_mul_ps (s, c));
+    ch = _mm256_fnmadd_ps (f_set (2.0f), _mm256_mul_ps (s, s), f_set (1.0f));
+    s2 = _mm256_mul_ps (f_set ((float) day -> coslat), cd);
+    hv = _mm256_fmadd_ps (s2, _mm256_mul_ps (s, s), hv);                     // Haversine of the zenith angle
+    hc = _mm256_fmadd_ps (s2, _mm256_mul_ps (c, c), hc);                     // and 1 - it
+    el = _mm256_sub_ps (f_set (90.0f), _mm256_mul_ps (f_atan2 (_mm256_sqrt_ps (hv), _mm256_sqrt_ps (hc)), f_set (2 * r2)));
+
+    // Refraction, all three branches evaluated and blended
+
+    f_sincos (_mm256_mul_ps (el, f_set (d2)), &s, &c);
+    it = _mm256_div_ps (c, s);
+    a  = _mm256_mul_ps (it, it);
+    rf = _mm256_mul_ps (f_set (-20.772f), it);
+    rf = _mm256_blendv_ps (rf, f_poly (el, rp, 5), _mm256_cmp_ps (el, f_set (-0.575f), _CMP_GT_OQ));
+    rf = _mm256_blendv_ps (rf, _mm256_mul_ps (it, _mm256_fmadd_ps (a, _mm256_fmadd_ps (a, f_set (0.000086f), f_set (-0.07f)), f_set (58.1f))),
+                           _mm256_cmp_ps (el, f_set (5.0f), _CMP_GT_OQ));
+    rf = _mm256_andnot_ps (_mm256_cmp_ps (el, f_set (85.0f), _CMP_GT_OQ), rf);
+
+    // Azimuth by the two-argument arc tangent
+
+    a  = _mm256_fmsub_ps (_mm256_mul_ps (ch, cd), f_set ((float) day -> sinlat), _mm256_mul_ps (sd, f_set ((float) day -> coslat)));
+    az = _mm256_fmadd_ps (f_atan2 (_mm256_mul_ps (sh, cd), a), f_set (r2), f_set (180.0f));
+    az = _mm256_sub_ps (az, _mm256_and_ps (_mm256_cmp_ps (az, f_set (360.0f), _CMP_GE_OQ), f_set (360.0f)));
+
+    _mm256_storeu_ps (cols -> solarmin + i, st);
+    _mm256_storeu_ps (cols -> elev     + i, el);
+    _mm256_storeu_ps (cols -> elevc    + i, _mm256_fmadd_ps (rf, f_set (1.0f / 3600), el));
+    _mm256_storeu_ps (cols -> azim     + i, az);
+    _mm256_storeu_ps (cols -> sunlong  + i, tl);
+    }
+  if (i < n) {
+    tail.solarmin = cols -> solarmin + i;
+    tail.elev     = cols -> elev     + i;
+    tail.elevc    = cols -> elevc    + i;
+    tail.azim     = cols -> azim     + i;
+    tail.sunlong  = cols -> sunlong  + i;
+    noaa_batchf_scalar (day, wtime_day + i, n - i, &tail);
+    }
+  }
+
+#endif
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      cpu_avx2
+*
+* DESCRIPTION   Run-time check for the AVX2 batch kernel.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       -
+*
+* RETURNS       True if the kernel is compiled in and the CPU and the
+*               operating system support AVX2 and FMA
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+bool cpu_avx2 (void) {
+#if defined (NOAA_SIMD) && defined (__GNUC__)
+  __builtin_cpu_init ();
+  return (__builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma"));
+#elif defined (NOAA_SIMD) && defined (_MSC_VER)
+  int r [4];
+  __cpuid (r, 1);
+  if (((r [2] & (1 << 12)) == 0) || ((r [2] & (1 << 27)) == 0) || ((r [2] & (1 << 28)) == 0)) return (false);
+  if ((_xgetbv (0) & 6) != 6) return (false);
+  __cpuidex (r, 7, 0);
+  return ((r [1] & (1 << 5)) != 0);
+#else
+  return (false);
+#endif
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_batch
+*
+* DESCRIPTION   Batch evaluation of the per-minute stage.
+*
+* ARGUMENTS     day         Per-day terms from noaa_day ()
+*               wtime_day   Wall-clock times [Fraction of a day]
+*               n           Number of wall-clock times
+*               cols        Output columns, n entries each
+*
+* GLOBALS       use_avx2    Batch evaluation by the AVX2 kernel
+*               precision   Precision tier
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Precision tiers
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void noaa_batch (const NoaaDay *day, const double *wtime_day, int n, NoaaCols *cols) {
+  PERF (PS_BATCH);
+  if (precision == PREC_EXACT) {noaa_batch_exact (day, wtime_day, n, cols); return;}
+#ifdef NOAA_SIMD
+  if (use_avx2 && (precision == PREC_FLOAT)) {noaa_batchf_avx2 (day, wtime_day, n, cols); return;}
+  if (use_avx2)                               {noaa_batch_avx2 (day, wtime_day, n, cols); return;}
+#endif
+  if (precision == PREC_FLOAT) noaa_batchf_scalar (day, wtime_day, n, cols);
+  else                         noaa_batch_scalar (day, wtime_day, n, cols);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabinterp
+*
+* DESCRIPTION   Sub-minute value from a per-minute table.
+*
+* ARGUMENTS     col   Per-minute table, 1440 entries
+*               x     Wall-clock time [Minutes of day]
+*               per   Period of the values, 0 if not periodic
+*
+* GLOBALS       -
+*
+* RETURNS       Value at x
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Cubic Hermite with central difference tangents (Catmull-
+*               Rom) over the four surrounding entries, extended
+*               quadratically past the ends of the table. Periodic
+*               neighbours are unwrapped to the nearest period first.
+*               Against noaa_min () at the same time, see -check, the
+*               error is below 1e-4 deg in elevation and Sun longitude,
+*               2e-3 deg in azimuth and 1e-3 min in solar time while the
+*               Sun is within 80 deg of the horizon. Nearer the zenith or nadir
+*               the elevation has a cusp and the azimuth turns fast, and
+*               the error grows to some 0.03 deg and degrees. Corrected
+*               elevation is to be taken as refraction () of the
+*               interpolated elevation, since the refraction model has
+*               kinks that no interpolation follows.
+*
+\**************************************************************************/
+
+float tabinterp (const float *col, double x, float per) {
+  float pm, p0, p1, p2, p3, m1, m2, u, u2, u3, r;
+  int   i;
+  i = (int) floor (x);
+  if (i < 0)    i = 0;
+  if (i > 1439) i = 1439;
+  u  = x - i;
+  p1 = col [i];
+  p3 = 0;
+  if (i > 0)    p0 = col [i - 1];
+  if (i < 1439) p2 = col [i + 1];
+  if (i < 1438) p3 = col [i + 2];
+  if (per > 0) {
+    if (i > 0)    p0 += per * floor ((p1 - p0) / per + 0.5);
+    if (i < 1439) p2 += per * floor ((p1 - p2) / per + 0.5);
+    if (i < 1438) p3 += per * floor ((p2 - p3) / per + 0.5);
+    }
+  if (i == 0)    p0 = 3 * (p1 - p2) + p3;
+  if (i == 1439) {
+    pm = col [i - 2];
+    if (per > 0) pm += per * floor ((p0 - pm) / per + 0.5);
+    p2 = 3 * (p1 - p0) + pm;
+    }
+  if (i >= 1438) p3 = 3 * (p2 - p1) + p0;
+  m1 = 0.5f * (p2 - p0);
+  m2 = 0.5f * (p3 - p1);
+  u2 = u * u;
+  u3 = u2 * u;
+  r  = (2 * u3 - 3 * u2 + 1) * p1 + (u3 - 2 * u2 + u) * m1 + (-2 * u3 + 3 * u2) * p2 + (u3 - u2) * m2;
+  if (per > 0) {
+    if ((r < 0) && (p1 >= 0)) r += per;
+    if (r >= per)             r -= per;
+    }
+  return (r);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      brent
+*
+* DESCRIPTION   Brent's root finder on a bracketing interval.
+*
+* ARGUMENTS     fn    Function, called with x and ctx
+*               ctx   Function context
+*               a     Interval start
+*               b     Interval end
+*               fa    fn (a)
+*               fb    fn (b), of opposite sign to fa
+*               tol   Tolerance in x
+*
+* GLOBALS       -
+*
+* RETURNS       Root
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Inverse quadratic interpolation with bisection fallback,
+*               after Brent (1973). Converges in well under ten calls on
+*               the smooth elevation curve.
+*
+\**************************************************************************/
+
+double brent (double (*fn) (double x, void *ctx), void *ctx, double a, double b, double fa, double fb, double tol) {
+  double c, fc, d, e, p, q, r, s, m, tol1;
+  int    it;
+  c  = b;
+  fc = fb;
+  d  = e = b - a;
+  for (it = 0 ; it < 100 ; it++) {
+    if (((fb > 0) && (fc > 0)) || ((fb < 0) && (fc < 0))) {
+      c  = a;
+      fc = fa;
+      d  = e = b - a;
+      }
+    if (fabs (fc) < fabs (fb)) {
+      a = b;  b = c;  c = a;
+      fa = fb; fb = fc; fc = fa;
+      }
+    tol1 = 2 * DBL_EPSILON * fabs (b) + 0.5 * tol;
+    m    = 0.5 * (c - b);
+    if ((fabs (m) <= tol1) || (fb == 0)) return (b);
+    if ((fabs (e) >= tol1) && (fabs (fa) > fabs (fb))) {
+      s = fb / fa;
+      if (a == c) {
+        p = 2 * m * s;
+        q = 1 - s;
+        }
+      else {
+        q = fa / fc;
+        r = fb / fc;
+        p = s * (2 * m * q * (q - r) - (b - a) * (r - 1));
+        q = (q - 1) * (r - 1) * (s - 1);
+        }
+      if (p > 0) q = -q;
+      else       p = -p;
+      if (2 * p < fmin (3 * m * q - fabs (tol1 * q), fabs (e * q))) {
+        e = d;
+        d = p / q;
+        }
+      else d = e = m;
+      }
+    else d = e = m;
+    a  = b;
+    fa = fb;
+    b += (fabs (d) > tol1) ? d : ((m > 0) ? tol1 : -tol1);
+    fb = fn (b, ctx);
+    }
+  return (b);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      elevfn
+*
+* DESCRIPTION   Event solver function: Sun elevation above a threshold.
+*
+* ARGUMENTS     w     Wall-clock time [Fraction of day]
+*               ctx   EventFn context
+*
+* GLOBALS       -
+*
+* RETURNS       Elevation minus threshold [Degrees]
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Geometric elevation, no refraction.
+*
+\**************************************************************************/
+
+double elevfn (double w, void *ctx) {
+  EventFn *ef = (EventFn *) ctx;
+  return (noaa_min (ef -> day, w).elev_deg - ef -> h);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      noaa_events
+*
+* DESCRIPTION   Solar noon, solar midnight and the crossings of the
+*               elevation thresholds for one day.
+*
+* ARGUMENTS     day        Per-day terms from noaa_day ()
+*               user_deg   User-defined elevation threshold
+*               ev         Events
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Thresholds 0, -0.833 (sunrise and sunset, geometric
+*               elevation of the centre with standard refraction and
+*               semidiameter), -6, -12, -18 and user_deg.
+*               Noon is where the hour angle is zero, found by fixed point
+*               iteration on the equation of time. Elevation rises from
+*               the solar midnight before noon to noon and falls to the
+*               one after, so each of the halves brackets at most one
+*               crossing, solved by brent () to about 10 ms. A threshold
+*               above the noon elevation or below both midnights is a
+*               polar case and has no crossings instead of the NaN from
+*               acos () of the hour angle formula in noaa_eq ().
+*               Crossings near a midnight may fall just outside 0...1.
+*
+\**************************************************************************/
+
+void noaa_events (const NoaaDay *day, double user_deg, SunEvents *ev) {
+  static const double th [NTHRESH - 1] = {0.0, -0.833, -6.0, -12.0, -18.0};
+  EventFn ef;
+  double  w, m0, m1, en, e0, e1;
+  int     i, k;
+  w = 0.5;
+  for (k = 0 ; k < 3 ; k++)
+    w = (720 - noaa_min (day, w).eqoftime_min - 4 * day -> long_deg + 60 * day -> timezone_hr) / 1440.0;
+  m0 = w - 0.5;
+  m1 = w + 0.5;
+  en = noaa_min (day, w).elev_deg;
+  e0 = noaa_min (day, m0).elev_deg;
+  e1 = noaa_min (day, m1).elev_deg;
+  ev -> noon_day         = w;
+  ev -> noonelev_deg     = en;
+  ev -> midnight_day     = (m0 >= 0) ? m0 : m1;
+  ev -> midnightelev_deg = (m0 >= 0) ? e0 : e1;
+  ef.day = day;
+  for (i = 0 ; i < NTHRESH ; i++) {
+    ef.h = (i < NTHRESH - 1) ? th [i] : user_deg;
+    ev -> thresh_deg [i] = ef.h;
+    ev -> rise_day   [i] = NAN;
+    ev -> set_day    [i] = NAN;
+    ev -> polar      [i] = 0;
+    if (en < ef.h) {
+      ev -> polar [i] = -1;
+      continue;
+      }
+    if (e0 < ef.h) ev -> rise_day [i] = brent (elevfn, &ef, m0, w, e0 - ef.h, en - ef.h, 1e-7);
+    if (e1 < ef.h) ev -> set_day  [i] = brent (elevfn, &ef, w, m1, en - ef.h, e1 - ef.h, 1e-7);
+    if ((e0 >= ef.h) && (e1 >= ef.h)) ev -> polar [i] = 1;
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      load
+*
+* DESCRIPTION   Saving NOAA equation results into per-minute tables.
+*
+* ARGUMENTS     in   Location, date and timezone (wall-clock time unused)
+*               dt   Per-minute tables to fill
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Reentrant, tables passed in
+*               2026 10 15   JPT   Two-stage evaluation
+*               2026 10 15   JPT   Batch evaluation
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void load (const NoaaIn *in, DayTab *dt) {
+  NoaaDay  day;
+  NoaaCols cols;
+  double   w [1440];
+  int      i;
+  PERF (PS_LOAD);
+  noaa_day (in, &day);
+  for (i = 0 ; i < 1440 ; i++) w [i] = (double) i / 1440.0;
+  cols.solarmin = dt -> solarmin;
+  cols.elev     = dt -> elev;
+  cols.elevc    = dt -> elevc;
+  cols.azim     = dt -> azim;
+  cols.sunlong  = dt -> sunlong;
+  noaa_batch (&day, w, 1440, &cols);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      parwork
+*
+* DESCRIPTION   Work-stealing pool thread.
+*
+* ARGUMENTS     rg     Ranges of all pool threads
+*               nthr   Pool threads
+*               me     Index of this thread
+*               fn     Job function, called with a job index and ctx
+*               ctx    Job context
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         A range is one 64-bit atomic, next index low, end high.
+*               The owner takes from the low end, a thief takes the upper
+*               half of a victim's range, both by compare and swap. A
+*               range is only stored over by its owner when empty, which
+*               thieves never touch, so no lock is needed. The thread
+*               returns when a pass over all ranges finds them empty.
+*
+\**************************************************************************/
+
+void parwork (StealRange *rg, int nthr, int me, void (*fn) (int i, void *ctx), void *ctx) {
+  unsigned long long v, nv;
+  unsigned int       lo, hi, mid;
+  int                k, vi;
+  bool               stolen;
+  for (;;) {
+    v  = rg [me].r.load ();
+    lo = (unsigned int) v;
+    hi = (unsigned int) (v >> 32);
+    if (lo < hi) {
+      nv = ((unsigned long long) hi << 32) | (lo + 1);
+      if (rg [me].r.compare_exchange_weak (v, nv)) fn (lo, ctx);
+      continue;
+      }
+    stolen = false;
+    for (k = 1 ; (k < nthr) && (! stolen) ; k++) {
+      vi = (me + k) % nthr;
+      v  = rg [vi].r.load ();
+      lo = (unsigned int) v;
+      hi = (unsigned int) (v >> 32);
+      while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        nv  = ((unsigned long long) mid << 32) | lo;
+        if (rg [vi].r.compare_exchange_weak (v, nv)) {
+          rg [me].r.store (((unsigned long long) hi << 32) | mid);
+          stolen = true;
+          break;
+          }
+        lo = (unsigned int) v;
+        hi = (unsigned int) (v >> 32);
+        }
+      }
+    if (! stolen) return;
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      parrun
+*
+* DESCRIPTION   Parallel execution of jobs 0...n-1 on a work-stealing pool.
+*
+* ARGUMENTS     n      Jobs
+*               nthr   Pool threads, 0 for the hardware concurrency
+*               fn     Job function, called with a job index and ctx
+*               ctx    Job context
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Returns when all jobs are done. Jobs are handed out in
+*               contiguous runs, so a job writing its own slot of a
+*               preallocated buffer gives output independent of nthr.
+*
+\**************************************************************************/
+
+void parrun (int n, int nthr, void (*fn) (int i, void *ctx), void *ctx) {
+  StealRange  *rg;
+  std :: thread *th;
+  int         k;
+  if (nthr <= 0) nthr = std :: thread :: hardware_concurrency ();
+  if (nthr <= 0) nthr = 1;
+  if (nthr > n)  nthr = (n > 0) ? n : 1;
+  rg = new StealRange [nthr];
+  for (k = 0 ; k < nthr ; k++)
+    rg [k].r = ((unsigned long long) ((long long) n * (k + 1) / nthr) << 32) | (unsigned int) ((long long) n * k / nthr);
+  th = new std :: thread [nthr];
+  for (k = 1 ; k < nthr ; k++) th [k] = std :: thread (parwork, rg, nthr, k, fn, ctx);
+  parwork (rg, nthr, 0, fn, ctx);
+  for (k = 1 ; k < nthr ; k++) th [k].join ();
+  delete [] th;
+  delete [] rg;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gentile
+*
+* DESCRIPTION   Generator job: one site and day.
+*
+* ARGUMENTS     i     Job index within the chunk
+*               ctx   Generator job context
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Writes the five columns of the tile to its own slot.
+*
+\**************************************************************************/
+
+void gentile (int i, void *ctx) {
+  GenJob   *job = (GenJob *) ctx;
+  NoaaIn   in;
+  NoaaDay  day;
+  NoaaCols c;
+  float    *o;
+  int      tile, s;
+  tile = job -> tile0 + i;
+  s    = tile / job -> nday;
+  o    = job -> out + (long long) i * 5 * job -> nsamp;
+  in.lat_deg     = job -> site [s].lat_deg;
+  in.long_deg    = job -> site [s].long_deg;
+  in.date_d      = job -> date0_d + tile % job -> nday;
+  in.wtime_day   = 0;
+  in.timezone_hr = job -> site [s].timezone_hr;
+  c.solarmin = o;
+  c.elev     = o + job -> nsamp;
+  c.elevc    = o + 2 * job -> nsamp;
+  c.azim     = o + 3 * job -> nsamp;
+  c.sunlong  = o + 4 * job -> nsamp;
+  noaa_day (&in, &day);
+  noaa_batch (&day, job -> w, job -> nsamp, &c);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      samekey
+*
+* DESCRIPTION   Comparison of day table keys.
+*
+* ARGUMENTS     a, b   Keys
+*
+* GLOBALS       -
+*
+* RETURNS       True if the keys are equal
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+bool samekey (const DayKey *a, const DayKey *b) {
+  return ((a -> date_d   == b -> date_d)   && (a -> lat_deg     == b -> lat_deg)     &&
+          (a -> long_deg == b -> long_deg) && (a -> timezone_hr == b -> timezone_hr) && (a -> dst == b -> dst));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      sunday
+*
+* DESCRIPTION   Date of a Sunday of a month.
+*
+* ARGUMENTS     y   Year
+*               m   Month
+*               k   1 for the first Sunday, 2 for the second, -1 for the last
+*
+* GLOBALS       -
+*
+* RETURNS       Date [Days since 1970 01 01]
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+long long sunday (int y, int m, int k) {
+  QDate d;
+  if (k > 0) {
+    d = QDate (y, m, 1);
+    d = d.addDays ((7 - d.dayOfWeek ()) % 7 + 7 * (k - 1));
+    }
+  else {
+    d = QDate (y + m / 12, m % 12 + 1, 1).addDays (-1);
+    d = d.addDays (-(d.dayOfWeek () % 7));
+    }
+  return (d.toJulianDay () - 2440588);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      dstzone
+*
+* DESCRIPTION   Daylight saving time transition table of a zone.
+*
+* ARGUMENTS     tz     Standard timezone [Hours]
+*               rule   Daylight saving time rule
+*
+* GLOBALS       -
+*
+* RETURNS       Transition table
+*
+* HISTORY       2026 10 15   JPT   Created, replaces setdst_eu ()
+*
+* NOTES         Built once per zone and kept, so that a lookup is a
+*               binary search with no date arithmetic. Thread-safe.
+*
+*               Current rules, also for past years:
+*               EU   last Sunday of March...last Sunday of October, 01 UTC
+*               US   second Sunday of March...first Sunday of November,
+*                    02 local time
+*               AU   first Sunday of October...first Sunday of April,
+*                    02 standard time
+*               NZ   last Sunday of September...first Sunday of April,
+*                    02 standard time
+*               Outside the tables, standard time.
+*
+\**************************************************************************/
+
+const DstZone *dstzone (double tz, int rule) {
+  static DstZone      *zones = NULL;
+  static std :: mutex mtx;
+  std :: lock_guard <std :: mutex> lock (mtx);
+  DstZone   *z;
+  long long on, off, lst;
+  int       y;
+  for (z = zones ; z ; z = z -> next) if ((z -> timezone_hr == tz) && (z -> rule == rule)) return (z);
+  z = new DstZone;
+  z -> timezone_hr = tz;
+  z -> rule        = rule;
+  z -> n           = 0;
+  lst = (long long) (3600 * tz);   // Standard time to UTC
+  for (y = DST_Y0 ; (y < DST_Y0 + DST_NY) && (rule != DST_NONE) ; y++) {
+    switch (rule) {
+      case DST_EU: on = 86400 * sunday (y,  3, -1) + 3600;       off = 86400 * sunday (y, 10, -1) + 3600;       break;
+      case DST_US: on = 86400 * sunday (y,  3,  2) + 7200 - lst; off = 86400 * sunday (y, 11,  1) + 3600 - lst; break;
+      case DST_AU: on = 86400 * sunday (y, 10,  1) + 7200 - lst; off = 86400 * sunday (y,  4,  1) + 7200 - lst; break;
+      default:     on = 86400 * sunday (y,  9, -1) + 7200 - lst; off = 86400 * sunday (y,  4,  1) + 7200 - lst; break;
+      }
+    if (on < off) {
+      z -> utc [z -> n] = on;  z -> off [z -> n++] = 1;
+      z -> utc [z -> n] = off; z -> off [z -> n++] = 0;
+      }
+    else {   // Southern hemisphere
+      z -> utc [z -> n] = off; z -> off [z -> n++] = 0;
+      z -> utc [z -> n] = on;  z -> off [z -> n++] = 1;
+      }
+    }
+  z -> next = zones;
+  zones     = z;
+  return (z);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      dstoff
+*
+* DESCRIPTION   Daylight saving time in effect at an instant.
+*
+* ARGUMENTS     z   Transition table, NULL for none
+*               t   Instant [Seconds since 1970 UTC]
+*
+* GLOBALS       -
+*
+* RETURNS       Offset in hours
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+int dstoff (const DstZone *z, long long t) {
+  int i;
+  if (z == NULL) return (0);
+  i = (int) (std :: upper_bound (z -> utc, z -> utc + z -> n, t) - z -> utc);
+  return (i ? z -> off [i - 1] : 0);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      dstnext
+*
+* DESCRIPTION   Next daylight saving time change after an instant.
+*
+* ARGUMENTS     z   Transition table, NULL for none
+*               t   Instant [Seconds since 1970 UTC]
+*
+* GLOBALS       -
+*
+* RETURNS       Instant of the change [Seconds since 1970 UTC], -1 if none
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+long long dstnext (const DstZone *z, long long t) {
+  const long long *e;
+  if (z == NULL) return (-1);
+  e = std :: upper_bound (z -> utc, z -> utc + z -> n, t);
+  return ((e < z -> utc + z -> n) ? *e : -1);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      dstparse
+*
+* DESCRIPTION   Daylight saving time rule by name.
+*
+* ARGUMENTS     s   Rule name: None, EU, US, AU or NZ, any case
+*
+* GLOBALS       -
+*
+* RETURNS       Rule, DST_NONE if unknown
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+int dstparse (const char *s) {
+  const char *name [DST_NR] = {"None", "EU", "US", "AU", "NZ"};
+  int        i;
+  for (i = 0 ; i < DST_NR ; i++) if (strcmpi (s, name [i]) == 0) return (i);
+  return (DST_NONE);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      utcnow
+*
+* DESCRIPTION   Current UTC date and time.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       clocknow       Fixed UTC clock
+*               my_timezone    Timezone of user's own location
+*               my_tz_given    my_timezone given on the command line
+*
+* RETURNS       UTC date and time
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Fixed clock
+*
+* NOTES         A valid clocknow is returned as such, which makes runs
+*               repeatable. With my_timezone given the system clock is
+*               taken to run in it; otherwise the clock's own UTC is used.
+*
+\**************************************************************************/
+
+QDateTime utcnow (void) {
+  if (clocknow.isValid ()) return (clocknow);
+  if (my_tz_given) return (QDateTime (QDate :: currentDate (), QTime :: currentTime (), Qt :: UTC).addSecs ((qint64) (-3600 * my_timezone)));
+  return (QDateTime :: currentDateTimeUtc ());
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      loctime
+*
+* DESCRIPTION   Date and time at the location, daylight saving time
+*               included.
+*
+* ARGUMENTS     utc   UTC date and time
+*               ld    Date
+*               lt    Time
+*               dst   Daylight saving time in effect [Hours]
+*
+* GLOBALS       timezone_std   Standard timezone of the location
+*               dstz           Daylight saving time transitions of the location
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Transition table lookup
+*
+* NOTES         Reads only globals that are fixed at start-up, so the
+*               precompute worker can call it too.
+*
+\**************************************************************************/
+
+void loctime (QDateTime utc, QDate *ld, QTime *lt, int *dst) {
+  *dst = dstoff (dstz, utc.toMSecsSinceEpoch () / 1000);
+  utc = utc.addSecs ((qint64) (3600 * timezone_std) + 3600 * *dst);
+  *ld = utc.date ();
+  *lt = utc.time ();
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      daykey
+*
+* DESCRIPTION   Day table key of the location at a given instant.
+*
+* ARGUMENTS     utc   UTC date and time
+*               key   Key
+*
+* GLOBALS       lat_deg        Latitude
+*               long_deg       Longitude
+*               timezone_std   Standard timezone of the location
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void daykey (QDateTime utc, DayKey *key) {
+  QDate ld;
+  QTime lt;
+  int   dst;
+  loctime (utc, &ld, &lt, &dst);
+  key -> date_d      = QDate (1900, 1, 1).daysTo (ld) + 2;
+  key -> lat_deg     = lat_deg;
+  key -> long_deg    = long_deg;
+  key -> timezone_hr = timezone_std + dst;
+  key -> dst         = dst;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabhash
+*
+* DESCRIPTION   FNV-1a hash of bytes.
+*
+* ARGUMENTS     p   Bytes
+*               n   Byte count
+*
+* GLOBALS       -
+*
+* RETURNS       Hash
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+unsigned int tabhash (const void *p, size_t n) {
+  const unsigned char *b = (const unsigned char *) p;
+  unsigned int        h  = 2166136261u;
+  while (n--) h = (h ^ *b++) * 16777619u;
+  return (h);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabdir
+*
+* DESCRIPTION   Day table cache directory, created if missing.
+*
+* ARGUMENTS     dir   Directory
+*               n     Size of dir
+*
+* GLOBALS       -
+*
+* RETURNS       True if the directory is available
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         $XDG_CACHE_HOME/noaa_clock, by default ~/.cache/noaa_clock;
+*               %LOCALAPPDATA%\noaa_clock on Windows.
+*
+\**************************************************************************/
+
+bool tabdir (char *dir, int n) {
+  struct stat st;
+  const char  *e;
+#ifdef _WIN32
+  if ((e = getenv ("LOCALAPPDATA")) == NULL) return (false);
+  snprintf (dir, n, "%s\\noaa_clock", e);
+  CreateDirectoryA (dir, NULL);
+#else
+  if ((e = getenv ("XDG_CACHE_HOME")) && (*e == '/')) snprintf (dir, n, "%s", e);
+  else if ((e = getenv ("HOME")) && *e)              snprintf (dir, n, "%s/.cache", e);
+  else return (false);
+  mkdir (dir, 0700);
+  strncat (dir, "/noaa_clock", n - strlen (dir) - 1);
+  mkdir (dir, 0700);
+#endif
+  return ((stat (dir, &st) == 0) && (st.st_mode & S_IFDIR));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabopen, tabclose
+*
+* DESCRIPTION   Read-write mapping of a day table cache file, unmapping.
+*
+* ARGUMENTS     path   File
+*               len    Required length [Bytes]
+*               m      Mapping to unmap
+*
+* GLOBALS       -
+*
+* RETURNS       tabopen (): mapping, NULL if missing or of another length
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+char *tabopen (const char *path, size_t len) {
+  struct stat st;
+  void        *m;
+  if ((stat (path, &st) != 0) || ((size_t) st.st_size != len)) return (NULL);
+  m = NULL;
+#ifdef _WIN32
+  HANDLE fh, mh;
+  fh = CreateFileA (path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (fh == INVALID_HANDLE_VALUE) return (NULL);
+  mh = CreateFileMappingA (fh, NULL, PAGE_READWRITE, 0, 0, NULL);
+  if (mh != NULL) {
+    m = MapViewOfFile (mh, FILE_MAP_WRITE, 0, 0, 0);
+    CloseHandle (mh);
+    }
+  CloseHandle (fh);
+#else
+  int fd;
+  if ((fd = open (path, O_RDWR)) < 0) return (NULL);
+  m = mmap (NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (m == MAP_FAILED) m = NULL;
+  close (fd);
+#endif
+  return ((char *) m);
+  }
+
+void tabclose (char *m, size_t len) {
+#ifdef _WIN32
+  UnmapViewOfFile (m);
+#else
+  munmap (m, len);
+#endif
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabmap
+*
+* DESCRIPTION   Day table cache file of a location, standard timezone and
+*               year.
+*
+* ARGUMENTS     key   Key of any day of the year
+*               doy   Day of the year - 1
+*
+* GLOBALS       precision   Precision tier
+*
+* RETURNS       Mapped cache header, NULL if no cache is available
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Precision tier
+*               2026 10 16   JPT   One file for standard and daylight saving time
+*
+* NOTES         To be called with tabmtx held. The file name comes from the
+*               location, standard timezone, year and precision tier, so
+*               the days with and without daylight saving time share one
+*               file; have [] tells which a day was computed with. A file whose
+*               header does not match them, the table layout, TABVER or
+*               its own hash is stale and rebuilt empty. A rebuild goes through a temporary
+*               file and a rename, so other clocks see either file whole.
+*               The last TABMAPS files stay mapped.
+*
+\**************************************************************************/
+
+TabHead *tabmap (const DayKey *key, int *doy) {
+  static TabHead *map [TABMAPS];
+  static int     next = 0;
+  TabHead        want, *h;
+  QDate          d;
+  char           dir [512], path [600], tmp [640];
+  size_t         len;
+  FILE           *f;
+  int            i;
+
+  // Wanted header
+
+  d = QDate (1899, 12, 30).addDays ((qint64) key -> date_d);
+  *doy = d.dayOfYear () - 1;
+  memset (&want, 0, sizeof (want));
+  memcpy (want.magic, "NOAATAB1", 8);
+  want.version     = TABVER;
+  want.recsize     = offsetof (DayTab, key);
+  want.ndays       = d.daysInYear ();
+  want.year        = d.year ();
+  want.prec        = precision;
+  want.lat_deg     = key -> lat_deg;
+  want.long_deg    = key -> long_deg;
+  want.timezone_hr = key -> timezone_hr - key -> dst;
+  want.hash        = tabhash (&want, offsetof (TabHead, hash));
+  len = sizeof (TabHead) + (size_t) want.ndays * want.recsize;
+
+  // Mapped already
+
+  for (i = 0 ; i < TABMAPS ; i++)
+    if (map [i] && (memcmp (map [i], &want, offsetof (TabHead, have)) == 0)) return (map [i]);
+
+  // Mapped now, rebuilt if stale
+
+  if (! tabdir (dir, sizeof (dir))) return (NULL);
+  snprintf (path, sizeof (path), "%s/%08x-%04d%c.tab", dir, tabhash (&want.lat_deg, 3 * sizeof (double)), want.year, "fdx" [precision]);
+  h = (TabHead *) tabopen (path, len);
+  if (h && ((memcmp (h, &want, offsetof (TabHead, have)) != 0) || (h -> hash != tabhash (h, offsetof (TabHead, hash))))) {
+    tabclose ((char *) h, len);
+    h = NULL;
+    }
+  if (h == NULL) {
+#ifdef _WIN32
+    snprintf (tmp, sizeof (tmp), "%s.%lu", path, (unsigned long) GetCurrentProcessId ());
+#else
+    snprintf (tmp, sizeof (tmp), "%s.%ld", path, (long) getpid ());
+#endif
+    f = fopen (tmp, "wb");
+    if (f == NULL) return (NULL);
+    fwrite (&want, sizeof (want), 1, f);
+    if ((fseek (f, (long) len - 1, SEEK_SET) != 0) || (fputc (0, f) == EOF) || (fclose (f) != 0)) {
+      remove (tmp);
+      return (NULL);
+      }
+#ifdef _WIN32
+    if (! MoveFileExA (tmp, path, MOVEFILE_REPLACE_EXISTING)) {
+#else
+    if (rename (tmp, path) != 0) {
+#endif
+      remove (tmp);
+      return (NULL);
+      }
+    if ((h = (TabHead *) tabopen (path, len)) == NULL) return (NULL);
+    }
+  if (map [next]) tabclose ((char *) map [next], sizeof (TabHead) + (size_t) map [next] -> ndays * map [next] -> recsize);
+  map [next] = h;
+  next = (next + 1) % TABMAPS;
+  return (h);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabget, tabput
+*
+* DESCRIPTION   Per-minute tables from the day table cache, into the cache.
+*
+* ARGUMENTS     key   Key
+*               dt    Per-minute tables, for tabget () NULL to only check
+*
+* GLOBALS       tabmtx   Mutex of the cache
+*
+* RETURNS       tabget (): true if the tables were cached
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Daylight saving time of the day checked
+*
+* NOTES         A day is marked present only after its tables, so another
+*               clock using the same file never reads a partial day. A day
+*               cached with the other daylight saving time, possible only
+*               on a transition day, is a miss and is not overwritten.
+*
+\**************************************************************************/
+
+bool tabget (const DayKey *key, DayTab *dt) {
+  std :: lock_guard <std :: mutex> lock (tabmtx);
+  TabHead *h;
+  int     doy;
+  if (((h = tabmap (key, &doy)) == NULL) || (h -> have [doy] != key -> dst + 1)) return (false);
+  if (dt == NULL) return (true);
+  std :: atomic_thread_fence (std :: memory_order_acquire);
+  memcpy (dt, (char *) (h + 1) + (size_t) doy * h -> recsize, h -> recsize);
+  dt -> key = *key;
+  return (true);
+  }
+
+void tabput (const DayKey *key, const DayTab *dt) {
+  std :: lock_guard <std :: mutex> lock (tabmtx);
+  TabHead *h;
+  int     doy;
+  if (((h = tabmap (key, &doy)) == NULL) || h -> have [doy]) return;
+  memcpy ((char *) (h + 1) + (size_t) doy * h -> recsize, dt, h -> recsize);
+  std :: atomic_thread_fence (std :: memory_order_release);
+  h -> have [doy] = (unsigned char) (key -> dst + 1);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      loadkey
+*
+* DESCRIPTION   Loading of the per-minute tables for a key.
+*
+* ARGUMENTS     key   Key
+*               dt    Per-minute tables to fill
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Day table cache
+*
+* NOTES         From the day table cache if there, else computed and
+*               added to it.
+*
+\**************************************************************************/
+
+void loadkey (const DayKey *key, DayTab *dt) {
+  NoaaIn in;
+  if (tabget (key, dt)) return;
+  in.lat_deg     = key -> lat_deg;
+  in.long_deg    = key -> long_deg;
+  in.date_d      = key -> date_d;
+  in.wtime_day   = 0;
+  in.timezone_hr = key -> timezone_hr;
+  load (&in, dt);
+  dt -> key = *key;
+  tabput (key, dt);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      getbuf, putbuf
+*
+* DESCRIPTION   Taking a free day table buffer, returning a buffer.
+*
+* ARGUMENTS     p   Buffer to return
+*
+* GLOBALS       spare   Free table buffers
+*
+* RETURNS       getbuf (): a buffer
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Lock-free, used by both the GUI thread and the precompute
+*               worker. The buffers are allocated at start-up; getbuf ()
+*               allocates only if they have all been taken.
+*
+\**************************************************************************/
+
+DayTab *getbuf (void) {
+  DayTab *p;
+  int    i;
+  for (i = 0 ; i < NSPARE ; i++)
+    if ((p = spare [i].exchange (NULL)) != NULL) return (p);
+  return (new DayTab);
+  }
+
+void putbuf (DayTab *p) {
+  DayTab *e;
+  int    i;
+  for (i = 0 ; i < NSPARE ; i++) {
+    e = NULL;
+    if (spare [i].compare_exchange_strong (e, p)) return;
+    }
+  delete p;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tabfill
+*
+* DESCRIPTION   Filling the day table cache of a year ahead of use.
+*
+* ARGUMENTS     utc   Any instant of the year, UTC
+*               max   Most days to compute
+*
+* GLOBALS       lat_deg        Latitude
+*               long_deg       Longitude
+*               timezone_std   Standard timezone of the location
+*               dstz           Daylight saving time transitions of the location
+*
+* RETURNS       True if days were left to compute
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Days after the current one first. Each day is keyed by
+*               its local noon, so that a day of a daylight saving time
+*               change gets the table of its afternoon; the other one is
+*               computed on first use.
+*
+\**************************************************************************/
+
+bool tabfill (QDateTime utc, int max) {
+  static DayTab dt;
+  DayKey        key;
+  QDate         ld, d;
+  QTime         lt;
+  int           dst, i, j, n;
+  loctime (utc, &ld, &lt, &dst);
+  n = ld.daysInYear ();
+  for (i = 0, j = ld.dayOfYear () - 1 ; i < n ; i++, j = (j + 1) % n) {
+    d = QDate (ld.year (), 1, 1).addDays (j);
+    daykey (QDateTime (d, QTime (12, 0), Qt :: UTC).addSecs ((qint64) (-3600 * timezone_std)), &key);
+    if (tabget (&key, NULL)) continue;
+    if (max-- == 0) return (true);
+    loadkey (&key, &dt);
+    }
+  return (false);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      prepwork
+*
+* DESCRIPTION   Precompute worker: keeps the tables of the next day and of
+*               the next daylight saving time change ready in prep, loads
+*               the current day when the GUI thread has missed it, and
+*               fills the day table cache of the year.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       prep       Precomputed tables
+*               prepgen    Bumped by the GUI thread after taking a table
+*               prepmiss   GUI thread without the tables of its key
+*               prepquit   Worker stop request
+*               prepmtx    Mutex of the worker's wait
+*               prepcv     Condition of the worker's wait
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Day table cache filled
+*               2026 10 16   JPT   Published tables no longer read
+*               2026 10 16   JPT   Current day loaded here, not by the GUI thread
+*
+* NOTES         The worker never blocks the GUI thread: tables change hands
+*               only by atomic pointer exchanges, and all ephemeris work
+*               and cache file locking is done here. A published table belongs
+*               to whichever thread takes it, so the worker compares with
+*               its own copy of the key it published, never with the
+*               table's. A wake-up lost between the check and the wait
+*               costs at most the one-minute timeout.
+*               The cache is filled TABFILL days per round, a round a
+*               second until the year is done.
+*
+\**************************************************************************/
+
+void prepwork (void) {
+  std :: unique_lock <std :: mutex> lock (prepmtx);
+  QDateTime now, u;
+  QDate     ld;
+  QTime     lt;
+  DayKey    want [3], have [3];
+  DayTab    *p;
+  long long t;
+  bool      more;
+  int       seen, dst0, i, n;
+  while (! prepquit) {
+    seen = prepgen;
+
+    // Current day, next day: the key just after the next local midnight
+
+    now = utcnow ();
+    daykey (now, &want [0]);
+    loctime (now, &ld, &lt, &dst0);
+    daykey (now.addSecs (86400 - lt.msecsSinceStartOfDay () / 1000 + 1), &want [1]);
+
+    // Next daylight saving time change
+
+    n = 0;
+    t = dstnext (dstz, now.toMSecsSinceEpoch () / 1000);
+    if (t >= 0) {daykey (now.addSecs (t - now.toMSecsSinceEpoch () / 1000), &want [2]); n = 1;}
+
+    for (i = 0 ; i < 3 ; i++) {
+      if ((i == 0) && (! prepmiss.exchange (false))) continue;
+      if ((i == 2) && (n == 0)) continue;
+      if ((prep [i].load () != NULL) && samekey (&have [i], &want [i])) continue;
+      p = getbuf ();
+      loadkey (&want [i], p);
+      have [i] = want [i];
+      if ((p = prep [i].exchange (p)) != NULL) putbuf (p);
+      }
+    more = tabfill (now, TABFILL);
+    prepcv.wait_for (lock, std :: chrono :: seconds (more ? 1 : 60), [&] {return (prepquit || (prepgen != seen));});
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      taketab
+*
+* DESCRIPTION   Switching the current tables to a new key.
+*
+* ARGUMENTS     key   Key
+*
+* GLOBALS       tab        Per-minute tables of the current day
+*               prep       Precomputed tables
+*               prepgen    Bumped here after taking a table or missing one
+*               prepmiss   Set here when missing one
+*               prepcv     Condition of the worker's wait
+*
+* RETURNS       true if the tables were taken, else tab is unchanged
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Never computed here
+*
+* NOTES         An exchange of pointers, no ephemeris work and no lock.
+*               The worker has the tables ready ahead of the key change;
+*               if not, at start-up or when it has fallen behind, it is
+*               asked for the current day and the caller tries again.
+*
+\**************************************************************************/
+
+bool taketab (const DayKey *key) {
+  DayTab *p, *q, *e;
+  int    i;
+  p = NULL;
+  for (i = 0 ; (i < 3) && (p == NULL) ; i++) {
+    q = prep [i].exchange (NULL);
+    if (q == NULL) continue;
+    if (samekey (&q -> key, key)) {p = q; continue;}
+    e = NULL;
+    if (! prep [i].compare_exchange_strong (e, q)) putbuf (q);
+    }
+  if (p == NULL) prepmiss = true;
+  prepgen++;
+  prepcv.notify_one ();
+  if (p == NULL) return (false);
+  if (tab) putbuf (tab);
+  tab = p;
+  return (true);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      nextwake
+*
+* DESCRIPTION   Time to the next visible change.
+*
+* ARGUMENTS     now    Current UTC date and time
+*               pxms   Time for the fastest display item to move one
+*                      pixel [Milliseconds], 0 if only minutes matter
+*
+* GLOBALS       tabstale   Tables of a past key kept
+*
+* RETURNS       Time [Milliseconds]
+*
+* HISTORY       2026 10 15   JPT   Split out of schedule ()
+*               2026 10 16   JPT   Retry while the tables are stale
+*
+* NOTES         The tables are per minute, so the day change and a
+*               daylight saving time change happen at a minute boundary,
+*               and without sub-minute interpolation so do the pointer and
+*               values. Stale tables are retried every 100 ms until the
+*               worker has the new ones.
+*
+\**************************************************************************/
+
+qint64 nextwake (QDateTime now, double pxms) {
+  qint64 ms;
+  ms = 60000 - now.toMSecsSinceEpoch () % 60000 + 5;   // Just past the boundary
+  if (pxms > 0) {
+    if (pxms < 250) pxms = 250;
+    if (pxms < ms)  ms = (qint64) pxms;
+    }
+  if (tabstale && (ms > 100)) ms = 100;
+  return (ms);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      schedule
+*
+* DESCRIPTION   Arms the display update timer for the next visible change.
+*
+* ARGUMENTS     now    Current UTC date and time
+*               pxms   Time for the fastest display item to move one
+*                      pixel [Milliseconds], 0 if only minutes matter
+*
+* GLOBALS       ticker   Single-shot display update timer
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Replaces the fixed 5 s timer
+*               2026 10 15   JPT   Pixel steps of the sub-minute mode
+*               2026 10 15   JPT   Time from nextwake ()
+*
+* NOTES         A far wake-up is approached with a coarse timer, which Qt
+*               may fire up to 5 % late, aimed to wake before it; the
+*               remainder is then a precise timer.
+*
+\**************************************************************************/
+
+void schedule (QDateTime now, double pxms) {
+  qint64 ms;
+  if (ticker == NULL) return;
+  ms = nextwake (now, pxms);
+  if (ms > 2000) {
+    ticker -> setTimerType (Qt :: CoarseTimer);
+    ticker -> start ((int) ((ms - 1000) / 1.05));
+    }
+  else {
+    ticker -> setTimerType (Qt :: PreciseTimer);
+    ticker -> start ((int) ms);
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tick
+*
+* DESCRIPTION   Current values of the display.
+*
+* ARGUMENTS     now    Current UTC date and time
+*               pxms   Time for the fastest display item to move one
+*                      pixel [Milliseconds], 0 if only minutes matter
+*
+* GLOBALS       d
+*               date_d
+*               t
+*               idx
+*               lat_deg
+*               long_deg
+*               timezone_hr
+*               dst_hr
+*               tab           Per-minute tables of the current day
+*               tabstale      Tables of a past key kept
+*               cf            Current time display circle fraction
+*               ce            Current elevation of Sun
+*               cec           Current corrected elevation of Sun
+*               caz           Current azimuth of Sun
+*               csl           Current longitude of Sun
+*
+* RETURNS       true if the tables changed and everything is to be redrawn
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Built on the reentrant noaa_eq ()
+*               2026 10 15   JPT   Tables reloaded only when their key changes
+*               2026 10 15   JPT   Tables precomputed by the worker
+*               2026 10 15   JPT   Sub-minute values interpolated
+*               2026 10 15   JPT   Split out of eloop () for headless rendering
+*               2026 10 16   JPT   Old tables kept until the worker has the new
+*
+* NOTES         The tables change at midnight, at a daylight saving time
+*               change and never otherwise, so a tick is normally just
+*               the index lookups. Without tables ready for the new key
+*               the old ones are used until a later tick finds them; only
+*               the first tick, with no tables at all, waits for the
+*               worker. With smooth the values are
+*               interpolated to the millisecond and the next wake-up is
+*               when the fastest item has moved a pixel.
+*
+\**************************************************************************/
+
+bool tick (QDateTime now, double *pxms) {
+  DayKey    key;
+  double    x, px, da;
+  int       idxw, i;
+  bool      all;
+  loctime (now, &d, &t, &dst_hr);
+  timezone_hr = timezone_std + dst_hr;
+  daykey (now, &key);
+  date_d = key.date_d;
+  all = false;
+  if (tab == NULL) {   // Start-up: wait for the worker
+    while (! taketab (&key)) {
+      std :: this_thread :: sleep_for (std :: chrono :: milliseconds (1));
+      daykey (utcnow (), &key);
+      }
+    all = true;
+    }
+  tabstale = false;
+  if (! samekey (&key, &tab -> key)) {
+    tabstale = ! taketab (&key);
+    all = ! tabstale;
+    }
+  idxw = 60 * t.hour () + t.minute ();
+  if (smooth) {
+    x   = idxw + t.second () / 60.0 + t.msec () / 60000.0;
+    idx = tabinterp (tab -> solarmin, x, 1440);
+    cf  = idx / 1440.0;
+    caz = tabinterp (tab -> azim,    x, 360);
+    ce  = tabinterp (tab -> elev,    x, 0);
+    cec = ce + refraction (ce);
+    csl = tabinterp (tab -> sunlong, x, 360);
+    i   = (idxw < 1439) ? idxw : 1438;
+    px  = dpi * 425 / 1440;                                               // Pointer tip
+    px  = fmax (px, 5 * fabs (tab -> elevc [i + 1] - tab -> elevc [i]));  // Elevation marker
+    da  = fabs (tab -> azim [i + 1] - tab -> azim [i]);
+    if (da > 180) da = 360 - da;
+    px  = fmax (px, d2r (da) * 200);                                      // Azimuth needle tip
+    *pxms = 60000 / px;
+    }
+  else {
+    idx = tab -> solarmin [idxw];
+    cf = idx / 1440.0;
+    caz = tab -> azim    [idxw];
+    ce  = tab -> elev    [idxw];
+    cec = tab -> elevc   [idxw];
+    csl = tab -> sunlong [idxw];
+    *pxms = 0;
+    }
+  return (all);
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        DispWidget :: eloop
+*
+* DESCRIPTION   Display update timer response method.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       dw            Display widget
+*
+* RETURNS       -
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Built on the reentrant noaa_eq ()
+*               2026 10 15   JPT   Tables reloaded only when their key changes
+*               2026 10 15   JPT   Tables precomputed by the worker
+*               2026 10 15   JPT   Only changed regions repainted
+*               2026 10 15   JPT   Next wake-up scheduled here
+*               2026 10 15   JPT   Sub-minute values interpolated
+*               2026 10 15   JPT   Timers
+*               2026 10 15   JPT   Values from tick ()
+*
+* NOTES         A new table repaints everything. The shown timer overlay
+*               is refreshed every second.
+*
+\**************************************************************************/
+
+void DispWidget :: eloop (void) {
+  QDateTime now;
+  double    pxms;
+  bool      all;
+  PERF (PS_ELOOP);
+  now = utcnow ();
+  all = tick (now, &pxms);
+  dw -> invalidate (all);
+#ifdef NOAA_PERF
+  if (perfshow) {
+    dw -> update (QRect (PERF_X, PERF_Y, PERF_W, PERF_H));
+    pxms = (pxms > 0) ? fmin (pxms, 1000) : 1000;
+    }
+  perftick ();
+#endif
+  schedule (now, pxms);
+  }
+
+
+
+#ifndef _WIN32
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      fbopen, fbclose
+*
+* DESCRIPTION   Mapping a headless framebuffer, unmapping it.
+*
+* ARGUMENTS     dst      shm:name of a POSIX shared memory object, a
+*                        /dev/fb* framebuffer device or a file
+*               w, h     Width and height [Pixels], the device's own for a
+*                        device
+*               stride   Line length [Bytes]
+*               fmt      FB_ARGB32 or FB_RGB565, the device's own for a
+*                        device
+*               hd       Header, NULL for a device
+*               px       Pixels: at FB_DATA, for a device at the visible
+*                        area
+*               len      Mapped length [Bytes]
+*               m        Mapping to unmap
+*
+* GLOBALS       -
+*
+* RETURNS       fbopen (): mapping, NULL on failure
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Panning offset and channel layout of a device
+*
+* NOTES         A device must be XRGB8888 or RGB565; BGR and other
+*               layouts are refused rather than drawn in wrong colours.
+*
+\**************************************************************************/
+
+char *fbopen (const char *dst, int *w, int *h, int *stride, int *fmt, FbHead **hd, char **px, size_t *len) {
+  char *m;
+  int  fd;
+  *hd = NULL;
+#ifdef __linux__
+  if (strncmp (dst, "/dev/fb", 7) == 0) {
+    struct fb_var_screeninfo vi;
+    struct fb_fix_screeninfo fi;
+    size_t off;
+    if ((fd = open (dst, O_RDWR)) < 0) return (NULL);
+    if ((ioctl (fd, FBIOGET_VSCREENINFO, &vi) < 0) || (ioctl (fd, FBIOGET_FSCREENINFO, &fi) < 0)) {
+      close (fd);
+      return (NULL);
+      }
+    if (! (((vi.bits_per_pixel == 32) && (vi.red.offset == 16) && (vi.green.offset == 8) && (vi.blue.offset == 0) &&
+            (vi.red.length == 8) && (vi.green.length == 8) && (vi.blue.length == 8)) ||
+           ((vi.bits_per_pixel == 16) && (vi.red.offset == 11) && (vi.green.offset == 5) && (vi.blue.offset == 0) &&
+            (vi.red.length == 5) && (vi.green.length == 6) && (vi.blue.length == 5)))) {
+      fprintf (stderr, "'%s' is %u bits per pixel, red at bit %u, green %u, blue %u, not XRGB8888 or RGB565.\n",
+               dst, vi.bits_per_pixel, vi.red.offset, vi.green.offset, vi.blue.offset);
+      close (fd);
+      return (NULL);
+      }
+    off = (size_t) vi.yoffset * fi.line_length + (size_t) vi.xoffset * vi.bits_per_pixel / 8;
+    if (off + (size_t) vi.yres * fi.line_length > fi.smem_len) {
+      close (fd);
+      return (NULL);
+      }
+    *w      = vi.xres;
+    *h      = vi.yres;
+    *stride = fi.line_length;
+    *fmt    = (vi.bits_per_pixel == 32) ? FB_ARGB32 : FB_RGB565;
+    *len    = fi.smem_len;
+    m = (char *) mmap (NULL, *len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close (fd);
+    if (m == MAP_FAILED) return (NULL);
+    *px = m + off;
+    return (m);
+    }
+#endif
+  if (strncmp (dst, "shm:", 4) == 0) fd = shm_open (dst + 4, O_RDWR | O_CREAT, 0644);
+  else                               fd = open (dst, O_RDWR | O_CREAT, 0644);
+  if (fd < 0) return (NULL);
+  *stride = (*w * ((*fmt == FB_RGB565) ? 2 : 4) + 3) & ~3;
+  *len    = FB_DATA + (size_t) *stride * *h;
+  if (ftruncate (fd, *len) != 0) {
+    close (fd);
+    return (NULL);
+    }
+  m = (char *) mmap (NULL, *len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  if (m == MAP_FAILED) return (NULL);
+  *hd = (FbHead *) m;
+  *px = m + FB_DATA;
+  memcpy ((*hd) -> magic, "NOAAFB1", 8);
+  (*hd) -> width  = *w;
+  (*hd) -> height = *h;
+  (*hd) -> stride = *stride;
+  (*hd) -> format = *fmt;
+  (*hd) -> seq    = 0;
+  (*hd) -> rx = (*hd) -> ry = (*hd) -> rw = (*hd) -> rh = 0;
+  return (m);
+  }
+
+void fbclose (char *m, size_t len) {
+  munmap (m, len);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      onstop
+*
+* DESCRIPTION   Signal handler, stop request.
+*
+* ARGUMENTS     sig   Signal, unused
+*
+* GLOBALS       quitreq   Stop request
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void onstop (int /* sig */) {
+  quitreq = 1;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      headless
+*
+* DESCRIPTION   Headless rendering into a framebuffer.
+*
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector
+*
+* GLOBALS       fbdst     Headless framebuffer
+*               fbfmt     Headless framebuffer format
+*               quitreq   Stop request
+*               dw        Display widget
+*               painter   Qt painter object
+*
+* RETURNS       Exit value
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Same format as the layers, no polling
+*               2026 10 16   JPT   Scaled to the framebuffer
+*
+* NOTES         The display is drawn straight into the mapped memory, a
+*               QImage over it made once, with the offscreen Qt platform
+*               and no window; only the changed region is drawn, as on
+*               the screen. The 1920 x 1080 layout is scaled to fit the
+*               framebuffer, whose size a device sets. ARGB32 is mapped as Format_RGB32, the same
+*               opaque pixels in the format of the layers, so the blits
+*               copy. A frame is bracketed by the odd and even seq
+*               of the header and its changes are in rx...rh, for e.g.
+*               a partial e-ink refresh. Stopped by SIGINT or SIGTERM;
+*               the shared memory object or file is left for readers.
+*               The signals are blocked but during the sleep of
+*               pselect (), so a stop request ends the sleep and the
+*               loop wakes only when the display changes.
+*
+\**************************************************************************/
+
+int headless (int argc, char *argv []) {
+  QDateTime       now;
+  QRegion         r;
+  QRect           b;
+  FbHead          *hd;
+  char            *m, *px;
+  size_t          len;
+  double          pxms;
+  qint64          ms;
+  int             w, h, stride, fmt;
+  bool            all;
+  sigset_t        stop, run;
+  struct timespec ts;
+  signal (SIGINT,  onstop);
+  signal (SIGTERM, onstop);
+  sigemptyset (&stop);
+  sigaddset (&stop, SIGINT);
+  sigaddset (&stop, SIGTERM);
+  pthread_sigmask (SIG_BLOCK, &stop, &run);   // Also for the threads started from here on
+  if (! qEnvironmentVariableIsSet ("QT_QPA_PLATFORM")) qputenv ("QT_QPA_PLATFORM", "offscreen");
+  QApplication app (argc, argv);
+  w   = 1920;
+  h   = 1080;
+  fmt = fbfmt;
+  if ((m = fbopen (fbdst, &w, &h, &stride, &fmt, &hd, &px, &len)) == NULL) {
+    printf ("Cannot map '%s'.\n", fbdst);
+    return (1);
+    }
+  dw = new DispWidget ();
+  dw -> imgdata  = (unsigned char *) px;
+  dw -> img      = new QImage (dw -> imgdata, w, h, stride, (fmt == FB_RGB565) ? QImage :: Format_RGB16 : QImage :: Format_RGB32);
+  dw -> layerfmt = (fmt == FB_RGB565) ? QImage :: Format_RGB16 : QImage :: Format_RGB32;
+  dw -> sc       = fmin (w / 1920.0, h / 1080.0);
+  dw -> resize (w, h);
+  painter = new QPainter ();
+  std :: thread worker (prepwork);
+  while (! quitreq) {
+    PERF (PS_ELOOP);
+    now = utcnow ();
+    all = tick (now, &pxms);
+    r   = dw -> dirty (all);
+    if (! r.isEmpty ()) {
+      if (hd) hd -> seq++;
+      dw -> draw (dw -> img, r);
+      if (hd) {
+        b = r.boundingRect ();
+        hd -> rx = b.x ();
+        hd -> ry = b.y ();
+        hd -> rw = b.width ();
+        hd -> rh = b.height ();
+        hd -> seq++;
+        }
+      }
+#ifdef NOAA_PERF
+    perftick ();
+#endif
+    ms = nextwake (now, pxms);
+    if ((ms > 0) && (! quitreq)) {
+      ts.tv_sec  = ms / 1000;
+      ts.tv_nsec = (ms % 1000) * 1000000;
+      pselect (0, NULL, NULL, NULL, &ts, &run);
+      }
+    }
+  prepquit = true;
+  prepcv.notify_one ();
+  worker.join ();
+  pthread_sigmask (SIG_SETMASK, &run, NULL);
+  delete painter;
+  delete dw -> img;
+  delete dw;
+  fbclose (m, len);
+  return (0);
+  }
+
+#endif
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      toutf8
+*
+* DESCRIPTION   Name to UTF-8.
+*
+* ARGUMENTS     in    Name, UTF-8 or Latin-1
+*               out   UTF-8 name
+*               n     Size of out
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         A name that is not valid UTF-8 is taken as Latin-1, the
+*               encoding of noaa_clock.cnf and of this file.
+*
+\**************************************************************************/
+
+void toutf8 (const char *in, char *out, int n) {
+  const unsigned char *p;
+  bool                utf8;
+  int                 i, k;
+  utf8 = true;
+  for (p = (const unsigned char *) in ; *p && utf8 ; p++) {
+    if      (*p < 0x80)           k = 0;
+    else if ((*p & 0xe0) == 0xc0) k = 1;
+    else if ((*p & 0xf0) == 0xe0) k = 2;
+    else if ((*p & 0xf8) == 0xf0) k = 3;
+    else                          utf8 = false;
+    for (i = 1 ; utf8 && (i <= k) ; i++) if ((p [i] & 0xc0) != 0x80) utf8 = false;
+    if (utf8) p += k;
+    }
+  i = 0;
+  for (p = (const unsigned char *) in ; *p && (i < n - 2) ; p++) {
+    if (utf8 || (*p < 0x80)) out [i++] = *p;
+    else {
+      out [i++] = 0xc0 | (*p >> 6);
+      out [i++] = 0x80 | (*p & 0x3f);
+      }
+    }
+  out [i] = 0;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazkey
+*
+* DESCRIPTION   Gazetteer key of a name.
+*
+* ARGUMENTS     name   Name, UTF-8 or Latin-1
+*               key    Key, case-folded UTF-8
+*               n      Size of key
+*
+* GLOBALS       -
+*
+* RETURNS       FNV-1a hash of the key
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Folds A-Z and the Latin-1 capitals U+00C0...U+00DE, i.e.
+*               the letters of the names in use, not full Unicode.
+*
+\**************************************************************************/
+
+unsigned int gazkey (const char *name, char *key, int n) {
+  unsigned char *p;
+  unsigned int  h;
+  toutf8 (name, key, n);
+  h = 2166136261u;
+  for (p = (unsigned char *) key ; *p ; p++) {
+    if ((*p >= 'A') && (*p <= 'Z')) *p += 0x20;
+    if ((p [0] == 0xc3) && (p [1] >= 0x80) && (p [1] <= 0x9e) && (p [1] != 0x97)) p [1] += 0x20;
+    h ^= *p;
+    h *= 16777619u;
+    }
+  return (h);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazvalid
+*
+* DESCRIPTION   Gazetteer layout check.
+*
+* ARGUMENTS     m     Gazetteer image
+*               len   Image length [Bytes]
+*
+* GLOBALS       -
+*
+* RETURNS       True if all sizes, offsets and indices are within the image
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Done once, so that lookups need no checks.
+*
+\**************************************************************************/
+
+bool gazvalid (const char *m, size_t len) {
+  const GazHead  *h;
+  const GazPlace *pl;
+  const GazNode  *kd;
+  const GazSlot  *sl;
+  const char     *nm;
+  unsigned int   i;
+  if (len < sizeof (GazHead)) return (false);
+  h = (const GazHead *) m;
+  if ((memcmp (h -> magic, "NOAAGAZ2", 8) != 0) || (h -> nslot == 0) || ((h -> nslot & (h -> nslot - 1)) != 0) || (h -> nname == 0)) return (false);
+  if (len != sizeof (GazHead) + (size_t) h -> nplace * (sizeof (GazPlace) + sizeof (GazNode)) +
+             (size_t) h -> nslot * sizeof (GazSlot) + h -> nname) return (false);
+  pl = (const GazPlace *) (h + 1);
+  kd = (const GazNode *) (pl + h -> nplace);
+  sl = (const GazSlot *) (kd + h -> nplace);
+  nm = (const char *) (sl + h -> nslot);
+  if (nm [h -> nname - 1] != 0) return (false);
+  for (i = 0 ; i < h -> nplace ; i++) if ((pl [i].name >= h -> nname) || (kd [i].place >= h -> nplace)) return (false);
+  for (i = 0 ; i < h -> nslot ; i++) if ((sl [i].place > h -> nplace) || (sl [i].key >= h -> nname)) return (false);
+  return (true);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazopen
+*
+* DESCRIPTION   Mapping of the gazetteer noaa_clock.gaz.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       gazmap   Mapped gazetteer
+*               gazlen   Mapped length
+*               gazsrc   File gazmap is from
+*
+* RETURNS       True if a gazetteer is available
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   noaa_clock.cnf compiled in memory when needed
+*               2026 10 16   JPT   Source file noted
+*
+* NOTES         Tried once. The text noaa_clock.cnf stays the source of
+*               truth: a gazetteer older than it is not used, and then, or
+*               without one, the cnf is compiled in memory instead, which
+*               is quick for a cnf of some hundred lines.
+*
+\**************************************************************************/
+
+bool gazopen (void) {
+  static bool tried = false;
+  struct stat sg, sc;
+  bool        cnf;
+  void        *m;
+  size_t      len;
+  if (tried) return (gazmap != NULL);
+  tried = true;
+  cnf = (stat ("noaa_clock.cnf", &sc) == 0);
+  m   = NULL;
+  len = 0;
+  if (stat ("noaa_clock.gaz", &sg) == 0) {
+    if (cnf && (sc.st_mtime > sg.st_mtime))
+      fprintf (stderr, "noaa_clock.gaz is older than noaa_clock.cnf and is not used, rebuild it with -gaz.\n");
+    else len = sg.st_size;
+    }
+  if (len >= sizeof (GazHead)) {
+#ifdef _WIN32
+    HANDLE fh, mh;
+    fh = CreateFileA ("noaa_clock.gaz", GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh != INVALID_HANDLE_VALUE) {
+      mh = CreateFileMappingA (fh, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (mh != NULL) {
+        m = MapViewOfFile (mh, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle (mh);
+        }
+      CloseHandle (fh);
+      }
+#else
+    int fd;
+    fd = open ("noaa_clock.gaz", O_RDONLY);
+    if (fd >= 0) {
+      m = mmap (NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+      if (m == MAP_FAILED) m = NULL;
+      close (fd);
+      }
+#endif
+    if (m && gazvalid ((const char *) m, len)) {
+      gazmap = (const char *) m;
+      gazlen = len;
+      gazsrc = "noaa_clock.gaz";
+      return (true);
+      }
+    if (m) {
+      fprintf (stderr, "noaa_clock.gaz is invalid and is not used.\n");
+#ifdef _WIN32
+      UnmapViewOfFile (m);
+#else
+      munmap (m, len);
+#endif
+      }
+    }
+  if (cnf) gazmap = gazbuild ("noaa_clock.cnf", NULL, &gazlen);
+  if (gazmap) gazsrc = "noaa_clock.cnf";
+  return (gazmap != NULL);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazfind
+*
+* DESCRIPTION   Location lookup in the mapped gazetteer.
+*
+* ARGUMENTS     loc   Location name, UTF-8 or Latin-1, any case
+*               la    Latitude [Decimal degrees]
+*               lo    Longitude [Decimal degrees]
+*               tz    Standard timezone [Hours]
+*               dst   Daylight saving time rule
+*
+* GLOBALS       gazmap   Mapped gazetteer
+*
+* RETURNS       Place index, -1 if not found
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Place index returned
+*
+* NOTES         One hash and normally one key comparison, no parsing and
+*               no heap.
+*
+\**************************************************************************/
+
+int gazfind (const char *loc, double *la, double *lo, double *tz, int *dst) {
+  const GazHead  *h;
+  const GazPlace *pl;
+  const GazSlot  *sl;
+  const char     *nm;
+  char           key [256];
+  unsigned int   hv, i;
+  if (gazmap == NULL) return (-1);
+  h  = (const GazHead *) gazmap;
+  pl = (const GazPlace *) (h + 1);
+  sl = (const GazSlot *) ((const GazNode *) (pl + h -> nplace) + h -> nplace);
+  nm = (const char *) (sl + h -> nslot);
+  hv = gazkey (loc, key, sizeof (key));
+  for (i = hv & (h -> nslot - 1) ; sl [i].place != 0 ; i = (i + 1) & (h -> nslot - 1)) {
+    if ((sl [i].hash != hv) || (strcmp (nm + sl [i].key, key) != 0)) continue;
+    pl += sl [i].place - 1;
+    *la  = pl -> lat_deg;
+    *lo  = pl -> long_deg;
+    *tz  = pl -> timezone_hr;
+    *dst = pl -> dst;
+    return (sl [i].place - 1);
+    }
+  return (-1);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      unitvec
+*
+* DESCRIPTION   Geographic coordinates to a unit vector.
+*
+* ARGUMENTS     la   Latitude [Decimal degrees]
+*               lo   Longitude [Decimal degrees]
+*               v    Unit vector, X to 0 N 0 E, Z to the North Pole
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void unitvec (double la, double lo, float *v) {
+  v [0] = cos (d2r (la)) * cos (d2r (lo));
+  v [1] = cos (d2r (la)) * sin (d2r (lo));
+  v [2] = sin (d2r (la));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      kdbuild
+*
+* DESCRIPTION   Implicit k-d tree construction.
+*
+* ARGUMENTS     kd      Nodes, reordered in place
+*               lo      First node of the subtree
+*               hi      Last node of the subtree + 1
+*               depth   Depth of the subtree root
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Median partitioning, O (n log n).
+*
+\**************************************************************************/
+
+void kdbuild (GazNode *kd, unsigned int lo, unsigned int hi, int depth) {
+  unsigned int mid;
+  int          c;
+  if (hi - lo < 2) return;
+  mid = lo + (hi - lo) / 2;
+  c   = depth % 3;
+  std :: nth_element (kd + lo, kd + mid, kd + hi, [c] (const GazNode &a, const GazNode &b) {return (a.v [c] < b.v [c]);});
+  kdbuild (kd, lo, mid, depth + 1);
+  kdbuild (kd, mid + 1, hi, depth + 1);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      kdnear
+*
+* DESCRIPTION   Nearest neighbour search in an implicit k-d tree.
+*
+* ARGUMENTS     kd      Nodes
+*               lo      First node of the subtree
+*               hi      Last node of the subtree + 1
+*               depth   Depth of the subtree root
+*               q       Query unit vector
+*               best    Nearest node so far
+*               bd      Squared chord distance of best
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The near side first, the far side only if the splitting
+*               plane is closer than the best so far: O (log n) typical.
+*
+\**************************************************************************/
+
+void kdnear (const GazNode *kd, unsigned int lo, unsigned int hi, int depth, const float *q, unsigned int *best, float *bd) {
+  unsigned int mid;
+  float        d, dx, dy, dz, dc;
+  int          c;
+  if (lo >= hi) return;
+  mid = lo + (hi - lo) / 2;
+  c   = depth % 3;
+  dx  = q [0] - kd [mid].v [0];
+  dy  = q [1] - kd [mid].v [1];
+  dz  = q [2] - kd [mid].v [2];
+  d   = dx * dx + dy * dy + dz * dz;
+  if (d < *bd) {
+    *bd   = d;
+    *best = mid;
+    }
+  dc = q [c] - kd [mid].v [c];
+  if (dc < 0) {
+    kdnear (kd, lo, mid, depth + 1, q, best, bd);
+    if (dc * dc < *bd) kdnear (kd, mid + 1, hi, depth + 1, q, best, bd);
+    }
+  else {
+    kdnear (kd, mid + 1, hi, depth + 1, q, best, bd);
+    if (dc * dc < *bd) kdnear (kd, lo, mid, depth + 1, q, best, bd);
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      kdradius
+*
+* DESCRIPTION   Radius search in an implicit k-d tree.
+*
+* ARGUMENTS     kd      Nodes
+*               lo      First node of the subtree
+*               hi      Last node of the subtree + 1
+*               depth   Depth of the subtree root
+*               q       Query unit vector
+*               r2      Squared chord radius
+*               out     Places found, the nearest max of them
+*               d2      Their squared chord distances
+*               max     Size of out and d2
+*               n       Places found so far, also those beyond max
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Nearest max kept, not the first max
+*
+* NOTES         O (log n + found) typical. out and d2 are a max-heap on
+*               the distance, unordered for the caller; a place nearer
+*               than the root replaces it once max are found.
+*
+\**************************************************************************/
+
+void kdradius (const GazNode *kd, unsigned int lo, unsigned int hi, int depth, const float *q, float r2, unsigned int *out, float *d2, int max, int *n) {
+  unsigned int mid;
+  float        dx, dy, dz, dc, d;
+  int          c, i, j;
+  if (lo >= hi) return;
+  mid = lo + (hi - lo) / 2;
+  c   = depth % 3;
+  dx  = q [0] - kd [mid].v [0];
+  dy  = q [1] - kd [mid].v [1];
+  dz  = q [2] - kd [mid].v [2];
+  d   = dx * dx + dy * dy + dz * dz;
+  if (d <= r2) {
+    if (*n < max) {                  // Added as a leaf, sifted up
+      for (i = *n ; (i > 0) && (d2 [(i - 1) / 2] < d) ; i = (i - 1) / 2) {
+        d2 [i]  = d2 [(i - 1) / 2];
+        out [i] = out [(i - 1) / 2];
+        }
+      d2 [i]  = d;
+      out [i] = kd [mid].place;
+      }
+    else if (d < d2 [0]) {           // Replaces the farthest, sifted down
+      for (i = 0 ; (j = 2 * i + 1) < max ; i = j) {
+        if ((j + 1 < max) && (d2 [j + 1] > d2 [j])) j++;
+        if (d2 [j] <= d) break;
+        d2 [i]  = d2 [j];
+        out [i] = out [j];
+        }
+      d2 [i]  = d;
+      out [i] = kd [mid].place;
+      }
+    (*n)++;
+    }
+  dc = q [c] - kd [mid].v [c];
+  if ((dc < 0) || (dc * dc <= r2)) kdradius (kd, lo, mid, depth + 1, q, r2, out, d2, max, n);
+  if ((dc >= 0) || (dc * dc <= r2)) kdradius (kd, mid + 1, hi, depth + 1, q, r2, out, d2, max, n);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gaznear
+*
+* DESCRIPTION   Nearest known location to coordinates.
+*
+* ARGUMENTS     la     Latitude [Decimal degrees]
+*               lo     Longitude [Decimal degrees]
+*               name   Name of the location, UTF-8
+*               n      Size of name
+*               km     Great-circle distance [Kilometres]
+*
+* GLOBALS       gazmap   Mapped gazetteer
+*
+* RETURNS       Place index, -1 if no gazetteer or an empty one
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+int gaznear (double la, double lo, char *name, int n, double *km) {
+  const GazHead  *h;
+  const GazPlace *pl;
+  const GazNode  *kd;
+  const char     *nm;
+  unsigned int   best;
+  float          q [3], bd;
+  if ((! gazopen ()) || (((const GazHead *) gazmap) -> nplace == 0)) return (-1);
+  h  = (const GazHead *) gazmap;
+  pl = (const GazPlace *) (h + 1);
+  kd = (const GazNode *) (pl + h -> nplace);
+  nm = (const char *) ((const GazSlot *) (kd + h -> nplace) + h -> nslot);
+  unitvec (la, lo, q);
+  best = 0;
+  bd   = 5;
+  kdnear (kd, 0, h -> nplace, 0, q, &best, &bd);
+  *km = 2 * asin (fmin (1.0, sqrt (bd) / 2)) * 6371.0;
+  snprintf (name, n, "%s", nm + pl [kd [best].place].name);
+  return (kd [best].place);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazname
+*
+* DESCRIPTION   Addition of a name to the gazetteer compiler's name bytes.
+*
+* ARGUMENTS     buf   Name bytes, grown as needed
+*               len   Used length
+*               cap   Allocated length
+*               s     Name
+*
+* GLOBALS       -
+*
+* RETURNS       Offset of the name
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+unsigned int gazname (char **buf, size_t *len, size_t *cap, const char *s) {
+  size_t n, o;
+  n = strlen (s) + 1;
+  while (*len + n > *cap) {
+    *cap = (*cap) ? 2 * *cap : 65536;
+    *buf = (char *) realloc (*buf, *cap);
+    }
+  o = *len;
+  memcpy (*buf + o, s, n);
+  *len += n;
+  return ((unsigned int) o);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      tzcmp
+*
+* DESCRIPTION   Comparison of GeoNames timezone lines by identifier.
+*
+* ARGUMENTS     a, b   Pointers to line pointers
+*
+* GLOBALS       -
+*
+* RETURNS       strcmp () order of the identifiers
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         A line is the identifier, a NUL and the offsets.
+*
+\**************************************************************************/
+
+int tzcmp (const void *a, const void *b) {
+  return (strcmp (*(char * const *) a, *(char * const *) b));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazbuild
+*
+* DESCRIPTION   Gazetteer compiler.
+*
+* ARGUMENTS     src   Source file
+*               tzf   GeoNames timeZones.txt, NULL if none
+*               len   Image length [Bytes]
+*
+* GLOBALS       -
+*
+* RETURNS       Gazetteer image, allocated by malloc (), NULL on error
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   k-d tree of the places, image returned
+*
+* NOTES         The source is noaa_clock.cnf, the default, or a GeoNames
+*               dump (tab-separated, 19 fields), told apart line by line.
+*               A GeoNames place gets its name and ASCII name as keys, its
+*               standard timezone from the raw offset in a GeoNames
+*               timeZones.txt if given, otherwise from the longitude, and
+*               European Union daylight saving time for Europe/ zones with
+*               a summer offset, else none. A key
+*               given twice keeps the more populous place, for the cnf
+*               the first one.
+*
+\**************************************************************************/
+
+char *gazbuild (const char *src, const char *tzf, size_t *len) {
+  static char  ln [65536];
+  char         *f [19], *p, *names, **tzl, *tzbuf, key [256], nm [256], dststr [16], *tk, *img;
+  size_t       nlen, ncap, tzlen;
+  GazHead      h;
+  GazPlace     *pl;
+  GazNode      *kd;
+  GazSlot      *sl;
+  unsigned int *pop, *kplace, *kkey, *khash, np, nk, pcap, kcap, i, j, k, nf, ntz;
+  double       la, lo, tz, jan, jul, raw;
+  int          dst, n;
+  FILE         *in;
+
+  // GeoNames timezones, lines sorted by identifier
+
+  tzl = NULL;
+  ntz = 0;
+  tzbuf = NULL;
+  if (tzf) {
+    in = fopen (tzf, "rb");
+    if (in == NULL) {
+      fprintf (stderr, "Cannot open '%s'.\n", tzf);
+      return (NULL);
+      }
+    fseek (in, 0, SEEK_END);
+    tzlen = ftell (in);
+    fseek (in, 0, SEEK_SET);
+    tzbuf = (char *) malloc (tzlen + 1);
+    tzlen = fread (tzbuf, 1, tzlen, in);
+    tzbuf [tzlen] = 0;
+    fclose (in);
+    for (p = tzbuf ; *p ; p++) if (*p == '\n') ntz++;
+    tzl = (char **) malloc ((ntz + 1) * sizeof (char *));
+    ntz = 0;
+    for (p = strtok (tzbuf, "\r\n") ; p ; p = strtok (NULL, "\r\n")) {
+      if (strncmp (p, "CountryCode", 11) == 0) continue;
+      tk = strchr (p, '\t');
+      if (tk == NULL) continue;
+      tzl [ntz] = tk + 1;
+      tk = strchr (tk + 1, '\t');
+      if (tk == NULL) continue;
+      *tk = 0;
+      ntz++;
+      }
+    qsort (tzl, ntz, sizeof (char *), tzcmp);
+    }
+
+  // Places and keys
+
+  in = fopen (src, "rb");
+  if (in == NULL) {
+    fprintf (stderr, "Cannot open '%s'.\n", src);
+    free (tzl);
+    free (tzbuf);
+    return (NULL);
+    }
+  names = NULL; nlen = ncap = 0;
+  pl = NULL; pop = NULL; np = pcap = 0;
+  kplace = kkey = khash = NULL; nk = kcap = 0;
+  gazname (&names, &nlen, &ncap, "");
+  while (fgets (ln, sizeof (ln), in)) {
+    if ((strchr (ln, '\n') == NULL) && (! feof (in))) {
+      while (fgets (ln, sizeof (ln), in) && (strchr (ln, '\n') == NULL)) ;   // Overlong line skipped
+      continue;
+      }
+    ln [strcspn (ln, "\r\n")] = 0;
+    for (nf = 0, p = ln ; (nf < 19) && p ; nf++) {
+      f [nf] = p;
+      p = strchr (p, '\t');
+      if (p) *p++ = 0;
+      }
+    if (np == pcap) {
+      pcap = pcap ? 2 * pcap : 1024;
+      pl   = (GazPlace *) realloc (pl, pcap * sizeof (GazPlace));
+      pop  = (unsigned int *) realloc (pop, pcap * sizeof (unsigned int));
+      }
+    if (nf >= 18) {
+      la  = atof (f [4]);
+      lo  = atof (f [5]);
+      tz  = floor (lo / 15 + 0.5);
+      dst = DST_NONE;
+      if (tzl) {
+        tk = f [17];
+        char **e = (char **) bsearch (&tk, tzl, ntz, sizeof (char *), tzcmp);
+        if (e && (sscanf (*e + strlen (*e) + 1, "%lf %lf %lf", &jan, &jul, &raw) == 3)) {
+          tz = raw;
+          if (jan != jul) {   // Rules of the larger regions only
+            if      (strncmp (f [17], "Europe/", 7) == 0)     dst = DST_EU;
+            else if (strncmp (f [17], "America/", 8) == 0)    dst = (jul > jan) ? DST_US : DST_NONE;
+            else if (strncmp (f [17], "Australia/", 10) == 0) dst = DST_AU;
+            else if (strcmp (f [17], "Pacific/Auckland") == 0) dst = DST_NZ;
+            }
+          }
+        }
+      pop [np] = (unsigned int) atof (f [14]);
+      n = 2;
+      }
+    else {
+      if (strchr (ln, '*')) break;   // End of noaa_clock.cnf
+      n = sscanf (ln, "%255s %lf %lf %lf %15s", nm, &la, &lo, &tz, dststr);
+      if (n < 4) continue;
+      dst = (n == 5) ? dstparse (dststr) : DST_NONE;
+      f [1] = nm;
+      f [2] = nm;
+      pop [np] = 0;
+      n = 1;
+      }
+    toutf8 (f [1], key, sizeof (key));
+    pl [np].lat_deg     = la;
+    pl [np].long_deg    = lo;
+    pl [np].timezone_hr = tz;
+    pl [np].dst         = dst;
+    pl [np].name        = gazname (&names, &nlen, &ncap, key);
+    for (k = 0 ; k < (unsigned int) n ; k++) {
+      if ((k == 1) && (strcmp (f [1], f [2]) == 0)) break;
+      if (nk == kcap) {
+        kcap   = kcap ? 2 * kcap : 1024;
+        kplace = (unsigned int *) realloc (kplace, kcap * sizeof (unsigned int));
+        kkey   = (unsigned int *) realloc (kkey,   kcap * sizeof (unsigned int));
+        khash  = (unsigned int *) realloc (khash,  kcap * sizeof (unsigned int));
+        }
+      khash  [nk] = gazkey (f [1 + k], key, sizeof (key));
+      kkey   [nk] = gazname (&names, &nlen, &ncap, key);
+      kplace [nk] = np;
+      nk++;
+      }
+    np++;
+    }
+  fclose (in);
+
+  // Hash slots
+
+  h.nslot = 1;
+  while (h.nslot < 2 * nk + 1) h.nslot *= 2;
+  sl = (GazSlot *) calloc (h.nslot, sizeof (GazSlot));
+  for (k = 0 ; k < nk ; k++) {
+    for (i = khash [k] & (h.nslot - 1) ; sl [i].place != 0 ; i = (i + 1) & (h.nslot - 1))
+      if ((sl [i].hash == khash [k]) && (strcmp (names + sl [i].key, names + kkey [k]) == 0)) break;
+    if (sl [i].place != 0) {
+      j = sl [i].place - 1;
+      if (pop [kplace [k]] > pop [j]) sl [i].place = kplace [k] + 1;
+      continue;
+      }
+    sl [i].hash  = khash [k];
+    sl [i].place = kplace [k] + 1;
+    sl [i].key   = kkey [k];
+    }
+
+  // k-d tree
+
+  kd = (GazNode *) malloc ((np ? np : 1) * sizeof (GazNode));
+  for (i = 0 ; i < np ; i++) {
+    unitvec (pl [i].lat_deg, pl [i].long_deg, kd [i].v);
+    kd [i].place = i;
+    }
+  kdbuild (kd, 0, np, 0);
+
+  // Gazetteer image
+
+  memcpy (h.magic, "NOAAGAZ2", 8);
+  h.nplace = np;
+  h.nname  = (unsigned int) nlen;
+  h.pad    = 0;
+  *len = sizeof (h) + (size_t) np * (sizeof (GazPlace) + sizeof (GazNode)) + (size_t) h.nslot * sizeof (GazSlot) + nlen;
+  img  = (char *) malloc (*len);
+  p    = img;
+  memcpy (p, &h, sizeof (h));                        p += sizeof (h);
+  memcpy (p, pl, np * sizeof (GazPlace));            p += np * sizeof (GazPlace);
+  memcpy (p, kd, np * sizeof (GazNode));             p += np * sizeof (GazNode);
+  memcpy (p, sl, h.nslot * sizeof (GazSlot));        p += h.nslot * sizeof (GazSlot);
+  memcpy (p, names, nlen);
+  free (kd);
+  free (sl);
+  free (khash);
+  free (kkey);
+  free (kplace);
+  free (pop);
+  free (pl);
+  free (names);
+  free (tzl);
+  free (tzbuf);
+  return (img);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gazc
+*
+* DESCRIPTION   Gazetteer compiler command.
+*
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -gaz [source [target [timezones]]]
+*
+* GLOBALS       -
+*
+* RETURNS       Exit value
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Compiling moved to gazbuild ()
+*
+* NOTES         Source defaults to noaa_clock.cnf, target to noaa_clock.gaz.
+*
+\**************************************************************************/
+
+int gazc (int argc, char *argv []) {
+  const GazHead *h;
+  const char    *src, *dstf, *tzf;
+  char          *img;
+  size_t        len;
+  FILE          *out;
+  src  = (argc > 2) ? argv [2] : "noaa_clock.cnf";
+  dstf = (argc > 3) ? argv [3] : "noaa_clock.gaz";
+  tzf  = (argc > 4) ? argv [4] : NULL;
+  if (argc > 5) return (-1);
+  img = gazbuild (src, tzf, &len);
+  if (img == NULL) return (1);
+  h   = (const GazHead *) img;
+  out = fopen (dstf, "wb");
+  if (out) {
+    fwrite (img, 1, len, out);
+    if (fclose (out) != 0) out = NULL;
+    }
+  if (out) printf ("%s: %u places, %u slots, %lu bytes\n", dstf, h -> nplace, h -> nslot, (unsigned long) len);
+  else     fprintf (stderr, "Cannot write '%s'.\n", dstf);
+  free (img);
+  return (out ? 0 : 1);
+  }
+
+
+
+// Built-in locations for a missing noaa_clock.cnf
+
+struct Place {
+  const char *name;          // Location name, Latin-1
+  double     lat_deg,        // Latitude [Decimal degrees]
+             long_deg,       // Longitude [Decimal degrees]
+             timezone_hr;    // Standard timezone [Hours]
+  int        dst;            // Daylight saving time rule
+  };
+
+const Place builtin [] = {
+  {"Helsinki",     60.16,   24.83,  2,   DST_EU},
+  {"Riihimki",    60.739,  24.772, 2,   DST_EU},
+  {"Tampere",      61.498,  23.761, 2,   DST_EU},
+  {"Yljrvi",     61.55,   23.583, 2,   DST_EU},
+  {"Rovaniemi",    66.5,    25.733, 2,   DST_EU},
+  {"Inari",        68.905,  27.03,  2,   DST_EU},
+  {"Utsjoki",      69.9,    27.017, 2,   DST_EU},
+  {"Tukholma",     59.329,  18.069, 1,   DST_EU},
+  {"Stockholm",    59.329,  18.069, 1,   DST_EU},
+  {"Vargn",       58.35,   12.4,   1,   DST_EU},
+  {"Reykjavik",    64.135, -21.895, 0,   DST_NONE},
+  {"Longyearbyen", 78.22,   15.65,  1,   DST_EU},
+  {"Tallinna",     59.437,  24.745, 2,   DST_EU},
+  {"Tallinn",      59.437,  24.745, 2,   DST_EU},
+  {"Moskova",      55.75,   37.617, 3,   DST_NONE},
+  {"Moscow",       55.75,   37.617, 3,   DST_NONE},
+  {"Lontoo",       51.5,    -0.126, 0,   DST_EU},
+  {"London",       51.5,    -0.126, 0,   DST_EU},
+  {"Hampuri",      53.553,   9.992, 1,   DST_EU},
+  {"Hamburg",      53.553,   9.992, 1,   DST_EU},
+  {"Rooma",        41.895,  12.482, 1,   DST_EU},
+  {"Roma",         41.895,  12.482, 1,   DST_EU},
+  {"Tokio",        35.683, 139.767, 9,   DST_NONE},
+  {"Tokyo",        35.683, 139.767, 9,   DST_NONE},
+  {"Teheran",      35.696,  51.423, 3.5, DST_NONE},
+  {"Tehran",       35.696,  51.423, 3.5, DST_NONE},
+  {"NewYork",      40.713, -74.006, -5,  DST_US},
+  {"Sydney",      -33.868, 151.209, 10,  DST_AU},
+  {"Auckland",    -36.848, 174.763, 12,  DST_NZ},
+  };
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      showlocs
+*
+* DESCRIPTION   Listing of the known locations.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       gazmap   Mapped gazetteer
+*               gazsrc   File gazmap is from
+*
+* RETURNS       -
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Gazetteer size shown
+*               2026 10 16   JPT   Names from the gazetteer, not the cnf
+*
+* NOTES         The first GAZ_SHOW places in source order, a GeoNames
+*               gazetteer is far too long to list. Without a gazetteer the
+*               built-in locations.
+*
+\**************************************************************************/
+
+void showlocs (void) {
+  const GazHead  *h;
+  const GazPlace *pl;
+  const char     *nm;
+  char           name [256];
+  unsigned int   i;
+  printf ("Currently known locations are: ");
+  if (gazopen ()) {
+    h  = (const GazHead *) gazmap;
+    pl = (const GazPlace *) (h + 1);
+    nm = (const char *) ((const GazSlot *) ((const GazNode *) (pl + h -> nplace) + h -> nplace) + h -> nslot);
+    for (i = 0 ; (i < h -> nplace) && (i < GAZ_SHOW) ; i++) printf ("%s ", nm + pl [i].name);
+    if (h -> nplace > GAZ_SHOW) printf ("and %u more ", h -> nplace - GAZ_SHOW);
+    printf ("\n%u locations in %s.", h -> nplace, gazsrc);
+    }
+  else {
+    for (i = 0 ; i < sizeof (builtin) / sizeof (builtin [0]) ; i++) {
+      toutf8 (builtin [i].name, name, sizeof (name));
+      printf ("%s ", name);
+      }
+    }
+  printf ("\n\n");
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      setcoord
+*
+* DESCRIPTION   Location to coordinate pair.
+*
+* ARGUMENTS      loc   Location name
+*                la    Latitude [Decimal degrees]
+*                lo    Longitude [Decimal degrees]
+*                tz    Standard timezone [Hours]
+*                dst   Daylight saving time rule
+*
+* GLOBALS       gazmap   Mapped gazetteer
+*
+* RETURNS       True if the location is known
+*
+* HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Daylight saving time rule returned, not applied
+*               2026 10 15   JPT   Gazetteer lookup, built-in locations as a table
+*               2026 10 15   JPT   noaa_clock.cnf through the gazetteer only
+*
+* NOTES         Looked up in the gazetteer, which is noaa_clock.gaz if it
+*               is up to date, else noaa_clock.cnf compiled in memory, else
+*               in the built-in table.
+*
+\**************************************************************************/
+
+bool setcoord (char *loc, double *la, double *lo, double *tz, int *dst) {
+
+  unsigned int i;
+
+  *dst = DST_NONE;
+
+  // Gazetteer
+
+  if (gazopen ()) return (gazfind (loc, la, lo, tz, dst) >= 0);
+
+  // Fallback for a missing noaa_clock.cnf
+
+  for (i = 0 ; i < sizeof (builtin) / sizeof (builtin [0]) ; i++) {
+    if (strcmpi (loc, builtin [i].name) == 0) {
+      *la  = builtin [i].lat_deg;
+      *lo  = builtin [i].long_deg;
+      *tz  = builtin [i].timezone_hr;
+      *dst = builtin [i].dst;
+      return (true);
+      }
+    }
+
+  return (false);
+ 
+ }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gridsite
+*
+* DESCRIPTION   Grid site from the command line.
+*
+* ARGUMENTS     arg   Location name or latitude,longitude,timezone[,rule]
+*                     with rule none, eu, us, au or nz
+*               g     Site
+*
+* GLOBALS       -
+*
+* RETURNS       true if the site is known
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+bool gridsite (char *arg, GridSite *g) {
+  char rule [16];
+  int  n;
+  toutf8 (arg, g -> name, sizeof (g -> name));
+  g -> dst_rule = DST_NONE;
+  n = sscanf (arg, "%lf,%lf,%lf,%15s", &g -> lat_deg, &g -> long_deg, &g -> timezone_std, rule);
+  if (n == 4) g -> dst_rule = dstparse (rule);
+  if ((n < 3) && (! setcoord (arg, &g -> lat_deg, &g -> long_deg, &g -> timezone_std, &g -> dst_rule))) return (false);
+  g -> z   = dstzone (g -> timezone_std, g -> dst_rule);
+  g -> tab = NULL;
+  return (true);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gridtab
+*
+* DESCRIPTION   Pool job, day tables of a grid site.
+*
+* ARGUMENTS     i     Job index
+*               ctx   Indexes of the sites to build
+*
+* GLOBALS       grid   Sites of the grid display
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The tables are computed straight, not through the day
+*               table cache, so that the pool threads never wait on its
+*               lock; a day's tables take tens of microseconds.
+*
+\**************************************************************************/
+
+void gridtab (int i, void *ctx) {
+  GridSite *g;
+  NoaaIn   in;
+  g = &grid [((int *) ctx) [i]];
+  if (g -> tab == NULL) g -> tab = new DayTab;
+  in.lat_deg     = g -> key.lat_deg;
+  in.long_deg    = g -> key.long_deg;
+  in.date_d      = g -> key.date_d;
+  in.wtime_day   = 0;
+  in.timezone_hr = g -> key.timezone_hr;
+  load (&in, g -> tab);
+  g -> tab -> key = g -> key;
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        GridWidget :: cell
+*
+* DESCRIPTION   Cell of a grid site.
+*
+* ARGUMENTS     i   Site
+*
+* GLOBALS       -
+*
+* RETURNS       Rectangle of the dial and the text under it
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+QRect GridWidget :: cell (int i) {
+  return (QRect ((i % cols) * cellw, (i / cols) * cellh, cellw, cellh));
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        GridWidget :: layout
+*
+* DESCRIPTION   Grid layout for the widget size and the dial template.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       grid       Sites of the grid display
+*               ngrid      Number of sites
+*               painter    Qt painter object
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The column count is the one giving the largest dials.
+*               The template is the solar time scale of updscale (),
+*               drawn once at the dial size; the other scales of
+*               updscale () fall outside it. The site layers are dropped
+*               and redrawn over the new template.
+*
+\**************************************************************************/
+
+void GridWidget :: layout (void) {
+  int c, r, d, i;
+  dial = 0;
+  for (c = 1 ; c <= ngrid ; c++) {
+    r = (ngrid + c - 1) / c;
+    d = width () / c;
+    if (height () / r - GRID_TXT < d) d = height () / r - GRID_TXT;
+    if (d > dial) {
+      dial = d;
+      cols = c;
+      }
+    }
+  if (dial < 1) dial = 1;
+  cellw = width () / cols;
+  cellh = dial + GRID_TXT;
+  tpl = QImage (dial, dial, layerfmt);
+  tpl.fill (QColor (0, 0, 0));
+  painter -> begin (&tpl);
+  painter -> scale (dial / 1000.0, dial / 1000.0);
+  updscale ();
+  painter -> end ();
+  for (i = 0 ; i < ngrid ; i++) grid [i].layer = QImage ();
+  gridsize = size ();
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        GridWidget :: paintEvent
+*
+* DESCRIPTION   Grid display painting callback.
+*
+* ARGUMENTS     e   Paint event
+*
+* GLOBALS       grid      Sites of the grid display
+*               ngrid     Number of sites
+*               tab       Per-minute tables, set to each site's in turn
+*               painter   Qt painter object
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         A site's layer is the template with its twilight ring
+*               and wall-clock scale from updday (), redrawn when its
+*               tables change. Layer redraws stop when the frame has
+*               taken GRID_BUDGET milliseconds; the sites left show
+*               their old layer, or the bare template, and another
+*               frame is requested at once. Over the layers only the
+*               pointers and the text of the exposed cells are drawn.
+*
+\**************************************************************************/
+
+void GridWidget :: paintEvent (QPaintEvent *e) {
+  std :: chrono :: steady_clock :: time_point a;
+  GridSite *g;
+  QRect    c;
+  char     s [64];
+  double   sc;
+  int      i;
+  bool     more;
+  PERF (PS_PAINT);
+  a = std :: chrono :: steady_clock :: now ();
+  if (gridsize != size ()) layout ();
+  sc   = dial / 1000.0;
+  more = false;
+  for (i = 0 ; i < ngrid ; i++) {
+    g = &grid [i];
+    if ((g -> tab == NULL) || (! e -> region ().intersects (cell (i)))) continue;
+    if ((! g -> layer.isNull ()) && samekey (&g -> layerkey, &g -> tab -> key)) continue;
+    if (std :: chrono :: steady_clock :: now () - a > std :: chrono :: milliseconds (GRID_BUDGET)) {
+      more = true;
+      continue;
+      }
+    PERF (PS_LAYER);
+    tab = g -> tab;
+    g -> layer = tpl.copy ();
+    painter -> begin (&g -> layer);
+    painter -> scale (sc, sc);
+    updday ();
+    painter -> end ();
+    g -> layerkey = tab -> key;
+    }
+  painter -> begin (this);
+  painter -> setClipRegion (e -> region ());
+  for (i = 0 ; i < ngrid ; i++) {
+    g = &grid [i];
+    c = cell (i);
+    if (! e -> region ().intersects (c)) continue;
+    painter -> fillRect (c, QColor (0, 0, 0));
+    painter -> drawImage (c.x () + (cellw - dial) / 2, c.y (), g -> layer.isNull () ? tpl : g -> layer);
+    if (g -> tab != NULL) {
+      painter -> save ();
+      painter -> translate (c.x () + (cellw - dial) / 2, c.y ());
+      painter -> scale (sc, sc);
+      drawtl (g -> cf, 0, 425, 0x00ff8000);
+      painter -> restore ();
+      }
+    painter -> setPen (QColor (255, 255, 255));
+    painter -> drawText (c.x () + 4, c.y () + dial, cellw - 8, 16, Qt :: AlignLeft | Qt :: AlignVCenter, QString :: fromUtf8 (g -> name));
+    sprintf (s, "%02d:%02d", g -> hhmm / 60, g -> hhmm % 60);
+    painter -> drawText (c.x () + 4, c.y () + dial, cellw - 8, 16, Qt :: AlignRight | Qt :: AlignVCenter, QString (s));
+    sprintf (s, "elevation %+5.1f   azimuth %3.0f", g -> cec, g -> caz);
+    painter -> setPen (QColor (192, 192, 192));
+    painter -> drawText (c.x () + 4, c.y () + dial + 16, cellw - 8, 16, Qt :: AlignLeft | Qt :: AlignVCenter, QString (s));
+    }
+  painter -> end ();
+  if (more) QTimer :: singleShot (0, this, SLOT (update ()));
+  }
+
+
+
+/**************************************************************************\
+*
+* METHOD        GridWidget :: gloop
+*
+* DESCRIPTION   Grid display update timer response method.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       grid    Sites of the grid display
+*               ngrid   Number of sites
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The sites whose day or daylight saving time changed get
+*               their tables built in parallel by the work-stealing pool,
+*               all of them at start-up. Only the cells of the sites whose
+*               values changed are repainted, so at a minute boundary
+*               that is every cell, in between none.
+*
+\**************************************************************************/
+
+void GridWidget :: gloop (void) {
+  QDateTime now, lt;
+  GridSite  *g;
+  DayKey    key;
+  int       *todo, n, i, m, dst;
+  float     cf, cec, caz;
+  PERF (PS_ELOOP);
+  now  = utcnow ();
+  todo = new int [ngrid];
+  n    = 0;
+  for (i = 0 ; i < ngrid ; i++) {
+    g   = &grid [i];
+    dst = dstoff (g -> z, now.toMSecsSinceEpoch () / 1000);
+    lt  = now.addSecs ((qint64) (3600 * g -> timezone_std) + 3600 * dst);
+    key.date_d      = QDate (1900, 1, 1).daysTo (lt.date ()) + 2;
+    key.lat_deg     = g -> lat_deg;
+    key.long_deg    = g -> long_deg;
+    key.timezone_hr = g -> timezone_std + dst;
+    key.dst         = dst;
+    g -> hhmm       = 60 * lt.time ().hour () + lt.time ().minute ();
+    if ((g -> tab == NULL) || (! samekey (&key, &g -> tab -> key))) {
+      g -> key = key;
+      todo [n++] = i;
+      }
+    }
+  if (n > 0) parrun (n, (n > 1) ? 0 : 1, gridtab, todo);
+  delete [] todo;
+  for (i = 0 ; i < ngrid ; i++) {
+    g   = &grid [i];
+    m   = g -> hhmm;
+    cf  = g -> tab -> solarmin [m] / 1440.0;
+    cec = g -> tab -> elevc [m];
+    caz = g -> tab -> azim [m];
+    if ((cf == g -> cf) && (cec == g -> cec) && (caz == g -> caz) && (! g -> layer.isNull ()) && samekey (&g -> layerkey, &g -> tab -> key)) continue;
+    g -> cf  = cf;
+    g -> cec = cec;
+    g -> caz = caz;
+    update (cell (i));
+    }
+  schedule (now, 0);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      gridmain
+*
+* DESCRIPTION   Grid display of several locations.
+*
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -grid site site ...
+*
+* GLOBALS       grid      Sites of the grid display
+*               ngrid     Number of sites
+*               dw        Display widget
+*               painter   Qt painter object
+*               ticker    Single-shot display update timer
+*
+* RETURNS       Exit value, -1 for bad arguments
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Sized for a 4K screen. The values step once a minute.
+*
+\**************************************************************************/
+
+int gridmain (int argc, char *argv []) {
+  GridWidget *gw;
+  QTimer     timer;
+  int        i;
+  if ((argc < 3) || (argc - 2 > GRID_MAX)) return (-1);
+  ngrid = argc - 2;
+  grid  = new GridSite [ngrid];
+  for (i = 0 ; i < ngrid ; i++) {
+    if (! gridsite (argv [i + 2], &grid [i])) {
+      printf ("'%s' is an unknown location.\n\n", argv [i + 2]);
+      return (-1);
+      }
+    grid [i].cf = grid [i].cec = grid [i].caz = -1;
+    }
+  QApplication app (argc, NULL);
+  gw = new GridWidget ();
+  dw = gw;
+  gw -> setAttribute (Qt :: WA_OpaquePaintEvent);
+  gw -> resize (3840, 2160);
+  gw -> show ();
+  painter = new QPainter ();
+  timer.setSingleShot (true);
+  ticker = &timer;
+  QObject :: connect (&timer, SIGNAL (timeout ()), gw, SLOT (gloop ()));
+  gw -> gloop ();
+  app.exec ();
+  return (0);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      nearest
+*
+* DESCRIPTION   Nearest known location to coordinates.
+*
+* ARGUMENTS     la     Latitude [Decimal degrees]
+*               lo     Longitude [Decimal degrees]
+*               name   Name of the location, UTF-8
+*               n      Size of name
+*               km     Great-circle distance [Kilometres]
+*
+* GLOBALS       -
+*
+* RETURNS       True if a location was found
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The k-d tree of the gazetteer, a linear search of the
+*               built-in table without one.
+*
+\**************************************************************************/
+
+bool nearest (double la, double lo, char *name, int n, double *km) {
+  unsigned int i, best;
+  float        q [3], v [3], d, bd;
+  if (gaznear (la, lo, name, n, km) >= 0) return (true);
+  if (gazmap) return (false);
+  unitvec (la, lo, q);
+  best = 0;
+  bd   = 5;
+  for (i = 0 ; i < sizeof (builtin) / sizeof (builtin [0]) ; i++) {
+    unitvec (builtin [i].lat_deg, builtin [i].long_deg, v);
+    d = (q [0] - v [0]) * (q [0] - v [0]) + (q [1] - v [1]) * (q [1] - v [1]) + (q [2] - v [2]) * (q [2] - v [2]);
+    if (d < bd) {
+      bd   = d;
+      best = i;
+      }
+    }
+  *km = 2 * asin (fmin (1.0, sqrt (bd) / 2)) * 6371.0;
+  snprintf (name, n, "%s", builtin [best].name);
+  return (true);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      revgeo
+*
+* DESCRIPTION   Reverse geocoding of coordinates to known locations.
+*
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -near lat,long [km] or -near -
+*
+* GLOBALS       gazmap   Mapped gazetteer
+*
+* RETURNS       Exit value
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         With a radius, all locations within it from the gazetteer,
+*               nearest first. With -, lat,long lines from stdin to CSV
+*               lines lat,long,name,km on stdout, for bulk use.
+*
+\**************************************************************************/
+
+int revgeo (int argc, char *argv []) {
+  static unsigned int found [4096];
+  static float        d2 [4096];
+  static double       dist [4096];
+  static char         ln [256];
+  const GazHead       *h;
+  const GazPlace      *pl;
+  const GazNode       *kd;
+  const char          *nm;
+  char                name [256];
+  double              la, lo, km, r;
+  float               q [3], v [3];
+  int                 i, j, n;
+  if ((argc < 3) || (argc > 4)) return (-1);
+
+  // Bulk from stdin
+
+  if (strcmp (argv [2], "-") == 0) {
+    if (argc != 3) return (-1);
+    while (fgets (ln, sizeof (ln), stdin)) {
+      if (sscanf (ln, "%lf , %lf", &la, &lo) != 2) continue;
+      if (nearest (la, lo, name, sizeof (name), &km)) printf ("%.5f,%.5f,%s,%.1f\n", la, lo, name, km);
+      else                                            printf ("%.5f,%.5f,,\n", la, lo);
+      }
+    return (0);
+    }
+
+  if ((sscanf (argv [2], "%lf , %lf", &la, &lo) != 2) || (fabs (la) > 90) || (fabs (lo) > 180)) return (-1);
+
+  // Nearest
+
+  if (argc == 3) {
+    if (! nearest (la, lo, name, sizeof (name), &km)) {
+      fprintf (stderr, "No known locations.\n");
+      return (1);
+      }
+    printf ("%s %.1f km\n", name, km);
+    return (0);
+    }
+
+  // Within a radius
+
+  r = atof (argv [3]);
+  if ((r <= 0) || (! gazopen ())) {
+    fprintf (stderr, (r <= 0) ? "Bad radius.\n" : "No gazetteer.\n");
+    return (1);
+    }
+  h  = (const GazHead *) gazmap;
+  pl = (const GazPlace *) (h + 1);
+  kd = (const GazNode *) (pl + h -> nplace);
+  nm = (const char *) ((const GazSlot *) (kd + h -> nplace) + h -> nslot);
+  unitvec (la, lo, q);
+  r = 2 * sin (fmin (r / 6371.0, M_PI) / 2);
+  n = 0;
+  kdradius (kd, 0, h -> nplace, 0, q, (float) (r * r), found, d2, 4096, &n);
+  if (n > 4096) {
+    fprintf (stderr, "%d locations, nearest 4096 shown.\n", n);
+    n = 4096;
+    }
+  for (i = 0 ; i < n ; i++) {
+    unitvec (pl [found [i]].lat_deg, pl [found [i]].long_deg, v);
+    dist [i] = 2 * asin (fmin (1.0, sqrt ((q [0] - v [0]) * (q [0] - v [0]) + (q [1] - v [1]) * (q [1] - v [1]) + (q [2] - v [2]) * (q [2] - v [2])) / 2)) * 6371.0;
+    }
+  for (i = 1 ; i < n ; i++) {   // Insertion sort by distance
+    for (j = i ; (j > 0) && (dist [j] < dist [j - 1]) ; j--) {
+      std :: swap (dist [j], dist [j - 1]);
+      std :: swap (found [j], found [j - 1]);
+      }
+    }
+  for (i = 0 ; i < n ; i++) printf ("%s %.1f km\n", nm + pl [found [i]].name, dist [i]);
+  return (0);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      check
+*
+* DESCRIPTION   Tolerance check of the batch kernel and the sub-minute
+*               interpolation against the scalar per-minute stage.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       use_avx2    Batch evaluation by the AVX2 kernel
+*               precision   Precision tier, restored on return
+*
+* RETURNS       Exit value, 0 when within tolerance
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Double precision tier pinned
+*
+* NOTES         The double precision tier is checked whatever -prec
+*               selected, so that the AVX2 kernel is still compared with
+*               the scalar one. Latitudes from pole to pole, dates around
+*               the solstices and equinoxes over two centuries, timezones
+*               -12...+14 h. Also checks the sub-minute interpolation of
+*               tabinterp () at scattered times against the direct
+*               per-minute stage.
+*
+\**************************************************************************/
+
+int check (void) {
+  static float bs [5 * 1440], ss [5 * 1440];
+  NoaaIn       in;
+  NoaaDay      day;
+  NoaaCols     bc, sc;
+  NoaaMin      m;
+  double       w [1440], e, emax [5], x, v [5];
+  const char   *name [5] = {"solar time [min]", "elevation [deg]", "corrected elevation [deg]", "azimuth [deg]", "Sun longitude [deg]"};
+  int          prec0, i, k, la, dd, fail;
+  prec0     = precision;
+  precision = PREC_DOUBLE;
+  printf ("Batch kernel: %s\n", use_avx2 ? "AVX2" : "scalar (no AVX2)");
+  bc.solarmin = bs; bc.elev = bs + 1440; bc.elevc = bs + 2880; bc.azim = bs + 4320; bc.sunlong = bs + 5760;
+  sc.solarmin = ss; sc.elev = ss + 1440; sc.elevc = ss + 2880; sc.azim = ss + 4320; sc.sunlong = ss + 5760;
+  for (i = 0 ; i < 1440 ; i++) w [i] = (double) i / 1440.0;
+  for (k = 0 ; k < 5 ; k++) emax [k] = 0;
+  for (la = -90 ; la <= 90 ; la += 5) {
+    for (dd = 0 ; dd < 73000 ; dd += 1013) {
+      in.lat_deg     = la;
+      in.long_deg    = 7.3 * la - 180 * (la > 0);
+      in.date_d      = 18000 + dd;
+      in.wtime_day   = 0;
+      in.timezone_hr = ((dd / 1013) % 27) - 12;
+      noaa_day (&in, &day);
+      noaa_batch (&day, w, 1440, &bc);
+      noaa_batch_scalar (&day, w, 1440, &sc);
+      for (k = 0 ; k < 5 ; k++) {
+        for (i = 0 ; i < 1440 ; i++) {
+          e = fabs ((double) bs [k * 1440 + i] - ss [k * 1440 + i]);
+          if (k == 0) e = fmin (e, fabs (e - 1440));
+          if (k >= 3) e = fmin (e, fabs (e - 360));
+          if ((e > emax [k]) || (e != e)) emax [k] = e;
+          }
+        }
+      }
+    }
+  fail = 0;
+  for (k = 0 ; k < 5 ; k++) {
+    printf ("  %-26s max difference %.2e\n", name [k], emax [k]);
+    if (! (emax [k] <= 1e-4)) fail = 1;
+    }
+  printf ("Sub-minute interpolation against noaa_min ()\n");
+  for (k = 0 ; k < 5 ; k++) emax [k] = 0;
+  for (la = -90 ; la <= 90 ; la += 5) {
+    for (dd = 0 ; dd < 73000 ; dd += 1013) {
+      in.lat_deg     = la;
+      in.long_deg    = 7.3 * la - 180 * (la > 0);
+      in.date_d      = 18000 + dd;
+      in.wtime_day   = 0;
+      in.timezone_hr = ((dd / 1013) % 27) - 12;
+      noaa_day (&in, &day);
+      noaa_batch (&day, w, 1440, &bc);
+      for (i = 0 ; i < 1440 ; i++) {
+        x = i + ((i * 7919 + dd) % 997) / 997.0;
+        m = noaa_min (&day, x / 1440);
+        e     = tabinterp (bc.elev, x, 0);
+        v [0] = tabinterp (bc.solarmin, x, 1440) - m.soltime_min;
+        v [1] = e - m.elev_deg;
+        v [2] = e + refraction (e) - m.elevc_deg;
+        v [3] = tabinterp (bc.azim,     x, 360)  - m.az_deg;
+        v [4] = tabinterp (bc.sunlong,  x, 360)  - fmod (m.truelong_deg, 360.0);
+        for (k = 0 ; k < 5 ; k++) {
+          e = fabs (v [k]);
+          if (k == 0) e = fmin (e, fabs (e - 1440));
+          if (k >= 3) e = fmin (e, fabs (e - 360));
+          if ((k >= 1) && (k <= 3) && (fabs (m.elev_deg) > 80)) continue;
+          if ((k == 3) && (abs (la) == 90)) continue;
+          if ((e > emax [k]) || (e != e)) emax [k] = e;
+          }
+        }
+      }
+    }
+  for (k = 0 ; k < 5 ; k++) {
+    printf ("  %-26s max difference %.2e%s\n", name [k], emax [k], ((k >= 1) && (k <= 3)) ? ", elevation within +-80 deg" : "");
+    if (! (emax [k] <= ((k == 0) ? 1e-3 : ((k == 3) ? 2e-3 : 1e-4)))) fail = 1;
+    }
+#ifndef NOAA_NOCHEB
+  printf ("Chebyshev ephemeris against the full series\n");
+  if (! noaa_chebcheck (cheb_tab, sizeof (cheb_tab) / sizeof (cheb_tab [0]), v)) fail = 1;
+  printf ("  %-26s max difference %.2e\n", "declination [deg]", v [0]);
+  printf ("  %-26s max difference %.2e\n", "equation of time [min]", v [1]);
+  printf ("  %-26s max difference %.2e\n", "true longitude [deg]", v [2]);
+  printf ("  %-26s max difference %.2e\n", "radius vector [AU]", v [3]);
+#endif
+  precision = prec0;
+  printf ("%s\n", fail ? "FAILED" : "OK");
+  return (fail);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      getsite
+*
+* DESCRIPTION   Command line site to coordinates.
+*
+* ARGUMENTS     arg    Location name or latitude,longitude,timezone
+*               site   Site
+*
+* GLOBALS       -
+*
+* RETURNS       False for an unknown location
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Daylight saving time is not applied.
+*
+\**************************************************************************/
+
+bool getsite (char *arg, GenSite *site) {
+  int dst;
+  memset (site -> name, 0, sizeof (site -> name));
+  strncpy (site -> name, arg, sizeof (site -> name) - 1);
+  if (sscanf (arg, "%lf,%lf,%lf", &site -> lat_deg, &site -> long_deg, &site -> timezone_hr) == 3) return (true);
+  return (setcoord (arg, &site -> lat_deg, &site -> long_deg, &site -> timezone_hr, &dst));
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      hms
+*
+* DESCRIPTION   Fraction of day to text.
+*
+* ARGUMENTS     w   Time [Fraction of day]
+*               s   Text, at least 16 characters
+*
+* GLOBALS       -
+*
+* RETURNS       s
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Times outside the day are marked with the day offset.
+*
+\**************************************************************************/
+
+char *hms (double w, char *s) {
+  int sec, dd;
+  sec = (int) floor (w * 86400 + 0.5);
+  dd  = (int) floor (sec / 86400.0);
+  sec = sec - 86400 * dd;
+  if (dd == 0) sprintf (s, "%02d:%02d:%02d",      sec / 3600, (sec / 60) % 60, sec % 60);
+  else         sprintf (s, "%02d:%02d:%02d %+dd", sec / 3600, (sec / 60) % 60, sec % 60, dd);
+  return (s);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      events
+*
+* DESCRIPTION   Sun events of one day at a site.
+*
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -events yyyy-mm-dd site
+*                      [elevation], a site as for gen ()
+*
+* GLOBALS       -
+*
+* RETURNS       Exit value
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Times are standard time of the site.
+*
+\**************************************************************************/
+
+int events (int argc, char *argv []) {
+  GenSite   site;
+  NoaaIn    in;
+  NoaaDay   day;
+  SunEvents ev;
+  QDate     dd;
+  char      s1 [16], s2 [16];
+  double    user_deg;
+  int       y, m, dm, i;
+  if ((argc < 4) || (argc > 5)) return (-1);
+  if (sscanf (argv [2], "%d-%d-%d", &y, &m, &dm) != 3) return (-1);
+  dd = QDate (y, m, dm);
+  if (! dd.isValid ()) return (-1);
+  user_deg = 0;
+  if ((argc == 5) && (sscanf (argv [4], "%lf", &user_deg) != 1)) return (-1);
+  if (getsite (argv [3], &site) == false) {
+    fprintf (stderr, "'%s' is an unknown location.\n", argv [3]);
+    return (1);
+    }
+  in.lat_deg     = site.lat_deg;
+  in.long_deg    = site.long_deg;
+  in.date_d      = QDate (1900, 1, 1).daysTo (dd) + 2;
+  in.wtime_day   = 0;
+  in.timezone_hr = site.timezone_hr;
+  noaa_day (&in, &day);
+  noaa_events (&day, user_deg, &ev);
+  printf ("%s %04d-%02d-%02d, latitude %.4f, longitude %.4f, timezone %+.2f h\n", site.name, y, m, dm,
+          site.lat_deg, site.long_deg, site.timezone_hr);
+  printf ("  Solar noon       %-12s elevation %+7.3f\n", hms (ev.noon_day,     s1), ev.noonelev_deg);
+  printf ("  Solar midnight   %-12s elevation %+7.3f\n", hms (ev.midnight_day, s1), ev.midnightelev_deg);
+  printf ("  Elevation   Rising       Setting\n");
+  for (i = 0 ; i < NTHRESH ; i++) {
+    if ((i == NTHRESH - 1) && (argc < 5)) break;
+    if      (ev.polar [i] ==  1) printf ("  %+8.3f    above all day\n", ev.thresh_deg [i]);
+    else if (ev.polar [i] == -1) printf ("  %+8.3f    below all day\n", ev.thresh_deg [i]);
+    else printf ("  %+8.3f    %-12s %s\n", ev.thresh_deg [i],
+                 (ev.rise_day [i] == ev.rise_day [i]) ? hms (ev.rise_day [i], s1) : "-",
+                 (ev.set_day  [i] == ev.set_day  [i]) ? hms (ev.set_day  [i], s2) : "-");
+    }
+  return (0);
+  }
+
+
+
+#ifndef _WIN32
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qryunlink, qrypush
+*
+* DESCRIPTION   Query daemon day terms out of the least recently used
+*               list, into its head.
+*
+* ARGUMENTS     i   Index of the day terms
+*
+* GLOBALS       qent   Day terms
+*               qmru   Most recently used day terms, -1 if none
+*               qlru   Least recently used day terms, -1 if none
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         -
+*
+\**************************************************************************/
+
+void qryunlink (int i) {
+  QryEnt *e;
+  e = &qent [i];
+  if (e -> prev >= 0) qent [e -> prev].next = e -> next;
+  else                qmru = e -> next;
+  if (e -> next >= 0) qent [e -> next].prev = e -> prev;
+  else                qlru = e -> prev;
+  }
+
+void qrypush (int i) {
+  qent [i].prev = -1;
+  qent [i].next = qmru;
+  if (qmru >= 0) qent [qmru].prev = i;
+  else           qlru = i;
+  qmru = i;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qryget
+*
+* DESCRIPTION   Query daemon day terms of a location, date and timezone.
+*
+* ARGUMENTS     la       Latitude [Decimal degrees]
+*               lo       Longitude [Decimal degrees]
+*               date_d   Date [Days since 1899 12 30]
+*               tz       Timezone [Hours]
+*
+* GLOBALS       qent    Day terms
+*               qhash   Hash chain heads
+*               qnent   Day terms in use
+*               qlru    Least recently used day terms
+*
+* RETURNS       Index of the day terms
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Found by hash, else computed over the least recently
+*               used. The day terms of the point queries pending since
+*               the last qryflush () are among the latest QRY_FLUSH + 1
+*               used, so never the least recently used.
+*
+\**************************************************************************/
+
+int qryget (double la, double lo, double date_d, double tz) {
+  DayKey       key;
+  NoaaIn       in;
+  unsigned int h;
+  int          i, *p;
+  memset (&key, 0, sizeof (key));
+  key.date_d      = date_d;
+  key.lat_deg     = la;
+  key.long_deg    = lo;
+  key.timezone_hr = tz;
+  h = tabhash (&key, offsetof (DayKey, dst)) & (QRY_HASH - 1);
+  for (i = qhash [h] ; i >= 0 ; i = qent [i].hnext) {
+    if (! samekey (&qent [i].key, &key)) continue;
+    if (i != qmru) {
+      qryunlink (i);
+      qrypush (i);
+      }
+    return (i);
+    }
+  if (qnent < QRY_LRU) {
+    i = qnent++;
+    qent [i].tab = NULL;
+    }
+  else {
+    i = qlru;
+    qryunlink (i);
+    for (p = &qhash [tabhash (&qent [i].key, offsetof (DayKey, dst)) & (QRY_HASH - 1)] ; *p != i ; p = &qent [*p].hnext) ;
+    *p = qent [i].hnext;
+    }
+  qent [i].key   = key;
+  qent [i].tabok = false;
+  qent [i].hnext = qhash [h];
+  qhash [h]      = i;
+  in.lat_deg     = la;
+  in.long_deg    = lo;
+  in.date_d      = date_d;
+  in.wtime_day   = 0;
+  in.timezone_hr = tz;
+  noaa_day (&in, &qent [i].day);
+  qrypush (i);
+  return (i);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qryout
+*
+* DESCRIPTION   Query daemon output to a connection.
+*
+* ARGUMENTS     c   Connection
+*               p   Bytes
+*               n   Byte count
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Out of memory closes the connection
+*
+* NOTES         Buffered; the daemon loop writes it when the socket takes
+*               it. If the buffer cannot grow, the connection is closed
+*               without its answers rather than sent some of them.
+*
+\**************************************************************************/
+
+void qryout (QryConn *c, const void *p, size_t n) {
+  char   *q;
+  size_t cap;
+  if (c -> fail) return;
+  cap = c -> outcap;
+  while (c -> outlen + n > cap) cap = cap ? 2 * cap : 65536;
+  if (cap != c -> outcap) {
+    if ((q = (char *) realloc (c -> out, cap)) == NULL) {
+      c -> fail   = true;
+      c -> eof    = true;
+      c -> held   = false;
+      c -> inlen  = 0;
+      c -> outlen = c -> outoff = 0;
+      return;
+      }
+    c -> out    = q;
+    c -> outcap = cap;
+    }
+  memcpy (c -> out + c -> outlen, p, n);
+  c -> outlen += n;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qryflush
+*
+* DESCRIPTION   Query daemon batch evaluation of the pending point
+*               queries and their answers.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       qpend    Point queries pending
+*               qnpend   Number of them
+*               qent     Day terms
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         The queries are grouped by their day terms, whatever
+*               connection they came from, and each group is one
+*               noaa_batch () call. The answers go out in query order.
+*
+\**************************************************************************/
+
+void qryflush (void) {
+  static int    ord [QRY_FLUSH];
+  static double w [QRY_FLUSH];
+  static float  col [5][QRY_FLUSH];
+  NoaaCols      cols;
+  QryPend       *q;
+  QryHead       h;
+  char          s [256];
+  int           i, j, k, n;
+  if (qnpend == 0) return;
+  for (i = 0 ; i < qnpend ; i++) ord [i] = i;
+  std :: sort (ord, ord + qnpend, [] (int a, int b) {return (qpend [a].ent < qpend [b].ent);});
+  cols.solarmin = col [0];
+  cols.elev     = col [1];
+  cols.elevc    = col [2];
+  cols.azim     = col [3];
+  cols.sunlong  = col [4];
+  for (i = 0 ; i < qnpend ; i = j) {
+    for (j = i ; (j < qnpend) && (qpend [ord [j]].ent == qpend [ord [i]].ent) ; j++) w [j - i] = qpend [ord [j]].w;
+    noaa_batch (&qent [qpend [ord [i]].ent].day, w, j - i, &cols);
+    for (k = i ; k < j ; k++)
+      for (n = 0 ; n < 5 ; n++) qpend [ord [k]].r [n] = col [n][k - i];
+    }
+  for (i = 0 ; i < qnpend ; i++) {
+    q = &qpend [i];
+    if (q -> json) {
+      n = snprintf (s, sizeof (s), "{");
+      if (q -> id [0]) n += snprintf (s + n, sizeof (s) - n, "\"id\": %s, ", q -> id);
+      n += snprintf (s + n, sizeof (s) - n, "\"solar\": %.3f, \"elev\": %.4f, \"elevc\": %.4f, \"az\": %.4f, \"sunlong\": %.4f}\n",
+                     q -> r [0], q -> r [1], q -> r [2], q -> r [3], q -> r [4]);
+      qryout (q -> c, s, n);
+      }
+    else {
+      h.magic  = QRY_AMAGIC;
+      h.op     = QRY_POINT;
+      h.status = 0;
+      h.len    = sizeof (q -> r);
+      qryout (q -> c, &h, sizeof (h));
+      qryout (q -> c, q -> r, sizeof (q -> r));
+      }
+    }
+  qnpend = 0;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qrypoint, qryday, qryevents, qryerr
+*
+* DESCRIPTION   Query daemon queries: a point, a day table, the events of
+*               a day; an error answer.
+*
+* ARGUMENTS     c      Connection
+*               json   Line JSON, else binary
+*               id     JSON id as given, empty if none
+*               ent    Day terms
+*               w      Point: time [Fraction of the day]
+*               user   Events: user-defined elevation threshold [Degrees]
+*               op     Error: query
+*               msg    Error: message
+*
+* GLOBALS       qpend    Point queries pending
+*               qnpend   Number of them
+*               qent     Day terms
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         A point query waits for qryflush (); the others flush
+*               the pending ones first to keep the answers in order. A
+*               day table is computed once per day terms and kept with
+*               them.
+*
+\**************************************************************************/
+
+void qrypoint (QryConn *c, bool json, const char *id, int ent, double w) {
+  QryPend *q;
+  if (qnpend == QRY_FLUSH) qryflush ();
+  q = &qpend [qnpend++];
+  q -> c    = c;
+  q -> json = json;
+  q -> ent  = ent;
+  q -> w    = w;
+  snprintf (q -> id, sizeof (q -> id), "%s", id);
+  }
+
+void qryday (QryConn *c, bool json, const char *id, int ent) {
+  static const char *name [5] = {"solar", "elev", "elevc", "az", "sunlong"};
+  QryEnt   *e;
+  QryHead  h;
+  NoaaCols cols;
+  double   w [1440];
+  float    *col [5];
+  char     s [64];
+  int      i, k, n;
+  qryflush ();
+  e = &qent [ent];
+  if (e -> tab == NULL) e -> tab = new DayTab;
+  if (! e -> tabok) {
+    for (i = 0 ; i < 1440 ; i++) w [i] = (double) i / 1440.0;
+    cols.solarmin = e -> tab -> solarmin;
+    cols.elev     = e -> tab -> elev;
+    cols.elevc    = e -> tab -> elevc;
+    cols.azim     = e -> tab -> azim;
+    cols.sunlong  = e -> tab -> sunlong;
+    noaa_batch (&e -> day, w, 1440, &cols);
+    e -> tabok = true;
+    }
+  col [0] = e -> tab -> solarmin;
+  col [1] = e -> tab -> elev;
+  col [2] = e -> tab -> elevc;
+  col [3] = e -> tab -> azim;
+  col [4] = e -> tab -> sunlong;
+  if (! json) {
+    h.magic  = QRY_AMAGIC;
+    h.op     = QRY_DAY;
+    h.status = 0;
+    h.len    = 5 * 1440 * sizeof (float);
+    qryout (c, &h, sizeof (h));
+    for (k = 0 ; k < 5 ; k++) qryout (c, col [k], 1440 * sizeof (float));
+    return;
+    }
+  qryout (c, "{", 1);
+  if (id [0]) {
+    n = snprintf (s, sizeof (s), "\"id\": %s, ", id);
+    qryout (c, s, n);
+    }
+  for (k = 0 ; k < 5 ; k++) {
+    n = snprintf (s, sizeof (s), "%s\"%s\": [", k ? "], " : "", name [k]);
+    qryout (c, s, n);
+    for (i = 0 ; i < 1440 ; i++) {
+      n = snprintf (s, sizeof (s), i ? ", %.4f" : "%.4f", col [k][i]);
+      qryout (c, s, n);
+      }
+    }
+  qryout (c, "]}\n", 3);
+  }
+
+void qryevents (QryConn *c, bool json, const char *id, int ent, double user) {
+  static const char *name [3] = {"thresh", "rise", "set"};
+  SunEvents ev;
+  QryHead   h;
+  double    *v [3];
+  char      s [64];
+  int       i, k, n;
+  qryflush ();
+  noaa_events (&qent [ent].day, user, &ev);
+  if (! json) {
+    h.magic  = QRY_AMAGIC;
+    h.op     = QRY_EVENTS;
+    h.status = 0;
+    h.len    = sizeof (ev);
+    qryout (c, &h, sizeof (h));
+    qryout (c, &ev, sizeof (ev));
+    return;
+    }
+  qryout (c, "{", 1);
+  if (id [0]) {
+    n = snprintf (s, sizeof (s), "\"id\": %s, ", id);
+    qryout (c, s, n);
+    }
+  n = snprintf (s, sizeof (s), "\"noon\": %.6f, \"noonelev\": %.4f, ", ev.noon_day, ev.noonelev_deg);
+  qryout (c, s, n);
+  if (ev.midnight_day == ev.midnight_day) n = snprintf (s, sizeof (s), "\"midnight\": %.6f, ", ev.midnight_day);
+  else                                    n = snprintf (s, sizeof (s), "\"midnight\": null, ");
+  qryout (c, s, n);
+  n = snprintf (s, sizeof (s), "\"midnightelev\": %.4f", ev.midnightelev_deg);
+  qryout (c, s, n);
+  v [0] = ev.thresh_deg;
+  v [1] = ev.rise_day;
+  v [2] = ev.set_day;
+  for (k = 0 ; k < 3 ; k++) {
+    n = snprintf (s, sizeof (s), ", \"%s\": [", name [k]);
+    qryout (c, s, n);
+    for (i = 0 ; i < NTHRESH ; i++) {
+      if (v [k][i] == v [k][i]) n = snprintf (s, sizeof (s), "%s%.6f", i ? ", " : "", v [k][i]);
+      else                      n = snprintf (s, sizeof (s), "%snull", i ? ", " : "");
+      qryout (c, s, n);
+      }
+    qryout (c, "]", 1);
+    }
+  qryout (c, ", \"polar\": [", 12);
+  for (i = 0 ; i < NTHRESH ; i++) {
+    n = snprintf (s, sizeof (s), "%s%d", i ? ", " : "", ev.polar [i]);
+    qryout (c, s, n);
+    }
+  qryout (c, "]}\n", 3);
+  }
+
+void qryerr (QryConn *c, bool json, const char *id, int op, const char *msg) {
+  QryHead h;
+  char    s [256];
+  int     n;
+  qryflush ();
+  if (! json) {
+    h.magic  = QRY_AMAGIC;
+    h.op     = op;
+    h.status = 1;
+    h.len    = 0;
+    qryout (c, &h, sizeof (h));
+    return;
+    }
+  n = snprintf (s, sizeof (s), "{");
+  if (id [0]) n += snprintf (s + n, sizeof (s) - n, "\"id\": %s, ", id);
+  n += snprintf (s + n, sizeof (s) - n, "\"error\": \"%s\"}\n", msg);
+  qryout (c, s, n);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      jsonget
+*
+* DESCRIPTION   Value of a key in a flat JSON object.
+*
+* ARGUMENTS     ln    JSON object on one line
+*               key   Key
+*               v     Value as written, a string with its quotes
+*               n     Size of v
+*
+* GLOBALS       -
+*
+* RETURNS       true if found and fitting in v
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Just enough for the query daemon's flat objects of
+*               numbers and strings without escapes.
+*
+\**************************************************************************/
+
+bool jsonget (const char *ln, const char *key, char *v, int n) {
+  const char *p, *e;
+  size_t     k;
+  k = strlen (key);
+  for (p = strchr (ln, '"') ; p != NULL ; p = strchr (p + 1, '"')) {
+    if ((strncmp (p + 1, key, k) != 0) || (p [k + 1] != '"')) continue;
+    for (e = p + k + 2 ; (*e == ' ') || (*e == '\t') ; e++) ;
+    if (*e != ':') continue;
+    for (p = e + 1 ; (*p == ' ') || (*p == '\t') ; p++) ;
+    if (*p == '"') e = strchr (p + 1, '"');
+    else           for (e = p ; (*e != 0) && (*e != ',') && (*e != '}') && (*e != ' ') ; e++) ;
+    if ((e == NULL) || (e == p)) return (false);
+    if (*p == '"') e++;
+    if (e - p >= n) return (false);
+    memcpy (v, p, e - p);
+    v [e - p] = 0;
+    return (true);
+    }
+  return (false);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      jsonid
+*
+* DESCRIPTION   Check of a request id to be echoed.
+*
+* ARGUMENTS     v   Value as written, from jsonget ()
+*
+* GLOBALS       -
+*
+* RETURNS       true for a JSON number or a string without escapes and
+*               control characters
+*
+* HISTORY       2026 10 16   JPT   Created
+*
+* NOTES         The id goes back into the answer as written, so anything
+*               else could inject keys or break the answer line.
+*
+\**************************************************************************/
+
+bool jsonid (const char *v) {
+  const char *p;
+  size_t     n;
+  n = strlen (v);
+  if (v [0] == '"') {
+    if ((n < 2) || (v [n - 1] != '"')) return (false);
+    for (p = v + 1 ; p < v + n - 1 ; p++) if ((*p == '\\') || (*p == '"') || ((unsigned char) *p < 0x20)) return (false);
+    return (true);
+    }
+  p = v;
+  if (*p == '-') p++;
+  if (*p == '0') p++;
+  else if ((*p >= '1') && (*p <= '9')) while ((*p >= '0') && (*p <= '9')) p++;
+  else return (false);
+  if (*p == '.') {
+    if ((p [1] < '0') || (p [1] > '9')) return (false);
+    for (p++ ; (*p >= '0') && (*p <= '9') ; p++) ;
+    }
+  if ((*p == 'e') || (*p == 'E')) {
+    p++;
+    if ((*p == '+') || (*p == '-')) p++;
+    if ((*p < '0') || (*p > '9')) return (false);
+    while ((*p >= '0') && (*p <= '9')) p++;
+    }
+  return (*p == 0);
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qryjson, qrybin
+*
+* DESCRIPTION   Query daemon request, line JSON or binary.
+*
+* ARGUMENTS     c    Connection
+*               ln   JSON object on one line
+*               r    Binary request
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Non-finite fields rejected
+*               2026 10 16   JPT   id checked before it is echoed
+*
+* NOTES         JSON: "op" point (default), day or events; "lat", "lon";
+*               a point has "t", UTC as Unix seconds or as
+*               "yyyy-mm-ddThh:mm:ssZ"; a day table and events have
+*               "date" "yyyy-mm-dd" and "tz" hours (default 0); events
+*               may have "elev", the user-defined threshold; "id", a
+*               number or a string without escapes, is echoed. Point
+*               queries are in UTC, so their day terms are shared by all
+*               times of a UTC day. A field that is NaN, infinite or out
+*               of range is an error: a NaN key would never be found
+*               again, only evict day terms in use.
+*
+\**************************************************************************/
+
+void qryjson (QryConn *c, char *ln) {
+  char   v [64], id [40], op [16];
+  double la, lo, tz, user, date_d, w, sec;
+  int    y, m, dd, hh, mi, ope;
+  QDate  qd;
+  while ((*ln == ' ') || (*ln == '\t')) ln++;
+  if ((*ln == 0) || (*ln == '\r')) return;
+  id [0] = 0;
+  if (jsonget (ln, "id", v, sizeof (id))) {
+    if (! jsonid (v)) {
+      qryerr (c, true, "", 0, "id not a number or a string without escapes");
+      return;
+      }
+    strcpy (id, v);
+    }
+  strcpy (op, "point");
+  if (jsonget (ln, "op", v, sizeof (v)) && (v [0] == '"') && (strlen (v) < sizeof (op) + 1)) {
+    strcpy (op, v + 1);
+    op [strlen (op) - 1] = 0;
+    }
+  if      (strcmp (op, "point")  == 0) ope = QRY_POINT;
+  else if (strcmp (op, "day")    == 0) ope = QRY_DAY;
+  else if (strcmp (op, "events") == 0) ope = QRY_EVENTS;
+  else {
+    qryerr (c, true, id, 0, "unknown op");
+    return;
+    }
+  if ((! jsonget (ln, "lat", v, sizeof (v))) || (sscanf (v, "%lf", &la) != 1) || (! (fabs (la) <= 90)) ||
+      (! jsonget (ln, "lon", v, sizeof (v))) || (sscanf (v, "%lf", &lo) != 1) || (! (fabs (lo) <= 180))) {
+    qryerr (c, true, id, ope, "lat or lon missing or out of range");
+    return;
+    }
+  if (ope == QRY_POINT) {
+    if (! jsonget (ln, "t", v, sizeof (v))) {
+      qryerr (c, true, id, ope, "t missing");
+      return;
+      }
+    if (v [0] == '"') {
+      qd = QDate ();
+      if ((sscanf (v + 1, "%d-%d-%dT%d:%d:%lf", &y, &m, &dd, &hh, &mi, &sec) == 6) &&
+          (hh >= 0) && (hh <= 23) && (mi >= 0) && (mi <= 59) && (sec >= 0) && (sec < 61)) qd = QDate (y, m, dd);
+      if (! qd.isValid ()) {
+        qryerr (c, true, id, ope, "t not yyyy-mm-ddThh:mm:ssZ");
+        return;
+        }
+      date_d = QDate (1900, 1, 1).daysTo (qd) + 2;
+      w      = (3600.0 * hh + 60.0 * mi + sec) / 86400;
+      }
+    else {
+      if ((sscanf (v, "%lf", &sec) != 1) || (! isfinite (sec))) {
+        qryerr (c, true, id, ope, "t not a number");
+        return;
+        }
+      date_d = floor (sec / 86400);
+      w      = sec / 86400 - date_d;
+      date_d += 25569;
+      }
+    qrypoint (c, true, id, qryget (la, lo, date_d, 0), w);
+    return;
+    }
+  qd = QDate ();
+  if (jsonget (ln, "date", v, sizeof (v)) && (sscanf (v, "\"%d-%d-%d\"", &y, &m, &dd) == 3)) qd = QDate (y, m, dd);
+  if (! qd.isValid ()) {
+    qryerr (c, true, id, ope, "date missing or not yyyy-mm-dd");
+    return;
+    }
+  tz = 0;
+  if (jsonget (ln, "tz", v, sizeof (v)) && ((sscanf (v, "%lf", &tz) != 1) || (! (fabs (tz) <= 14)))) {
+    qryerr (c, true, id, ope, "tz out of range");
+    return;
+    }
+  date_d = QDate (1900, 1, 1).daysTo (qd) + 2;
+  if (ope == QRY_DAY) {
+    qryday (c, true, id, qryget (la, lo, date_d, tz));
+    return;
+    }
+  user = 0;
+  if (jsonget (ln, "elev", v, sizeof (v)) && ((sscanf (v, "%lf", &user) != 1) || (! (fabs (user) <= 90)))) {
+    qryerr (c, true, id, ope, "elev out of range");
+    return;
+    }
+  qryevents (c, true, id, qryget (la, lo, date_d, tz), user);
+  }
+
+void qrybin (QryConn *c, const QryReq *r) {
+  double date_d;
+  if ((r -> magic != QRY_MAGIC) || (! (fabs (r -> lat_deg) <= 90)) || (! (fabs (r -> long_deg) <= 180)) || (! isfinite (r -> t)) ||
+      ((r -> op != QRY_POINT) && (! (fabs (r -> timezone_hr) <= 14))) || ((r -> op == QRY_EVENTS) && (! (fabs (r -> user_deg) <= 90)))) {
+    qryerr (c, false, "", r -> op, NULL);
+    return;
+    }
+  switch (r -> op) {
+    case QRY_POINT:
+      date_d = floor (r -> t / 86400);
+      qrypoint (c, false, "", qryget (r -> lat_deg, r -> long_deg, date_d + 25569, 0), r -> t / 86400 - date_d);
+      break;
+    case QRY_DAY:
+      qryday (c, false, "", qryget (r -> lat_deg, r -> long_deg, floor (r -> t), r -> timezone_hr));
+      break;
+    case QRY_EVENTS:
+      qryevents (c, false, "", qryget (r -> lat_deg, r -> long_deg, floor (r -> t), r -> timezone_hr), r -> user_deg);
+      break;
+    default:
+      qryerr (c, false, "", r -> op, NULL);
+    }
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      qryinput
+*
+* DESCRIPTION   Query daemon requests received on a connection.
+*
+* ARGUMENTS     c   Connection
+*
+* GLOBALS       -
+*
+* RETURNS       -
+*
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 16   JPT   Held at QRY_OUTMAX bytes of unsent answers
+*
+* NOTES         The first byte sets the protocol: N, the first of the
+*               binary magic, for binary, anything else for line JSON.
+*               Complete requests are taken, a partial one waits for the
+*               rest. An overlong line closes the connection. At
+*               QRY_OUTMAX bytes of unsent answers the rest are held in
+*               in until the daemon loop has written them.
+*
+\**************************************************************************/
+
+void qryinput (QryConn *c) {
+  QryReq r;
+  char   *e;
+  size_t o;
+  if ((c -> mode == 0) && (c -> inlen > 0)) c -> mode = (c -> in [0] == 'N') ? 2 : 1;
+  o = 0;
+  c -> held = false;
+  if (c -> mode == 1) {
+    while ((e = (char *) memchr (c -> in + o, '\n', c -> inlen - o)) != NULL) {
+      if (c -> outlen - c -> outoff > QRY_OUTMAX) {
+        c -> held = true;
+        break;
+        }
+      *e = 0;
+      qryjson (c, c -> in + o);
+      if (c -> fail) return;
+      o = e - c -> in + 1;
+      }
+    if ((! c -> held) && (c -> inlen - o > 65536)) {
+      c -> eof = true;
+      o = c -> inlen;
+      }
+    }
+  else if (c -> mode == 2) {
+    for ( ; c -> inlen - o >= sizeof (r) ; o += sizeof (r)) {
+      if (c -> outlen - c -> outoff > QRY_OUTMAX) {
+        c -> held = true;
+        break;
+        }
+      memcpy (&r, c -> in + o, sizeof (r));
+      qrybin (c, &r);
+      if (c -> fail) return;
+      }
+    }
+  memmove (c -> in, c -> in + o, c -> inlen - o);
+  c -> inlen -= o;
+  }
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      serve
 *
-* DESCRIPTION   Display painting callback.
+* DESCRIPTION   Solar query daemon on a Unix domain socket.
 *
-* ARGUMENTS     e   Paint event
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -serve socket
 *
-* GLOBALS       painter   Qt painter object
+* GLOBALS       quitreq   Stop request
+*               qent      Day terms
+*               qhash     Hash chain heads
 *
-* RETURNS       -
+* RETURNS       Exit value, -1 for bad arguments
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
 *
-* NOTES         -
+* NOTES         One thread polling every connection. A round reads what
+*               every connection has sent before evaluating, so queries
+*               arriving together from several clients share batches.
+*               A connection whose answers are not being read stops
+*               being read from at QRY_OUTMAX bytes of them. Stopped by
+*               SIGINT or SIGTERM, when the socket file is removed.
+*               Requests held by qryinput () are taken up again once the
+*               answers before them have been written, without waiting
+*               for more input.
 *
 \**************************************************************************/
 
-void DispWidget :: paintEvent (QPaintEvent *e) {
-  QRect r (0, 0, 1920, 1080);
-  painter -> begin (this);
-  painter -> fillRect (0, 0, 1919, 1079, QColor (0, 0, 0));
-  upd ();
-  painter -> end ();
+int serve (int argc, char *argv []) {
+  struct sockaddr_un sa;
+  struct pollfd      pfd [QRY_CONNS + 1];
+  QryConn            *conn, *c;
+  char               buf [65536], *q;
+  ssize_t            r;
+  int                lfd, fd, i, nc, ms;
+  if ((argc != 3) || (strlen (argv [2]) >= sizeof (sa.sun_path))) return (-1);
+  memset (&sa, 0, sizeof (sa));
+  sa.sun_family = AF_UNIX;
+  strcpy (sa.sun_path, argv [2]);
+  unlink (argv [2]);
+  lfd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if ((lfd < 0) || (bind (lfd, (struct sockaddr *) &sa, sizeof (sa)) != 0) || (listen (lfd, 64) != 0)) {
+    printf ("Cannot listen on '%s'.\n", argv [2]);
+    return (1);
+    }
+  fcntl (lfd, F_SETFL, O_NONBLOCK);
+  signal (SIGINT,  onstop);
+  signal (SIGTERM, onstop);
+  signal (SIGPIPE, SIG_IGN);
+  qent = new QryEnt [QRY_LRU];
+  for (i = 0 ; i < QRY_HASH ; i++) qhash [i] = -1;
+  conn = new QryConn [QRY_CONNS];
+  nc   = 0;
+  while (! quitreq) {
+    pfd [0].fd     = lfd;
+    pfd [0].events = (nc < QRY_CONNS) ? POLLIN : 0;
+    ms = 500;
+    for (i = 0 ; i < nc ; i++) {
+      c = &conn [i];
+      pfd [i + 1].fd     = c -> fd;
+      pfd [i + 1].events = ((c -> eof || (c -> outlen - c -> outoff > QRY_OUTMAX) || (c -> inlen > QRY_OUTMAX)) ? 0 : POLLIN) |
+                           ((c -> outlen > c -> outoff) ? POLLOUT : 0);
+      if (c -> held && (c -> outlen - c -> outoff <= QRY_OUTMAX)) ms = 0;
+      }
+    if (poll (pfd, nc + 1, ms) < 0) continue;
+
+    // Requests of every connection, then their evaluation
+
+    for (i = 0 ; i < nc ; i++) {
+      c = &conn [i];
+      if (((pfd [i + 1].events & POLLIN) == 0) || ((pfd [i + 1].revents & (POLLIN | POLLHUP | POLLERR)) == 0)) {
+        if (c -> held && (c -> outlen - c -> outoff <= QRY_OUTMAX)) qryinput (c);
+        continue;
+        }
+      while ((r = read (c -> fd, buf, sizeof (buf))) > 0) {
+        if (c -> inlen + r > c -> incap) {
+          if ((q = (char *) realloc (c -> in, c -> inlen + r + 65536)) == NULL) {
+            c -> fail   = true;
+            c -> eof    = true;
+            c -> held   = false;
+            c -> inlen  = 0;
+            c -> outlen = c -> outoff = 0;
+            break;
+            }
+          c -> in    = q;
+          c -> incap = c -> inlen + r + 65536;
+          }
+        memcpy (c -> in + c -> inlen, buf, r);
+        c -> inlen += r;
+        if (c -> inlen > QRY_OUTMAX) break;
+        }
+      if (c -> fail) continue;
+      if ((r == 0) || ((r < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))) c -> eof = true;
+      qryinput (c);
+      }
+    qryflush ();
+
+    // Answers, closing, new connections
+
+    for (i = 0 ; i < nc ; i++) {
+      c = &conn [i];
+      while (c -> outoff < c -> outlen) {
+        r = write (c -> fd, c -> out + c -> outoff, c -> outlen - c -> outoff);
+        if (r > 0) {
+          c -> outoff += r;
+          continue;
+          }
+        if ((r < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+          c -> eof    = true;
+          c -> held   = false;
+          c -> inlen  = 0;
+          c -> outoff = c -> outlen;
+          }
+        break;
+        }
+      if (c -> outoff == c -> outlen) c -> outoff = c -> outlen = 0;
+      }
+    for (i = nc - 1 ; i >= 0 ; i--) {
+      c = &conn [i];
+      if ((! c -> eof) || (c -> outlen > 0) || c -> held) continue;
+      close (c -> fd);
+      free (c -> in);
+      free (c -> out);
+      *c = conn [--nc];
+      }
+    if (pfd [0].revents & POLLIN) {
+      while ((nc < QRY_CONNS) && ((fd = accept (lfd, NULL, NULL)) >= 0)) {
+        fcntl (fd, F_SETFL, O_NONBLOCK);
+        memset (&conn [nc], 0, sizeof (QryConn));
+        conn [nc++].fd = fd;
+        }
+      }
+    }
+  for (i = 0 ; i < nc ; i++) close (conn [i].fd);
+  close (lfd);
+  unlink (argv [2]);
+  return (0);
   }
 
 
 
 /**************************************************************************\
 *
-* FUNCTION      noaa_eq
+* FUNCTION      qryconnect, qrysend
 *
-* DESCRIPTION   NOAA solar euations.
+* DESCRIPTION   Query client connection, sending all of a buffer.
 *
-* ARGUMENTS     -
+* ARGUMENTS     path   Socket
+*               fd     Connection
+*               p      Bytes
+*               n      Byte count
 *
-* GLOBALS       (See Global variable file section)
+* GLOBALS       -
 *
-* RETURNS       -
+* RETURNS       qryconnect (): connection, -1 on failure
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
 *
 * NOTES         -
 *
 \**************************************************************************/
 
-void noaa_eq (void) {
-  jday = date_d + 2415018.5 + wtime_day - timezone_hr / 24;
-  jcen = (jday - 2451545) / 36525;
-  gmlong_deg   = fmod (280.46646 + jcen * (36000.76983 + jcen * 0.0003032), 360.0);
-  gmanom_deg   = 357.52911 + jcen * (35999.05029 - 0.0001537 * jcen);
-  eccent       = 0.016708634 - jcen  * (0.000042037 + 0.0000001267 * jcen);
-  eqofctr      =   sin (d2r (gmanom_deg)) * (1.914602 - jcen * (0.004817 + 0.000014 * jcen))
-                 + sin (d2r (2 * gmanom_deg)) * (0.019993 - 0.000101 * jcen)
-                 + sin (d2r (3 * gmanom_deg)) * 0.000289;
-  truelong_deg = gmlong_deg + eqofctr;
-  trueanom_deg = gmanom_deg + eqofctr;
-  radvect_au   = (1.000001018 * (1 - eccent * eccent)) / (1 + eccent * cos (d2r (trueanom_deg)));
-  applong_deg  = truelong_deg - 0.00569 - 0.00478 * sin (d2r (125.04 - 1934.136 * jcen));
-  moe_deg      = 23 + (26 + ((21.448 - jcen * (46.815 + jcen * (0.00059 - jcen * 0.001813)))) / 60) / 60;
-  ocorr_deg    = moe_deg + 0.00256 * cos (d2r (125.04 - 1934.136 * jcen));
-  rtasc_deg    = r2d (atan2 (cos (d2r (applong_deg)), cos (d2r (ocorr_deg)) * sin (d2r (applong_deg))));
-  decl_deg     = r2d (asin (sin (d2r (ocorr_deg)) * sin (d2r (applong_deg))));
-  var_y        = tan (d2r (ocorr_deg / 2)) * tan (d2r (ocorr_deg / 2));
-  eqoftime_min =   4 * r2d (var_y * sin (2 *d2r (gmlong_deg))
-                 - 2 * eccent * sin (d2r (gmanom_deg))
-                 + 4 * eccent * var_y * sin (d2r (gmanom_deg)) * cos (2 * d2r (gmlong_deg))
-                 - 0.5 * var_y * var_y * sin (4 * d2r (gmlong_deg))
-                 - 1.25 * eccent * eccent * sin (2 * d2r (gmanom_deg)));
-  ha_rise_deg  = r2d (acos (cos (d2r (90.833)) / (cos (d2r (lat_deg)) * cos (d2r (decl_deg))) - tan (d2r (lat_deg)) * tan (d2r (decl_deg))));
-  noon_lst     = (720 - 4 * long_deg  - eqoftime_min + timezone_hr * 60) / 1440;
-  rise_lst     = noon_lst - ha_rise_deg * 4 / 1440;
-  set_lst      = noon_lst + ha_rise_deg * 4 / 1440;
-  lightdur_min = 8 * ha_rise_deg;
-  soltime_min  = fmod ((wtime_day * 1440 + eqoftime_min + 4 * long_deg - 60 * timezone_hr), 1440.0);
-  hrangle_deg  = (soltime_min / 4 < 0) ? (soltime_min / 4 + 180) : (soltime_min / 4 - 180);
-  zangle_deg   = r2d (acos (sin (d2r (lat_deg)) * sin (d2r (decl_deg)) + cos (d2r (lat_deg)) * cos (d2r (decl_deg)) * cos (d2r (hrangle_deg))));
-  elev_deg         = 90 - zangle_deg;
-  if (elev_deg > 85) refract_deg = 0;
-  else {
-    if (elev_deg > 5) refract_deg = 58.1 / tan (d2r (elev_deg)) - 0.07 / pow (tan (d2r (elev_deg)), 3) + 0.000086 / pow (tan (d2r (elev_deg)), 5);
-    else {
-      if (elev_deg > -0.575) refract_deg = 1735 + elev_deg * (-518.2 + elev_deg * (103.4 + elev_deg * (-12.79 + elev_deg * 0.711)));
-      else                   refract_deg = -20.772 / tan (d2r (elev_deg));
-      }
+int qryconnect (const char *path) {
+  struct sockaddr_un sa;
+  int                fd;
+  if (strlen (path) >= sizeof (sa.sun_path)) return (-1);
+  memset (&sa, 0, sizeof (sa));
+  sa.sun_family = AF_UNIX;
+  strcpy (sa.sun_path, path);
+  fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if ((fd >= 0) && (connect (fd, (struct sockaddr *) &sa, sizeof (sa)) != 0)) {
+    close (fd);
+    fd = -1;
+    }
+  return (fd);
+  }
+
+void qrysend (int fd, const char *p, size_t n) {
+  ssize_t r;
+  while ((n > 0) && ((r = write (fd, p, n)) > 0)) {
+    p += r;
+    n -= r;
     }
-  refract_deg /= 3600;
-  elevc_deg = elev_deg + refract_deg;
-  if (hrangle_deg > 0)
-    az_deg = fmod ((r2d (acos (((sin (d2r (lat_deg)) * cos (d2r (zangle_deg))) - sin (d2r (decl_deg))) / (cos (d2r (lat_deg)) * sin (d2r (zangle_deg))))) + 180), 360.0);
-  else
-    az_deg = fmod ((540 - r2d (acos (((sin (d2r (lat_deg)) * cos (d2r (zangle_deg))) - sin (d2r (decl_deg))) / (cos (d2r (lat_deg)) * sin (d2r (zangle_deg)))))), 360.0);
   }
 
 
 
 /**************************************************************************\
 *
-* FUNCTION      load
+* FUNCTION      qrybench
 *
-* DESCRIPTION   Saving NOAA equation results into per-minute tables.
+* DESCRIPTION   Query daemon throughput of point queries.
 *
-* ARGUMENTS     -
+* ARGUMENTS     path   Socket
+*               n      Queries per protocol
 *
-* GLOBALS        wtime_day
-*                soltime_min    Solar time in minutes
-*                elev_deg       Elevation of Sun
-*                elevc_deg      Corrected elevation of Sun
-*                az_deg         Azimuth of Sun
-*                truelong_deg   Longitude of Sun
-*                solarmin       Solar time in minutes
-*                elev           Elevation of Sun
-*                elevc          Corrected elevation of Sun
-*                azim           Azimuth of Sun
-*                sunlong        Longitude of Sun
+* GLOBALS       -
 *
-* RETURNS       -
+* RETURNS       Exit value, 0 when every answer came and agreed with
+*               noaa_eq ()
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
 *
-* NOTES         -
+* NOTES         64 locations at random times of two days, sent by one
+*               thread while another reads, binary and then line JSON.
+*               The elevation is checked against noaa_eq () to 0.01
+*               degrees; the difference is that of the tables.
 *
 \**************************************************************************/
 
-void load (void) {
-  int  i;
-  for (i = 0 ; i < 1440 ; i++) {
-    wtime_day = (double) i / 1440.0;
-    noaa_eq ();
-    solarmin [i] = soltime_min;
-    elev     [i] = elev_deg;
-    elevc    [i] = elevc_deg;
-    azim     [i] = az_deg;
-    sunlong  [i] = truelong_deg;
+int qrybench (const char *path, int n) {
+  std :: chrono :: steady_clock :: time_point a;
+  QryReq   *rq;
+  QryHead  *h;
+  NoaaIn   in;
+  NoaaOut  o;
+  char     *ans, *txt, buf [65536];
+  size_t   len, got, tl;
+  ssize_t  r;
+  double   t, e, emax;
+  int      fd, i, k, lines, fail;
+  rq  = new QryReq [n];
+  srand (1);
+  for (i = 0 ; i < n ; i++) {
+    k = rand () % 64;
+    rq [i].magic       = QRY_MAGIC;
+    rq [i].op          = QRY_POINT;
+    rq [i].lat_deg     = -80 + 2.5 * k;
+    rq [i].long_deg    = -175 + 5.5 * k;
+    rq [i].t           = 1781827200.0 + rand () % 172800 + (rand () % 1000) / 1000.0;
+    rq [i].timezone_hr = 0;
+    rq [i].user_deg    = 0;
+    }
+  fail = 0;
+
+  // Binary
+
+  if ((fd = qryconnect (path)) < 0) {
+    printf ("Cannot connect to '%s'.\n", path);
+    delete [] rq;
+    return (1);
+    }
+  len = (size_t) n * (sizeof (QryHead) + 5 * sizeof (float));
+  ans = new char [len];
+  a   = std :: chrono :: steady_clock :: now ();
+  std :: thread wb (qrysend, fd, (const char *) rq, (size_t) n * sizeof (QryReq));
+  for (got = 0 ; (got < len) && ((r = read (fd, ans + got, len - got)) > 0) ; got += r) ;
+  t = std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ();
+  wb.join ();
+  close (fd);
+  emax = 0;
+  for (i = 0 ; (i < n) && (got == len) ; i++) {
+    h = (QryHead *) (ans + i * (sizeof (QryHead) + 5 * sizeof (float)));
+    if ((h -> magic != QRY_AMAGIC) || (h -> status != 0)) {
+      emax = 1e30;
+      break;
+      }
+    in.lat_deg     = rq [i].lat_deg;
+    in.long_deg    = rq [i].long_deg;
+    in.date_d      = floor (rq [i].t / 86400) + 25569;
+    in.wtime_day   = rq [i].t / 86400 - floor (rq [i].t / 86400);
+    in.timezone_hr = 0;
+    o = noaa_eq (&in);
+    e = fabs (((float *) (h + 1)) [1] - o.elev_deg);
+    if (e > emax) emax = e;
+    }
+  if ((got != len) || (emax > 0.01)) fail = 1;
+  printf ("binary      %9d queries %8.3f s %10.0f /s   %s, elevation within %.1e deg of noaa_eq ()\n",
+          n, t, n / t, (got == len) ? "all answered" : "ANSWERS MISSING", emax);
+  delete [] ans;
+
+  // Line JSON
+
+  if ((fd = qryconnect (path)) < 0) {
+    printf ("Cannot connect to '%s'.\n", path);
+    delete [] rq;
+    return (1);
     }
+  txt = new char [(size_t) n * 64];
+  for (tl = 0, i = 0 ; i < n ; i++)
+    tl += sprintf (txt + tl, "{\"lat\": %.2f, \"lon\": %.2f, \"t\": %.3f}\n", rq [i].lat_deg, rq [i].long_deg, rq [i].t);
+  lines = 0;
+  a = std :: chrono :: steady_clock :: now ();
+  std :: thread wj (qrysend, fd, (const char *) txt, tl);
+  while ((lines < n) && ((r = read (fd, buf, sizeof (buf))) > 0))
+    for (k = 0 ; k < r ; k++) if (buf [k] == '\n') lines++;
+  t = std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ();
+  wj.join ();
+  close (fd);
+  if (lines != n) fail = 1;
+  printf ("line JSON   %9d queries %8.3f s %10.0f /s   %s\n", n, t, n / t, (lines == n) ? "all answered" : "ANSWERS MISSING");
+  delete [] txt;
+  delete [] rq;
+  return (fail);
   }
 
 
 
 /**************************************************************************\
 *
-* METHOD        DispWidget :: eloop
+* FUNCTION      query
 *
-* DESCRIPTION   Display update timer response method.
+* DESCRIPTION   Query daemon client.
 *
-* ARGUMENTS     -
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -query socket request|-|-bench n
 *
-* GLOBALS       d
-*               date_d
-*               t
-*               wtime_day
-*               idx
-*               timezone_hr
-*               my_timezone
-*               solarmin      Solar time in minutes
-*               elevc         Elevation of Sun
-*               elevc         Corrected elevation of Sun
-*               azim          Azimuth of Sun
-*               sunlong       Longitude of Sun
-*               cf            Current time display circle fraction
-*               cfs           Current fraction sine
-*               cfc           Current fraction cosine
-*               ce            Current elevation of Sun
-*               cec           Current corrected elevation of Sun
-*               caz           Current azimuth of Sun
-*               csl           Current longitude of Sun
-*               dw            Display widget
+* GLOBALS       -
 *
-* RETURNS       -
+* RETURNS       Exit value, -1 for bad arguments
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
 *
-* NOTES         -
+* NOTES         A request is one JSON line, - sends the lines of standard
+*               input; the answers go to standard output.
 *
 \**************************************************************************/
 
-void DispWidget :: eloop (void) {
-  QDate dd;
-  int   idxw;
-  load ();
-  d = QDate :: currentDate ();
-  dd = QDate (1900, 1, 1);
-  date_d = dd.daysTo (d) + 2;
-  t = QTime :: currentTime ();
-  t = t.addSecs (3600 * (timezone_hr - my_timezone));
-  idxw = 60 * t.hour () + t.minute ();
-  wtime_day = idxw / 1440.0;
-  idx = solarmin [(int) (60 * t.hour () + t.minute ())];
-  cf = idx / 1440.0;
-  cfs = sin (dpi * (- cf + 0.25));
-  cfc = cos (dpi * (- cf + 0.25));
-  caz = azim    [(int) idxw];
-  ce  = elev    [(int) idxw];
-  cec = elevc   [(int) idxw];
-  csl = sunlong [(int) idxw];
-  dw -> repaint ();
+int query (int argc, char *argv []) {
+  char    buf [65536];
+  ssize_t r;
+  int     fd, n;
+  if ((argc == 5) && (strcmp (argv [3], "-bench") == 0)) {
+    if ((sscanf (argv [4], "%d", &n) != 1) || (n < 1)) return (-1);
+    return (qrybench (argv [2], n));
+    }
+  if (argc != 4) return (-1);
+  signal (SIGPIPE, SIG_IGN);
+  if ((fd = qryconnect (argv [2])) < 0) {
+    printf ("Cannot connect to '%s'.\n", argv [2]);
+    return (1);
+    }
+  std :: thread w ([&] {
+    char ln [4096];
+    if (strcmp (argv [3], "-") != 0) {
+      qrysend (fd, argv [3], strlen (argv [3]));
+      qrysend (fd, "\n", 1);
+      }
+    else while (fgets (ln, sizeof (ln), stdin) != NULL) qrysend (fd, ln, strlen (ln));
+    shutdown (fd, SHUT_WR);
+    });
+  while ((r = read (fd, buf, sizeof (buf))) > 0) fwrite (buf, 1, r, stdout);
+  w.join ();
+  close (fd);
+  return (0);
   }
 
+#endif
+
 
 
 /**************************************************************************\
 *
-* FUNCTION      setdst_eu
+* FUNCTION      gen
 *
-* DESCRIPTION   European Union daylight saving time adjustment.
+* DESCRIPTION   Headless generator of per-sample tables for sites and a
+*               date range.
 *
-* ARGUMENTS     -
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -gen from to step csv|bin file
+*                      site [site ...], dates as yyyy-mm-dd, step in
+*                      seconds, file - for standard output, a site as a
+*                      location name or latitude,longitude,timezone
 *
-* GLOBALS        wtime_day
-*                soltime_min    Solar time in minutes
-*                elev_deg       Elevation of Sun
-*                elevc_deg      Corrected elevation of Sun
-*                az_deg         Azimuth of Sun
-*                truelong_deg   Longitude of Sun
-*                solarmin       Solar time in minutes
-*                elev           Elevation of Sun
-*                elevc          Corrected elevation of Sun
-*                azim           Azimuth of Sun
-*                sunlong        Longitude of Sun
+* GLOBALS       -
 *
-* RETURNS       Offset in hours
+* RETURNS       Exit value
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
+*               2026 10 15   JPT   Tiles computed on the work-stealing pool
 *
-* NOTES         -
+* NOTES         Times are the standard time of each site, no daylight
+*               saving time, so that every day has the same samples.
+*               Uses only the NOAA engine, no QApplication. The tiles are
+*               computed a chunk at a time in parallel and written in
+*               site and day order, so the output does not depend on the
+*               thread count.
 *
 \**************************************************************************/
 
-int setdst_eu (void) {
-  QDate d, dmar, doct;
-  QTime t;
-  int   n;
-  d = QDate :: currentDate ();
-  t = QTime :: currentTime ();
-  t = t.addSecs (3600 * (timezone_hr - my_timezone));
-  n = 31;
-  dmar = QDate (d.year (),  3, n);
-  while (dmar.dayOfWeek () != 7) {n--; dmar = QDate (d.year (),  3, n);}
-  n = 31;
-  doct = QDate (d.year (), 10, 31);
-  while (doct.dayOfWeek () != 7) {n--; doct = QDate (d.year (),  10, n);}
-  n = 0;
-  if ((d == dmar) && (t.hour () > 3)) n = 1;
-  if (d > dmar) n = 1;
-  if ((d == doct) && (t.hour () > 3)) n = 0;
-  if (d > doct) n = 0;
-  return (n);
+int gen (int argc, char *argv []) {
+  GenHead  h;
+  GenSite  *site;
+  GenJob   job;
+  QDate    d0, d1, dd;
+  FILE     *f;
+  float    *o;
+  double   *w;
+  int      y, m, dm, step, nsamp, nsite, ntile, nchunk, n, bin, i, s, t, sec;
+  if (argc < 8) return (-1);
+  if (sscanf (argv [2], "%d-%d-%d", &y, &m, &dm) != 3) return (-1);
+  d0 = QDate (y, m, dm);
+  if (sscanf (argv [3], "%d-%d-%d", &y, &m, &dm) != 3) return (-1);
+  d1 = QDate (y, m, dm);
+  step = atoi (argv [4]);
+  if ((! d0.isValid ()) || (! d1.isValid ()) || (d1 < d0) || (step < 1) || (step > 86400)) return (-1);
+  if      (strcmp (argv [5], "bin") == 0) bin = 1;
+  else if (strcmp (argv [5], "csv") == 0) bin = 0;
+  else return (-1);
+  nsite = argc - 7;
+  site  = new GenSite [nsite];
+  for (s = 0 ; s < nsite ; s++) {
+    if (getsite (argv [7 + s], &site [s]) == false) {
+      fprintf (stderr, "'%s' is an unknown location.\n", argv [7 + s]);
+      delete [] site;
+      return (1);
+      }
+    }
+  if (strcmp (argv [6], "-") == 0) f = stdout;
+  else                             f = fopen (argv [6], bin ? "wb" : "w");
+  if (f == NULL) {
+    fprintf (stderr, "Cannot open '%s'.\n", argv [6]);
+    delete [] site;
+    return (1);
+    }
+  setvbuf (f, NULL, _IOFBF, 1 << 20);
+  nsamp  = (86400 + step - 1) / step;
+  ntile  = nsite * (d0.daysTo (d1) + 1);
+  nchunk = (1 << 24) / (5 * nsamp);                  // 64 MB of columns per chunk
+  if (nchunk < 1) nchunk = 1;
+  w = new double [nsamp];
+  for (i = 0 ; i < nsamp ; i++) w [i] = (double) i * step / 86400.0;
+  job.site    = site;
+  job.w       = w;
+  job.date0_d = QDate (1900, 1, 1).daysTo (d0) + 2;
+  job.nday    = d0.daysTo (d1) + 1;
+  job.nsamp   = nsamp;
+  job.out     = new float [(long long) 5 * nsamp * ((ntile < nchunk) ? ntile : nchunk)];
+  if (bin) {
+    memcpy (h.magic, "NOAAGEN1", 8);
+    h.nsite   = nsite;
+    h.nday    = job.nday;
+    h.nsamp   = nsamp;
+    h.step_s  = step;
+    h.date0_d = job.date0_d;
+    fwrite (&h, sizeof (h), 1, f);
+    fwrite (site, sizeof (GenSite), nsite, f);
+    }
+  else fprintf (f, "site,date,time,solar_min,elev_deg,elevc_deg,azim_deg,sunlong_deg\n");
+  for (job.tile0 = 0 ; job.tile0 < ntile ; job.tile0 += nchunk) {
+    n = ntile - job.tile0;
+    if (n > nchunk) n = nchunk;
+    parrun (n, 0, gentile, &job);
+    if (bin) {
+      fwrite (job.out, sizeof (float), (size_t) 5 * nsamp * n, f);
+      continue;
+      }
+    for (t = 0 ; t < n ; t++) {
+      s  = (job.tile0 + t) / job.nday;
+      dd = d0.addDays ((job.tile0 + t) % job.nday);
+      o  = job.out + (long long) t * 5 * nsamp;
+      for (i = 0 ; i < nsamp ; i++) {
+        sec = i * step;
+        fprintf (f, "\"%s\",%04d-%02d-%02d,%02d:%02d:%02d,%.3f,%.4f,%.4f,%.4f,%.4f\n", site [s].name,
+                 dd.year (), dd.month (), dd.day (), sec / 3600, (sec / 60) % 60, sec % 60,
+                 o [i], o [nsamp + i], o [2 * nsamp + i], o [3 * nsamp + i], o [4 * nsamp + i]);
+        }
+      }
+    }
+  if (f != stdout) fclose (f);
+  else             fflush (f);
+  delete [] job.out;
+  delete [] w;
+  delete [] site;
+  return (0);
   }
 
 
 
 /**************************************************************************\
 *
-* FUNCTION      showlocs
+* FUNCTION      chebgen
 *
-* DESCRIPTION   Listing of locations in the configuration file.
+* DESCRIPTION   Chebyshev ephemeris generator.
 *
-* ARGUMENTS     -
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: -cheb [file]
 *
 * GLOBALS       -
 *
-* RETURNS       -
+* RETURNS       Exit value
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
 *
-* NOTES         -
+* NOTES         Writes the C++ table included as noaa_cheb.h, by default
+*               to noaa_cheb.h, and verifies it against the full series.
+*               The ephemeris is set by CHEB_JD0, CHEB_JD1, CHEB_SEG and
+*               CHEB_N; after changing them the table is regenerated by a
+*               build with NOAA_NOCHEB defined.
 *
 \**************************************************************************/
 
-void showlocs (void) {
-  FILE *f;
-  char line [256];
-  f = fopen ("noaa_clock.cnf", "r");
-  if (f) {
-    char rloc [256];
-    printf ("Currently known locations are: ");
-    while (! feof (f)) {
-      fgets (line, 252, f);
-      if (strchr (line, '*')) break;
-      sscanf (line, "%s", rloc);
-      printf ("%s ", rloc);
+int chebgen (int argc, char *argv []) {
+  const char  *fn;
+  float       (*tab) [4][CHEB_N];
+  double      emax [4];
+  int         nseg, k, q, j;
+  bool        ok;
+  FILE        *f;
+  if (argc > 3) return (-1);
+  fn   = (argc > 2) ? argv [2] : "noaa_cheb.h";
+  nseg = (int) ceil ((CHEB_JD1 - CHEB_JD0) / CHEB_SEG);
+  tab  = new float [nseg][4][CHEB_N];
+  for (k = 0 ; k < nseg ; k++) noaa_chebfit (CHEB_JD0 + k * CHEB_SEG, tab [k]);
+  ok = noaa_chebcheck (tab, nseg, emax);
+  printf ("%d segments of %d days, %d coefficients, %lu bytes\n", nseg, CHEB_SEG, CHEB_N, (unsigned long) (nseg * sizeof (tab [0])));
+  printf ("  %-26s max error %.2e\n", "declination [deg]", emax [0]);
+  printf ("  %-26s max error %.2e\n", "equation of time [min]", emax [1]);
+  printf ("  %-26s max error %.2e\n", "true longitude [deg]", emax [2]);
+  printf ("  %-26s max error %.2e\n", "radius vector [AU]", emax [3]);
+  if (! ok) {
+    printf ("FAILED, %s not written\n", fn);
+    delete [] tab;
+    return (1);
+    }
+  f = fopen (fn, "w");
+  if (f == NULL) {
+    fprintf (stderr, "Cannot write '%s'.\n", fn);
+    delete [] tab;
+    return (1);
+    }
+  fprintf (f, "// Chebyshev ephemeris of the NOAA solar equations, generated by noaa_clock -cheb\n");
+  fprintf (f, "// from Julian day %.1f in segments of %d days, %d coefficients per quantity.\n", CHEB_JD0, CHEB_SEG, CHEB_N);
+  fprintf (f, "// Per segment: declination [deg], equation of time [min], equation of centre\n");
+  fprintf (f, "// [deg], radius vector [AU]. Do not edit.\n\n");
+  fprintf (f, "static const float cheb_tab [%d][4][%d] = {\n", nseg, CHEB_N);
+  for (k = 0 ; k < nseg ; k++) {
+    fprintf (f, "  {");
+    for (q = 0 ; q < 4 ; q++) {
+      fprintf (f, "{");
+      for (j = 0 ; j < CHEB_N ; j++) fprintf (f, "%.8e%s", tab [k][q][j], (j < CHEB_N - 1) ? "," : "");
+      fprintf (f, "}%s", (q < 3) ? "," : "");
       }
+    fprintf (f, "}%s\n", (k < nseg - 1) ? "," : "");
     }
-  printf ("\n\n");
-  fclose (f);
+  fprintf (f, "  };\n");
+  ok = (fclose (f) == 0);
+  if (ok) printf ("%s written\n", fn);
+  else    fprintf (stderr, "Cannot write '%s'.\n", fn);
+  delete [] tab;
+  return (ok ? 0 : 1);
   }
 
 
 
 /**************************************************************************\
 *
-* FUNCTION      setcoord
+* FUNCTION      scaling
 *
-* DESCRIPTION   Location to coordinate pair.
+* DESCRIPTION   Scaling benchmark of the work-stealing pool from one thread
+*               to the hardware concurrency.
 *
-* ARGUMENTS      loc   Location name
-*                la    Latitude [Decimal degrees]
-*                lo    Longitude [Decimal degrees]
-*                tz    Timezone [Hours]
+* ARGUMENTS     -
 *
-* GLOBALS       -
+* GLOBALS       use_avx2   Batch evaluation by the AVX2 kernel
 *
-* RETURNS       -
+* RETURNS       Exit value, 0 when every thread count gave the output of
+*               one thread
 *
-* HISTORY       2016 05 24   JPT   File documenting begins
+* HISTORY       2026 10 15   JPT   Created
 *
-* NOTES         -
+* NOTES         32 sites pole to pole over 92 days at one minute, best of
+*               three runs per thread count.
 *
 \**************************************************************************/
 
-bool setcoord (char *loc, double *la, double *lo, double *tz) {
+int scaling (void) {
+  GenSite site [32];
+  GenJob  job;
+  double  w [1440], t, t1;
+  float   *ref;
+  size_t  sz;
+  int     i, r, nthr, nmax, ntile, fail;
+  std :: chrono :: steady_clock :: time_point a;
+  for (i = 0 ; i < 32 ; i++) {
+    sprintf (site [i].name, "%d", i);
+    site [i].lat_deg     = -87.0 + 174.0 * i / 31;
+    site [i].long_deg    = -180.0 + 11.25 * i;
+    site [i].timezone_hr = floor (site [i].long_deg / 15.0 + 0.5);
+    }
+  for (i = 0 ; i < 1440 ; i++) w [i] = (double) i / 1440.0;
+  ntile       = 32 * 92;
+  job.site    = site;
+  job.w       = w;
+  job.date0_d = 46023;
+  job.nday    = 92;
+  job.nsamp   = 1440;
+  job.tile0   = 0;
+  sz          = (size_t) 5 * 1440 * ntile;
+  job.out     = new float [sz];
+  ref         = new float [sz];
+  nmax        = std :: thread :: hardware_concurrency ();
+  if (nmax < 1) nmax = 1;
+  printf ("Batch kernel: %s, %d tiles of 1440 samples, up to %d threads\n", use_avx2 ? "AVX2" : "scalar (no AVX2)", ntile, nmax);
+  printf ("  threads   time [ms]   tiles/s   speedup   output\n");
+  fail = 0;
+  t1   = 0;
+  for (nthr = 1 ; nthr <= nmax ; nthr = (nthr * 2 > nmax && nthr < nmax) ? nmax : nthr * 2) {
+    t = 1e30;
+    for (r = 0 ; r < 3 ; r++) {
+      memset (job.out, 0, sz * sizeof (float));
+      a = std :: chrono :: steady_clock :: now ();
+      parrun (ntile, nthr, gentile, &job);
+      t = fmin (t, std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ());
+      }
+    if (nthr == 1) {
+      memcpy (ref, job.out, sz * sizeof (float));
+      t1 = t;
+      }
+    i = (memcmp (ref, job.out, sz * sizeof (float)) == 0);
+    if (! i) fail = 1;
+    printf ("  %7d   %9.1f   %7.0f   %7.2f   %s\n", nthr, 1000 * t, ntile / t, t1 / t, i ? "identical" : "DIFFERS");
+    }
+  delete [] ref;
+  delete [] job.out;
+  return (fail);
+  }
 
-  FILE *f;
-  char line [256];
-  int  dst = 0;
 
-  // Load geographic configuration file, if it exists
 
-  f = fopen ("noaa_clock.cnf", "r");
-  if (f) {
-    char dststr [256], rloc [256];
-    while (! feof (f)) {
-      fgets (line, 252, f);
-      if (feof (f)) break;
-      if (line [0] == '\n') continue;
-      if (strchr (line, '*')) break;
-      sscanf (line, "%s %lf %lf %lf %s", rloc, la, lo, tz, dststr);
-      if (strcmpi (rloc, loc) == 0) {
-        if (strcmpi (dststr, "EU") == 0) *tz += setdst_eu ();
-        break;
+/**************************************************************************\
+*
+* FUNCTION      accuracy
+*
+* DESCRIPTION   Error of the float and double tiers against the exact
+*               tier.
+*
+* ARGUMENTS     -
+*
+* GLOBALS       use_avx2    Batch evaluation by the AVX2 kernel
+*               precision   Precision tier, restored on return
+*
+* RETURNS       Exit value
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Every minute of days from 1950 to 2100, latitudes from
+*               pole to pole and the polar circles, timezones -12...+14 h.
+*               Also the corrected elevation next to the refraction
+*               branch points at -0.575, 5 and 85 degrees, where a tiny
+*               elevation error may pick the other branch. Azimuth is
+*               left out within a degree of the poles and within 5
+*               degrees of the zenith and the nadir, where it is
+*               ill-conditioned. Most
+*               of the double tier's error is the Chebyshev ephemeris and
+*               the linear interpolation of the date-dependent terms over
+*               the day.
+*
+\**************************************************************************/
+
+int accuracy (void) {
+  static float  ref [5 * 1440], out [5 * 1440];
+  const double  lat [] = {-90, -89.9, -85, -75, -66.56, -60, -45, -30, -15, -5, 0, 5, 15, 23.44, 30, 45, 60, 66.56, 70, 80, 85, 89.9, 90};
+  const char    *name [9] = {"solar time [min]", "elevation [deg]", "corrected elevation [deg]", "azimuth [deg]", "Sun longitude [deg]",
+                             "  elevation -0.575 +-0.25", "  elevation 5 +-0.25", "  elevation 85 +-0.25", "elevation, polar latitudes"};
+  const char    *tname [2] = {"float", "double"};
+  NoaaIn        in;
+  NoaaDay       day;
+  NoaaCols      rc, oc;
+  double        w [1440], emax [2][9], sum2 [2][9], t [2], e, el;
+  long          cnt [2][9], ns;
+  int           prec0, tier, i, k, la, dd, nlat;
+  std :: chrono :: steady_clock :: time_point a;
+  prec0 = precision;
+  nlat  = sizeof (lat) / sizeof (lat [0]);
+  rc.solarmin = ref; rc.elev = ref + 1440; rc.elevc = ref + 2880; rc.azim = ref + 4320; rc.sunlong = ref + 5760;
+  oc.solarmin = out; oc.elev = out + 1440; oc.elevc = out + 2880; oc.azim = out + 4320; oc.sunlong = out + 5760;
+  for (i = 0 ; i < 1440 ; i++) w [i] = (double) i / 1440.0;
+  for (tier = 0 ; tier < 2 ; tier++) {
+    t [tier] = 0;
+    for (k = 0 ; k < 9 ; k++) emax [tier][k] = sum2 [tier][k] = cnt [tier][k] = 0;
+    }
+  ns = 0;
+  for (la = 0 ; la < nlat ; la++) {
+    for (dd = 18264 ; dd < 73415 ; dd += 613) {
+      in.lat_deg     = lat [la];
+      in.long_deg    = 7.3 * la - 180 * (la > nlat / 2);
+      in.date_d      = dd;
+      in.wtime_day   = 0;
+      in.timezone_hr = ((dd / 613) % 27) - 12;
+      noaa_day (&in, &day);
+      noaa_batch_exact (&day, w, 1440, &rc);
+      ns += 1440;
+      for (tier = 0 ; tier < 2 ; tier++) {
+        precision = (tier == 0) ? PREC_FLOAT : PREC_DOUBLE;
+        a = std :: chrono :: steady_clock :: now ();
+        noaa_batch (&day, w, 1440, &oc);
+        t [tier] += std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ();
+        for (i = 0 ; i < 1440 ; i++) {
+          el = ref [1440 + i];
+          for (k = 0 ; k < 9 ; k++) {
+            if      (k <= 4) e = fabs ((double) out [k * 1440 + i] - ref [k * 1440 + i]);
+            else if (k <= 7) e = fabs ((double) out [2880 + i] - ref [2880 + i]);
+            else             e = fabs ((double) out [1440 + i] - ref [1440 + i]);
+            if (k == 0) e = fmin (e, fabs (e - 1440));
+            if ((k == 3) || (k == 4)) e = fmin (e, fabs (e - 360));
+            if ((k == 3) && ((fabs (lat [la]) > 89) || (fabs (el) > 85))) continue;
+            if ((k == 5) && (fabs (el + 0.575) > 0.25)) continue;
+            if ((k == 6) && (fabs (el - 5) > 0.25)) continue;
+            if ((k == 7) && (fabs (el - 85) > 0.25)) continue;
+            if ((k == 8) && (fabs (lat [la]) < 66.56)) continue;
+            if ((e > emax [tier][k]) || (e != e)) emax [tier][k] = e;
+            sum2 [tier][k] += e * e;
+            cnt  [tier][k]++;
+            }
+          }
         }
       }
     }
-  if (f) {fclose (f); return (true);}
+  precision = prec0;
+  printf ("Precision tiers against the exact tier, %ld samples, batch kernel %s\n", ns, use_avx2 ? "AVX2" : "scalar (no AVX2)");
+  printf ("%-31s%15s%22s\n", "", tname [0], tname [1]);
+  printf ("%-31s%11s%11s%11s%11s\n", "", "max", "rms", "max", "rms");
+  for (k = 0 ; k < 9 ; k++) {
+    printf ("%-31s", name [k]);
+    for (tier = 0 ; tier < 2 ; tier++) printf ("%11.2e%11.2e", emax [tier][k], cnt [tier][k] ? sqrt (sum2 [tier][k] / cnt [tier][k]) : 0.0);
+    printf ("\n");
+    }
+  printf ("%-31s%11.1f%22.1f\n", "time [ns/sample]", 1e9 * t [0] / ns, 1e9 * t [1] / ns);
+  return (0);
+  }
 
-  // Fallback for a missing noaa_clock.cnf
 
-  if (strcmpi (loc, "Helsinki") == 0) {
-    *la = 60.16; *lo = 24.83; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Riihimki") == 0) {
-    *la = 60.739; *lo = 24.772; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Tampere") == 0) {
-    *la = 61.498; *lo = 23.761; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Yljrvi") == 0) {
-    *la = 61.55; *lo = 23.583; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Rovaniemi") == 0) {
-    *la = 66.5; *lo = 25.733; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Inari") == 0) {
-    *la = 68.905; *lo = 27.03; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Utsjoki") == 0) {
-    *la = 69.9; *lo = 27.017; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if ((strcmpi (loc, "Tukholma") == 0) || (strcmpi (loc, "Stockholm") == 0)) {
-    *la = 59.329; *lo = 18.069; *tz = 1;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Vargn") == 0) {
-    *la = 58.35; *lo = 12.4; *tz = 1;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if (strcmpi (loc, "Reykjavik") == 0) {
-    *la = 64.135; *lo = -21.895; *tz = 0;   // No DST
-    return (true);
-    }
-  if (strcmpi (loc, "Longyearbyen") == 0) {
-    *la = 78.22; *lo = 15.65; *tz = 1;
-    *tz += setdst_eu ();
-    return (true);
-    }
-  if ((strcmpi (loc, "Tallinna") == 0) || (strcmpi (loc, "Tallinn") == 0)) {
-    *la = 59.437; *lo = 24.745; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
+
+#ifdef NOAA_BENCH
+
+#ifndef NOAA_COMMIT
+#define NOAA_COMMIT "unknown"   // Commit of the benchmarked source, set by CMakeLists.txt
+#endif
+
+
+
+/**************************************************************************\
+*
+* FUNCTION      bench
+*
+* DESCRIPTION   Benchmark of the NOAA engine and the display.
+*
+* ARGUMENTS     argc   Argument count
+*               argv   Argument vector: [-json file] [frames]
+*
+* GLOBALS       clocknow      Fixed UTC clock, stepped here
+*               precision     Precision tier, restored on return
+*               use_avx2      Batch evaluation by the AVX2 kernel
+*               lat_deg       Latitude [Decimal degrees]
+*               long_deg      Longitude [Decimal degrees]
+*               timezone_std  Standard timezone [Hours]
+*               dst_rule      Daylight saving time rule
+*               dstz          Daylight saving time transitions
+*               locname       Location shown
+*               tab           Per-minute tables of the current day
+*               dw            Display widget
+*               painter       Qt painter object
+*
+* RETURNS       Exit value, -1 for bad arguments
+*
+* HISTORY       2026 10 15   JPT   Created
+*
+* NOTES         Times single noaa_eq () evaluations, load () of whole day
+*               tables in each precision tier, noaa_day () with
+*               noaa_events () of a day, and frames of the display
+*               rendered into a QImage on the offscreen Qt platform. The
+*               frames are at a fixed location with the clock fixed and
+*               stepped a minute per frame from local midnight, so the
+*               runs repeat exactly. A full frame paints the whole
+*               widget, a tick frame only the region invalidate () would
+*               repaint; the first frame also draws the cached layers.
+*               Best of five runs, of three for the frames. The JSON
+*               carries the commit and a hash of the last full frame, for
+*               comparing results across commits.
+*
+\**************************************************************************/
+
+int bench (int argc, char *argv []) {
+  const char    *tname [3] = {"float", "double", "exact"};
+  volatile double sink;
+  NoaaIn        in;
+  NoaaOut       o;
+  NoaaDay       day;
+  SunEvents     ev;
+  DayKey        key;
+  QDateTime     t0;
+  QRegion       r;
+  FILE          *f;
+  const char    *json;
+  double        teq, tday [3], tev, tfirst, tfull, ttick;
+  unsigned int  hash;
+  int           neq, nday, nfr, prec0, i, k, run;
+  std :: chrono :: steady_clock :: time_point a;
+  json = NULL;
+  nfr  = 1440;
+  for (i = 1 ; i < argc ; i++) {
+    if ((strcmp (argv [i], "-json") == 0) && (i + 1 < argc)) json = argv [++i];
+    else if ((sscanf (argv [i], "%d", &nfr) != 1) || (nfr < 1) || (nfr > 1440)) return (-1);
     }
-  if ((strcmpi (loc, "Moskova") == 0) || (strcmpi (loc, "Moscow") == 0)) {
-    *la = 55.75; *lo = 37.617; *tz = 2;
-    *tz += setdst_eu ();
-    return (true);
+  prec0 = precision;
+
+  // noaa_eq (), every minute of 182 days
+
+  neq  = 1440 * 182;
+  teq  = 1e30;
+  sink = 0;
+  in.lat_deg     = 60.17;
+  in.long_deg    = 24.94;
+  in.timezone_hr = 2;
+  for (run = 0 ; run < 5 ; run++) {
+    a = std :: chrono :: steady_clock :: now ();
+    for (i = 0 ; i < neq ; i++) {
+      in.date_d    = 46023 + 2 * (i / 1440);
+      in.wtime_day = (i % 1440) / 1440.0;
+      o = noaa_eq (&in);
+      sink = sink + o.elevc_deg;
+      }
+    teq = fmin (teq, std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ());
     }
-  if ((strcmpi (loc, "Lontoo") == 0) || (strcmpi (loc, "London") == 0)) {
-    *la = 51.5; *lo = -0.126; *tz = 0;
-    *tz += setdst_eu ();
-    return (true);
+
+  // load (), a year of days per tier
+
+  nday = 365;
+  tab  = new DayTab;
+  for (k = 0 ; k < 3 ; k++) {
+    precision = k;
+    tday [k]  = 1e30;
+    for (run = 0 ; run < 5 ; run++) {
+      a = std :: chrono :: steady_clock :: now ();
+      for (i = 0 ; i < nday ; i++) {
+        in.date_d    = 46023 + i;
+        in.wtime_day = 0;
+        load (&in, tab);
+        sink = sink + tab -> elevc [i];
+        }
+      tday [k] = fmin (tday [k], std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ());
+      }
     }
-  if ((strcmpi (loc, "Hampuri") == 0) || (strcmpi (loc, "Hamburg") == 0)) {
-    *la = 53.553; *lo = 9.992; *tz = 1;
-    *tz += setdst_eu ();
-    return (true);
+  precision = prec0;
+
+  // noaa_day () and noaa_events (), a year of days
+
+  tev = 1e30;
+  for (run = 0 ; run < 5 ; run++) {
+    a = std :: chrono :: steady_clock :: now ();
+    for (i = 0 ; i < nday ; i++) {
+      in.date_d = 46023 + i;
+      noaa_day (&in, &day);
+      noaa_events (&day, 0, &ev);
+      sink = sink + ev.rise_day [1];
+      }
+    tev = fmin (tev, std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ());
     }
-  if ((strcmpi (loc, "Rooma") == 0) || (strcmpi (loc, "Roma") == 0)) {
-    *la = 41.895; *lo = 12.482; *tz = 1;
-    *tz += setdst_eu ();
-    return (true);
+
+  // Display frames from local midnight of the summer solstice
+
+  if (! qEnvironmentVariableIsSet ("QT_QPA_PLATFORM")) qputenv ("QT_QPA_PLATFORM", "offscreen");
+  QApplication app (argc, argv);
+  QImage       img (1920, 1080, QImage :: Format_RGB32);
+  lat_deg      = in.lat_deg;
+  long_deg     = in.long_deg;
+  timezone_std = in.timezone_hr;
+  dst_rule     = DST_NONE;
+  dstz         = dstzone (timezone_std, dst_rule);
+  snprintf (locname, sizeof (locname), "%.3f, %.3f", lat_deg, long_deg);
+  t0 = QDateTime (QDate (2026, 6, 21), QTime (0, 0), Qt :: UTC).addSecs ((qint64) (-3600 * timezone_std));
+  clocknow = t0;
+  daykey (clocknow, &key);
+  in.date_d      = key.date_d;
+  in.timezone_hr = key.timezone_hr;
+  load (&in, tab);
+  tab -> key = key;
+  dw = new DispWidget ();
+  dw -> setAttribute (Qt :: WA_OpaquePaintEvent);
+  dw -> resize (1920, 1080);
+  painter = new QPainter ();
+  dw -> eloop ();
+  a = std :: chrono :: steady_clock :: now ();
+  dw -> render (&img);
+  tfirst = std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ();
+  tfull = ttick = 1e30;
+  for (run = 0 ; run < 3 ; run++) {
+    a = std :: chrono :: steady_clock :: now ();
+    for (i = 0 ; i < nfr ; i++) {
+      clocknow = t0.addSecs (60 * i);
+      dw -> eloop ();
+      dw -> render (&img);
+      }
+    tfull = fmin (tfull, std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ());
+    a = std :: chrono :: steady_clock :: now ();
+    for (i = 0 ; i < nfr ; i++) {
+      r = dw -> shownreg;
+      clocknow = t0.addSecs (60 * i);
+      dw -> eloop ();
+      dw -> render (&img, QPoint (), r | dw -> shownreg);
+      }
+    ttick = fmin (ttick, std :: chrono :: duration <double> (std :: chrono :: steady_clock :: now () - a).count ());
     }
-  if ((strcmpi (loc, "Tokio") == 0) || (strcmpi (loc, "Tokyo") == 0)) {
-    *la = 35.683; *lo = 139.767; *tz = 9;   // No DST
-    return (true);
+  dw -> render (&img);
+  hash = tabhash (img.constBits (), (size_t) img.bytesPerLine () * img.height ());
+  delete painter;
+  delete dw;
+  delete tab;
+  painter  = NULL;
+  dw       = NULL;
+  tab      = NULL;
+  clocknow = QDateTime ();
+
+  // Results
+
+  if ((json == NULL) || (strcmp (json, "-") != 0)) {
+    printf ("NOAA engine and display benchmark, commit %s, batch kernel %s\n", NOAA_COMMIT, use_avx2 ? "AVX2" : "scalar (no AVX2)");
+    printf ("  noaa_eq ()           %10.1f ns/eval\n", 1e9 * teq / neq);
+    for (k = 0 ; k < 3 ; k++) printf ("  load (), %-11s %10.2f us/day\n", tname [k], 1e6 * tday [k] / nday);
+    printf ("  day terms and events %10.2f us/day\n", 1e6 * tev / nday);
+    printf ("  first frame          %10.3f ms\n", 1e3 * tfirst);
+    printf ("  full frame           %10.3f ms/frame\n", 1e3 * tfull / nfr);
+    printf ("  tick frame           %10.3f ms/frame\n", 1e3 * ttick / nfr);
+    printf ("  last frame hash        %08x\n", hash);
     }
-  if ((strcmpi (loc, "Teheran") == 0) || (strcmpi (loc, "Tehran") == 0)) {
-    *la = 35.696; *lo = 51.423; *tz = 3.5;   // No DST
-    return (true);
+  if (json == NULL) return (0);
+  f = (strcmp (json, "-") == 0) ? stdout : fopen (json, "w");
+  if (f == NULL) {
+    printf ("Cannot write '%s'.\n", json);
+    return (1);
     }
+  fprintf (f, "{\n  \"commit\": \"%s\",\n  \"kernel\": \"%s\",\n", NOAA_COMMIT, use_avx2 ? "avx2" : "scalar");
+#ifdef NOAA_NOCHEB
+  fprintf (f, "  \"chebyshev\": false,\n");
+#else
+  fprintf (f, "  \"chebyshev\": true,\n");
+#endif
+  fprintf (f, "  \"noaa_eq_ns_per_eval\": %.1f,\n", 1e9 * teq / neq);
+  fprintf (f, "  \"load_us_per_day\": {\"float\": %.2f, \"double\": %.2f, \"exact\": %.2f},\n",
+           1e6 * tday [0] / nday, 1e6 * tday [1] / nday, 1e6 * tday [2] / nday);
+  fprintf (f, "  \"events_us_per_day\": %.2f,\n", 1e6 * tev / nday);
+  fprintf (f, "  \"frame_ms\": {\"first\": %.3f, \"full\": %.3f, \"tick\": %.3f},\n", 1e3 * tfirst, 1e3 * tfull / nfr, 1e3 * ttick / nfr);
+  fprintf (f, "  \"frames\": %d,\n  \"frame_hash\": \"%08x\"\n}\n", nfr, hash);
+  if (f != stdout) fclose (f);
+  return (0);
+  }
 
-  return (false);
- 
- }
+#endif
 
 
 
@@ -830,9 +7923,48 @@ bool setcoord (char *loc, double *la, double *lo, double *tz) {
 \**************************************************************************/
 
 void usage (char *pn) {
-  printf ("Use: %s latitude longitude timezone [mytimezone]\n", pn);
-  printf ("Or:  %s locationname [mytimezone]\n\n", pn);
-  printf ("Longitude is positive east, timezone must include the daylight saving time.\n\n");
+  printf ("Use: %s [-prec float|double|exact] [-smooth] [-fb [argb32|rgb565] target] latitude longitude timezone [mytimezone]\n", pn);
+  printf ("Or:  %s [-prec float|double|exact] [-smooth] [-fb [argb32|rgb565] target] locationname [mytimezone]\n", pn);
+  printf ("Or:  %s -check\n", pn);
+  printf ("Or:  %s -accuracy\n", pn);
+  printf ("Or:  %s -scaling\n", pn);
+  printf ("Or:  %s -events yyyy-mm-dd site [elevation]\n", pn);
+  printf ("Or:  %s -gaz [source [target [timezones]]]\n", pn);
+  printf ("Or:  %s -cheb [file]\n", pn);
+  printf ("Or:  %s -near latitude,longitude [km] | -\n", pn);
+  printf ("Or:  %s -gen yyyy-mm-dd yyyy-mm-dd step csv|bin file site [site ...]\n", pn);
+  printf ("Or:  %s [-prec float|double|exact] -grid site site [site ...]\n", pn);
+#ifndef _WIN32
+  printf ("Or:  %s [-prec float|double|exact] -serve socket\n", pn);
+  printf ("Or:  %s -query socket request|-|-bench n\n", pn);
+#endif
+  printf ("\n");
+  printf ("Longitude is positive east, timezone must include the daylight saving time.\n");
+  printf ("-smooth moves the pointers and values between the minutes.\n");
+  printf ("-fb draws without a window into shared memory shm:name, a file or a /dev/fb*\n");
+  printf ("framebuffer device, ARGB32 by default.\n");
+  printf ("-prec selects the precision of the per-minute tables, also for -gen; double by\n");
+  printf ("default, -accuracy shows the errors.\n");
+  printf ("Generator step is in seconds, file - is standard output, a site is a location\n");
+  printf ("name or latitude,longitude,timezone; times are standard time of the site.\n");
+  printf ("Event elevations are geometric, -0.833 is sunrise and sunset.\n");
+  printf ("-gaz compiles noaa_clock.cnf or a GeoNames dump into noaa_clock.gaz.\n");
+  printf ("-cheb regenerates the Chebyshev ephemeris noaa_cheb.h.\n");
+  printf ("-near finds the nearest location or those within km, - reads latitude,longitude\n");
+  printf ("lines and writes latitude,longitude,name,km lines.\n");
+  printf ("-grid shows up to %d clocks; a site is a location name or\n", GRID_MAX);
+  printf ("latitude,longitude,timezone[,none|eu|us|au|nz].\n");
+#ifndef _WIN32
+  printf ("-serve answers queries on a Unix socket, one JSON object per line, e.g.\n");
+  printf ("{\"op\": \"point\", \"lat\": 60.17, \"lon\": 24.94, \"t\": \"2026-06-21T12:00:00Z\"}, op day or\n");
+  printf ("events with \"date\": \"yyyy-mm-dd\", \"tz\" and for events \"elev\"; or binary QryReq.\n");
+  printf ("-query sends a request, - the lines of standard input, -bench n point queries.\n");
+#endif
+  printf ("\n");
+#ifdef NOAA_PERF
+  printf ("Timers: %s [-prec ...] [-smooth] -perf file|-|unix:path location ...\n", pn);
+  printf ("dumps the timers every %d s as JSON lines; P shows them on the display.\n\n", PERF_DUMP);
+#endif
   }
 
 
@@ -848,36 +7980,146 @@ void usage (char *pn) {
 *
 * GLOBALS       lat_deg       Latitude [Decimal degrees]
 *               long_deg      Longitude [Decimal degrees]
-*               timezone_hr   Timezone [Hours]
+*               locname       Location shown
+*               timezone_std  Standard timezone [Hours]
+*               dst_rule      Daylight saving time rule
+*               dstz          Daylight saving time transitions
 *               my_timezone   Timezone of the user's location [Hours]
+*               my_tz_given   my_timezone given on the command line
 *               dw            Display widget
 *               painter       Qt painter object
 *
 * RETURNS       Error code
 *
 * HISTORY       2016 05 24   JPT   File documenting begins
+*               2026 10 15   JPT   Location caption, nearest known location to coordinates
+*               2026 10 15   JPT   Daylight saving time transition table
+*               2026 10 15   JPT   Benchmark build
+*               2026 10 15   JPT   Timer dump
+*               2026 10 15   JPT   Headless framebuffer
+*               2026 10 15   JPT   Query daemon and client
 *
-* NOTES         -
+* NOTES         Built with NOAA_BENCH, runs bench () only.
 *
 \**************************************************************************/
 
 int main (int argc, char *argv []) {
   QTimer timer;
   char   loc [256];
+  int    i;
+  use_avx2 = cpu_avx2 ();
+  initdir ();
+#ifdef NOAA_PERF
+  perfinit ();
+#endif
+#ifdef NOAA_BENCH
+  i = bench (argc, argv);
+  if (i < 0) printf ("Use: %s [-json file] [frames]\n\nfile - is standard output, frames 1...1440.\n", argv [0]);
+  return (i < 0 ? 1 : i);
+#endif
+  if ((argc >= 3) && (strcmp (argv [1], "-prec") == 0)) {
+    if      (strcmp (argv [2], "float")  == 0) precision = PREC_FLOAT;
+    else if (strcmp (argv [2], "double") == 0) precision = PREC_DOUBLE;
+    else if (strcmp (argv [2], "exact")  == 0) precision = PREC_EXACT;
+    else {
+      usage (argv [0]);
+      return (1);
+      }
+    argv [2] = argv [0];
+    argc -= 2;
+    argv += 2;
+    }
+  if ((argc == 2) && (strcmp (argv [1], "-accuracy") == 0)) return (accuracy ());
+  if ((argc == 2) && (strcmp (argv [1], "-check") == 0)) return (check ());
+  if ((argc == 2) && (strcmp (argv [1], "-scaling") == 0)) return (scaling ());
+  if ((argc >= 2) && (strcmp (argv [1], "-gaz") == 0)) {
+    i = gazc (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+  if ((argc >= 2) && (strcmp (argv [1], "-cheb") == 0)) {
+    i = chebgen (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+  if ((argc >= 2) && (strcmp (argv [1], "-near") == 0)) {
+    i = revgeo (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+  if ((argc >= 2) && (strcmp (argv [1], "-events") == 0)) {
+    i = events (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+  if ((argc >= 2) && (strcmp (argv [1], "-gen") == 0)) {
+    i = gen (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+  if ((argc >= 2) && (strcmp (argv [1], "-grid") == 0)) {
+    i = gridmain (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+#ifndef _WIN32
+  if ((argc >= 2) && (strcmp (argv [1], "-serve") == 0)) {
+    i = serve (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+  if ((argc >= 2) && (strcmp (argv [1], "-query") == 0)) {
+    i = query (argc, argv);
+    if (i < 0) usage (argv [0]);
+    return (i < 0 ? 1 : i);
+    }
+#endif
+  if ((argc >= 2) && (strcmp (argv [1], "-smooth") == 0)) {
+    smooth   = true;
+    argv [1] = argv [0];
+    argc--;
+    argv++;
+    }
+#ifndef _WIN32
+  if ((argc >= 3) && (strcmp (argv [1], "-fb") == 0)) {
+    i = 2;
+    if      (strcmp (argv [2], "argb32") == 0) {fbfmt = FB_ARGB32; i = 3;}
+    else if (strcmp (argv [2], "rgb565") == 0) {fbfmt = FB_RGB565; i = 3;}
+    if (argc <= i) {
+      usage (argv [0]);
+      return (1);
+      }
+    fbdst    = argv [i];
+    argv [i] = argv [0];
+    argc -= i;
+    argv += i;
+    }
+#endif
+#ifdef NOAA_PERF
+  if ((argc >= 3) && (strcmp (argv [1], "-perf") == 0)) {
+    if (! perfopen (argv [2])) {
+      printf ("Cannot open '%s'.\n", argv [2]);
+      return (1);
+      }
+    argv [2] = argv [0];
+    argc -= 2;
+    argv += 2;
+    }
+#endif
   if (argc == 2) {
     sscanf (argv [1], "%s", loc);
-    if (setcoord (loc, &lat_deg, &long_deg, &timezone_hr) == false) {
+    if (setcoord (loc, &lat_deg, &long_deg, &timezone_std, &dst_rule) == false) {
       printf ("'%s' is an unknown location.\n\n", loc);
       usage (argv [0]);
       showlocs ();
       return (1);
       }
-    my_timezone = timezone_hr;
     }
   else if (argc == 3) {
     sscanf (argv [1], "%s", loc);
     sscanf (argv [2], "%lf", &my_timezone);
-    if (setcoord (loc, &lat_deg, &long_deg, &timezone_hr) == false) {
+    my_tz_given = true;
+    if (setcoord (loc, &lat_deg, &long_deg, &timezone_std, &dst_rule) == false) {
       printf ("'%s' is an unknown location.\n\n", loc);
       usage (argv [0]);
       showlocs ();
@@ -887,28 +8129,50 @@ int main (int argc, char *argv []) {
   else if (argc == 4) {
     sscanf (argv [1], "%lf", &lat_deg);
     sscanf (argv [2], "%lf", &long_deg);
-    sscanf (argv [3], "%lf", &timezone_hr);
-    my_timezone = timezone_hr;
+    sscanf (argv [3], "%lf", &timezone_std);
     }
   else if (argc >= 5) {
     sscanf (argv [1], "%lf", &lat_deg);
     sscanf (argv [2], "%lf", &long_deg);
-    sscanf (argv [3], "%lf", &timezone_hr);
+    sscanf (argv [3], "%lf", &timezone_std);
     sscanf (argv [4], "%lf", &my_timezone);
+    my_tz_given = true;
     }
   else {
     usage (argv [0]);
     return (1);
     }
+  dstz = dstzone (timezone_std, dst_rule);
+  if (argc <= 3) snprintf (locname, sizeof (locname), "%s", loc);
+  else {
+    char   name [200];
+    double km;
+    snprintf (locname, sizeof (locname), "%.3f, %.3f", lat_deg, long_deg);
+    if (nearest (lat_deg, long_deg, name, sizeof (name), &km))
+      snprintf (locname, sizeof (locname), "%.3f, %.3f, %.0f km from %s", lat_deg, long_deg, km, name);
+    }
+  for (i = 0 ; i < NSPARE ; i++) spare [i] = new DayTab;
+#ifndef _WIN32
+  if (fbdst != NULL) return (headless (argc, argv));
+#endif
   QApplication app (argc, NULL);
   dw = new DispWidget ();
+  dw -> setAttribute (Qt :: WA_OpaquePaintEvent);
+#ifdef NOAA_PERF
+  dw -> setFocusPolicy (Qt :: StrongFocus);
+#endif
   dw -> resize (1920, 1080);
   dw -> show ();
   painter = new QPainter ();
+  timer.setSingleShot (true);
+  ticker = &timer;
+  std :: thread worker (prepwork);
   dw -> eloop ();
-  timer.start (5000);
   QObject :: connect (&timer, SIGNAL (timeout ()), dw, SLOT (eloop ()));
   dw -> eloop ();   // Extra iteration
   app.exec ();
+  prepquit = true;
+  prepcv.notify_one ();
+  worker.join ();
   return (0);
   }